@@ -0,0 +1,190 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkConstInteriorNeighborhoodIterator_h
+#define itkConstInteriorNeighborhoodIterator_h
+
+#include "itkImage.h"
+#include "itkSIMDPixelTransform.h"
+#include <vector>
+
+namespace itk
+{
+/** \class ConstInteriorNeighborhoodIterator
+ *
+ * \brief Read-only iteration of a rectangular neighborhood across a region
+ * whose neighborhoods are all inside the buffered region of the image.
+ *
+ * It is the iterator of the non-boundary region computed by
+ * NeighborhoodAlgorithm::ImageBoundaryFacesCalculator. Since no neighborhood
+ * of that region reaches the boundary of the buffer, it has no boundary
+ * condition: the offsets of the neighbors in the buffer are computed once
+ * by the constructor, GetPixel(i) reads the pixel at the center plus the
+ * offset of neighbor i, and operator++ increments the pointer to the center,
+ * with a jump at the end of each line. A ConstNeighborhoodIterator checks
+ * whether it needs its boundary condition for each pixel it reads.
+ *
+ * The neighbors are numbered as the neighbors of a ConstNeighborhoodIterator
+ * of the same radius, so that the index of neighbor i is
+ * GetIndex() + GetOffset(i), and NeighborhoodInnerProduct computes the same
+ * inner products with both iterators. The image must have a
+ * HasPixelArrayBuffer, like an Image: the filters use this iterator for such
+ * images, and a ConstNeighborhoodIterator for the VectorImage and the
+ * ImageAdaptor.
+ *
+ * \sa ConstNeighborhoodIterator
+ * \sa NeighborhoodAlgorithm::ImageBoundaryFacesCalculator
+ * \ingroup ImageIterators
+ * \ingroup ITKCommon
+ */
+template <typename TImage>
+class ITK_TEMPLATE_EXPORT ConstInteriorNeighborhoodIterator
+{
+public:
+  /** Standard class type aliases. */
+  using Self = ConstInteriorNeighborhoodIterator;
+
+  /** Save the image dimension. */
+  static constexpr unsigned int Dimension = TImage::ImageDimension;
+
+  /** Typedef support for common objects */
+  using ImageType = TImage;
+  using PixelType = typename TImage::PixelType;
+  using RegionType = typename TImage::RegionType;
+  using IndexType = typename TImage::IndexType;
+  using OffsetType = typename TImage::OffsetType;
+  using SizeType = typename TImage::SizeType;
+  using RadiusType = SizeType;
+  using NeighborIndexType = SizeValueType;
+
+  /** Default constructor, an iterator at its end. */
+  ConstInteriorNeighborhoodIterator() = default;
+
+  /** Constructor which places the iterator at the beginning of the region.
+   * Throws an ExceptionObject when a neighborhood of the region is not
+   * inside the buffered region of the image. */
+  ConstInteriorNeighborhoodIterator(const RadiusType & radius, const ImageType * image, const RegionType & region);
+
+  /** Moves the iterator to the beginning of the region. */
+  void
+  GoToBegin();
+
+  /** Whether the iterator is past the last pixel of the region. */
+  bool
+  IsAtEnd() const
+  {
+    return m_IsAtEnd;
+  }
+
+  /** Moves the center of the neighborhood to the next pixel of the region. */
+  Self &
+  operator++()
+  {
+    if (++m_Center == m_EndOfLine)
+    {
+      this->NextLine();
+    }
+    return *this;
+  }
+
+  /** Returns the value of neighbor i. */
+  const PixelType &
+  GetPixel(const NeighborIndexType i) const
+  {
+    return m_Center[m_NeighborOffsets[i]];
+  }
+
+  /** Returns the value of the pixel at the center of the neighborhood. */
+  const PixelType &
+  GetCenterPixel() const
+  {
+    return *m_Center;
+  }
+
+  /** Returns the number of pixels of the neighborhood. */
+  NeighborIndexType
+  Size() const
+  {
+    return static_cast<NeighborIndexType>(m_NeighborOffsets.size());
+  }
+
+  /** Returns the radius of the neighborhood. */
+  const RadiusType &
+  GetRadius() const
+  {
+    return m_Radius;
+  }
+
+  /** Returns the difference between the numbers of two neighbors which are
+   * consecutive along the axis, as ConstNeighborhoodIterator::GetStride. */
+  NeighborIndexType
+  GetStride(const unsigned int axis) const
+  {
+    return m_Strides[axis];
+  }
+
+  /** Returns the offset of neighbor i to the center of the neighborhood. */
+  OffsetType
+  GetOffset(NeighborIndexType i) const;
+
+  /** Returns the index of the center of the neighborhood. */
+  IndexType
+  GetIndex() const;
+
+  /** Returns the region of the centers of the neighborhoods. */
+  const RegionType &
+  GetRegion() const
+  {
+    return m_Region;
+  }
+
+  /** Returns the offsets of the neighbors in the buffer of the image, to the
+   * center of the neighborhood. */
+  const std::vector<OffsetValueType> &
+  GetNeighborOffsets() const
+  {
+    return m_NeighborOffsets;
+  }
+
+private:
+  void
+  NextLine();
+
+  const ImageType *            m_Image{ nullptr };
+  RegionType                   m_Region{};
+  RadiusType                   m_Radius{};
+  NeighborIndexType            m_Strides[Dimension]{};
+  std::vector<OffsetValueType> m_NeighborOffsets{};
+
+  /** The pixel at the center of the neighborhood, the first pixel of its line,
+   * and the pixel after its line in the buffer. */
+  const PixelType * m_Center{ nullptr };
+  const PixelType * m_BeginOfLine{ nullptr };
+  const PixelType * m_EndOfLine{ nullptr };
+
+  /** The position of the line in the region, along the axes 1 to
+   * Dimension - 1. */
+  SizeType m_LinePosition{};
+  bool     m_IsAtEnd{ true };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkConstInteriorNeighborhoodIterator.hxx"
+#endif
+
+#endif
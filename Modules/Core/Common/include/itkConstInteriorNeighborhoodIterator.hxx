@@ -0,0 +1,134 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkConstInteriorNeighborhoodIterator_hxx
+#define itkConstInteriorNeighborhoodIterator_hxx
+
+
+namespace itk
+{
+template <typename TImage>
+ConstInteriorNeighborhoodIterator<TImage>::ConstInteriorNeighborhoodIterator(const RadiusType & radius,
+                                                                             const ImageType *  image,
+                                                                             const RegionType & region)
+  : m_Image(image)
+  , m_Region(region)
+  , m_Radius(radius)
+{
+  static_assert(HasPixelArrayBuffer<TImage>, "The buffer of the image must be an array of its pixels.");
+
+  if (region.GetNumberOfPixels() > 0)
+  {
+    RegionType neighborhoodsRegion = region;
+    neighborhoodsRegion.PadByRadius(radius);
+    if (!image->GetBufferedRegion().IsInside(neighborhoodsRegion))
+    {
+      itkGenericExceptionMacro("The neighborhoods of radius " << radius << " of the region " << region
+                                                              << " are not inside the buffered region "
+                                                              << image->GetBufferedRegion() << '.');
+    }
+  }
+
+  NeighborIndexType numberOfNeighbors = 1;
+  for (unsigned int d = 0; d < Dimension; ++d)
+  {
+    m_Strides[d] = numberOfNeighbors;
+    numberOfNeighbors *= 2 * radius[d] + 1;
+  }
+
+  const OffsetValueType * offsetTable = image->GetOffsetTable();
+  m_NeighborOffsets.resize(numberOfNeighbors);
+  for (NeighborIndexType i = 0; i < numberOfNeighbors; ++i)
+  {
+    const OffsetType offset = this->GetOffset(i);
+    m_NeighborOffsets[i] = 0;
+    for (unsigned int d = 0; d < Dimension; ++d)
+    {
+      m_NeighborOffsets[i] += offset[d] * offsetTable[d];
+    }
+  }
+
+  this->GoToBegin();
+}
+
+
+template <typename TImage>
+void
+ConstInteriorNeighborhoodIterator<TImage>::GoToBegin()
+{
+  m_LinePosition.Fill(0);
+  m_IsAtEnd = (m_Image == nullptr || m_Region.GetNumberOfPixels() == 0);
+  if (!m_IsAtEnd)
+  {
+    m_BeginOfLine = m_Image->GetBufferPointer() + m_Image->ComputeOffset(m_Region.GetIndex());
+    m_Center = m_BeginOfLine;
+    m_EndOfLine = m_BeginOfLine + m_Region.GetSize(0);
+  }
+}
+
+
+template <typename TImage>
+void
+ConstInteriorNeighborhoodIterator<TImage>::NextLine()
+{
+  const OffsetValueType * offsetTable = m_Image->GetOffsetTable();
+  for (unsigned int d = 1; d < Dimension; ++d)
+  {
+    if (++m_LinePosition[d] < m_Region.GetSize(d))
+    {
+      m_BeginOfLine += offsetTable[d];
+      m_Center = m_BeginOfLine;
+      m_EndOfLine = m_BeginOfLine + m_Region.GetSize(0);
+      return;
+    }
+    // Back to the first line along this axis.
+    m_LinePosition[d] = 0;
+    m_BeginOfLine -= static_cast<OffsetValueType>(m_Region.GetSize(d) - 1) * offsetTable[d];
+  }
+  m_IsAtEnd = true;
+}
+
+
+template <typename TImage>
+auto
+ConstInteriorNeighborhoodIterator<TImage>::GetOffset(NeighborIndexType i) const -> OffsetType
+{
+  OffsetType offset;
+  for (unsigned int d = 0; d < Dimension; ++d)
+  {
+    const auto diameter = static_cast<NeighborIndexType>(2 * m_Radius[d] + 1);
+    offset[d] = static_cast<OffsetValueType>((i / m_Strides[d]) % diameter) - static_cast<OffsetValueType>(m_Radius[d]);
+  }
+  return offset;
+}
+
+
+template <typename TImage>
+auto
+ConstInteriorNeighborhoodIterator<TImage>::GetIndex() const -> IndexType
+{
+  IndexType index = m_Region.GetIndex();
+  index[0] += m_Center - m_BeginOfLine;
+  for (unsigned int d = 1; d < Dimension; ++d)
+  {
+    index[d] += static_cast<IndexValueType>(m_LinePosition[d]);
+  }
+  return index;
+}
+} // end namespace itk
+
+#endif
@@ -137,7 +137,7 @@ DataObjectDecorator<T>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
 
-  os << indent << "Component: " << m_Component << std::endl;
+  itkPrintSelfObjectMacro(Component);
 }
 } // end namespace itk
 
@@ -0,0 +1,48 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGlobalState_h
+#define itkGlobalState_h
+
+#include "ITKCommonExport.h"
+
+namespace itk
+{
+
+/** Returns whether the environment variable of the specified name is ON,
+ * TRUE, YES or 1, in any case, or defaultValue when it is not set. Used to
+ * initialize the process-wide settings of ITK from the environment. */
+ITKCommon_EXPORT bool
+GetBooleanEnvironmentVariable(const char * name, bool defaultValue = false);
+
+/** Returns the process-wide instance of TState, default-constructed by the
+ * first call.
+ *
+ * The instance is intentionally never destroyed: the images and filters held
+ * by static objects may still use it while the globals are destroyed at
+ * program exit. Its memory is reclaimed by the operating system. */
+template <typename TState>
+TState &
+GetNeverDestroyedInstance()
+{
+  static auto * const instance = new TState;
+  return *instance;
+}
+
+} // end namespace itk
+
+#endif
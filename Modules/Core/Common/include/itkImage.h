@@ -185,7 +185,12 @@ public:
 
 
   /** Allocate the image memory. The size of the image must
-   * already be set, e.g. by calling SetRegions(). */
+   * already be set, e.g. by calling SetRegions().
+   *
+   * When NUMAPolicy::GetGlobalDefaultFirstTouch() is enabled, large buffers
+   * of trivially constructible pixels are first touched (and initialized, if
+   * requested) in parallel, with the partition used by ParallelizeImageRegion.
+   * \sa NUMAPolicy */
   void
   Allocate(bool initializePixels = false) override;
 
@@ -194,6 +199,13 @@ public:
   void
   Initialize() override;
 
+  /** Called by the source of the image once its data has been generated.
+   * When the RedundantInitializationChecker is enabled, and the buffer was
+   * zero-initialized by Allocate(true), reports the source if it has
+   * overwritten every pixel. */
+  void
+  DataHasBeenGenerated() override;
+
   /** Fill the image buffer with a value.  Be sure to call Allocate()
    * first. */
   void
@@ -258,6 +270,16 @@ public:
     return m_Buffer ? m_Buffer->GetBufferPointer() : nullptr;
   }
 
+  /** Return the alignment of the buffer pointer in bytes, that is, the
+   * largest power of two dividing its address, or zero when the image has no
+   * buffer. Kernels may use it to select aligned vector loads and stores.
+   * \sa ImageBufferAllocator */
+  size_t
+  GetBufferAlignment() const
+  {
+    return ImageBufferAllocator::GetPointerAlignment(this->GetBufferPointer());
+  }
+
   /** Return a pointer to the container. */
   PixelContainer *
   GetPixelContainer()
@@ -320,6 +342,23 @@ public:
   unsigned int
   GetNumberOfComponentsPerPixel() const override;
 
+  SizeValueType
+  GetNumberOfBytesPerPixel() const override
+  {
+    return sizeof(PixelType);
+  }
+
+  using Superclass::GetBufferBytes;
+  const void *
+  GetBufferBytes() const override
+  {
+    if constexpr (std::is_trivially_copyable_v<PixelType>)
+    {
+      return this->GetBufferPointer();
+    }
+    return nullptr;
+  }
+
   /** Returns (image1 == image2).
    * \note `operator==` and `operator!=` are defined as function templates
    * (rather than as non-templates), just to allow template instantiation of
@@ -392,8 +431,24 @@ protected:
   using Superclass::Graft;
 
 private:
+  /** Writes to the newly allocated buffer from the threads of a multi-threader,
+   * so that its memory pages are placed on their NUMA nodes. Pixels are
+   * value-initialized if initializePixels is true, otherwise only one byte
+   * per memory page is written. */
+  void
+  FirstTouchBuffer(bool initializePixels);
+
+  /** Whether every pixel is non-zero, which tells that the zero-initialization
+   * of the buffer was useless. See RedundantInitializationChecker. */
+  bool
+  IsInitializationRedundant() const;
+
   /** Memory for the current buffer. */
   PixelContainerPointer m_Buffer{ PixelContainer::New() };
+
+  /** Whether the buffer was zero-initialized while the
+   * RedundantInitializationChecker was enabled. */
+  bool m_CheckInitialization{ false };
 };
 } // end namespace itk
 
@@ -29,7 +29,11 @@
 #define itkImage_hxx
 
 #include "itkProcessObject.h"
+#include "itkMultiThreaderBase.h"
+#include "itkNUMAPolicy.h"
+#include "itkRedundantInitializationChecker.h"
 #include <algorithm>
+#include <type_traits>
 
 namespace itk
 {
@@ -43,10 +47,67 @@ Image<TPixel, VImageDimension>::Allocate(bool initializePixels)
   this->ComputeOffsetTable();
   num = static_cast<SizeValueType>(this->GetOffsetTable()[VImageDimension]);
 
+  m_CheckInitialization = initializePixels && RedundantInitializationChecker::GetEnabled();
+
+  if constexpr (std::is_trivially_default_constructible_v<TPixel>)
+  {
+    if (num > m_Buffer->Capacity() && NUMAPolicy::UseFirstTouch(num * sizeof(TPixel)))
+    {
+      // Allocate without touching the memory pages, the threads do it. The
+      // previous pixels are released first, rather than copied by Reserve(),
+      // as FirstTouchBuffer() overwrites them anyway.
+      m_Buffer->Initialize();
+      m_Buffer->Reserve(num, false);
+      this->FirstTouchBuffer(initializePixels);
+      return;
+    }
+  }
   m_Buffer->Reserve(num, initializePixels);
 }
 
 
+template <typename TPixel, unsigned int VImageDimension>
+void
+Image<TPixel, VImageDimension>::FirstTouchBuffer(bool initializePixels)
+{
+  constexpr SizeValueType pageSize = 4096; // touching more often than once per page is harmless
+
+  TPixel * const buffer = m_Buffer->GetBufferPointer();
+  const auto     firstTouch = [this, buffer, initializePixels](const RegionType & region) {
+    const SizeValueType lineLength = region.GetSize(0);
+    const SizeValueType numberOfLines = (lineLength > 0) ? region.GetNumberOfPixels() / lineLength : 0;
+    for (SizeValueType line = 0; line < numberOfLines; ++line)
+    {
+      IndexType     lineIndex = region.GetIndex();
+      SizeValueType remainder = line;
+      for (unsigned int d = 1; d < VImageDimension; ++d)
+      {
+        lineIndex[d] += static_cast<IndexValueType>(remainder % region.GetSize(d));
+        remainder /= region.GetSize(d);
+      }
+      TPixel * const lineBegin = buffer + this->ComputeOffset(lineIndex);
+      if (initializePixels)
+      {
+        std::fill_n(lineBegin, lineLength, TPixel());
+      }
+      else
+      {
+        auto * const        bytes = reinterpret_cast<unsigned char *>(lineBegin);
+        const SizeValueType numberOfBytes = lineLength * sizeof(TPixel);
+        for (SizeValueType i = 0; i < numberOfBytes; i += pageSize)
+        {
+          bytes[i] = 0;
+        }
+        bytes[numberOfBytes - 1] = 0;
+      }
+    }
+  };
+
+  const MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->template ParallelizeImageRegion<VImageDimension>(this->GetBufferedRegion(), firstTouch, nullptr);
+}
+
+
 template <typename TPixel, unsigned int VImageDimension>
 void
 Image<TPixel, VImageDimension>::Initialize()
@@ -63,6 +124,53 @@ Image<TPixel, VImageDimension>::Initialize()
   // since the same container can be shared by multiple images (e.g.
   // Grafted outputs and in place filters).
   m_Buffer = PixelContainer::New();
+  m_CheckInitialization = false;
+}
+
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+Image<TPixel, VImageDimension>::DataHasBeenGenerated()
+{
+  if (m_CheckInitialization)
+  {
+    m_CheckInitialization = false;
+    if (this->IsInitializationRedundant())
+    {
+      const SmartPointer<ProcessObject> source = this->GetSource();
+      RedundantInitializationChecker::Report(source ? source->GetNameOfClass() : this->GetNameOfClass(),
+                                             m_Buffer->Size() * sizeof(TPixel));
+    }
+  }
+  Superclass::DataHasBeenGenerated();
+}
+
+
+template <typename TPixel, unsigned int VImageDimension>
+bool
+Image<TPixel, VImageDimension>::IsInitializationRedundant() const
+{
+  if constexpr (std::is_trivially_destructible_v<TPixel>)
+  {
+    const SizeValueType numberOfPixels = m_Buffer->Size();
+    if (numberOfPixels == 0)
+    {
+      return false;
+    }
+    const auto * bytes = reinterpret_cast<const unsigned char *>(m_Buffer->GetBufferPointer());
+    for (SizeValueType i = 0; i < numberOfPixels; ++i, bytes += sizeof(TPixel))
+    {
+      if (std::all_of(bytes, bytes + sizeof(TPixel), [](const unsigned char byte) { return byte == 0; }))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  else
+  {
+    return false;
+  }
 }
 
 
@@ -83,6 +191,7 @@ Image<TPixel, VImageDimension>::SetPixelContainer(PixelContainer * container)
   if (m_Buffer != container)
   {
     m_Buffer = container;
+    m_CheckInitialization = false;
     this->Modified();
   }
 }
@@ -826,6 +826,26 @@ public:
   virtual void
   SetNumberOfComponentsPerPixel(unsigned int);
 
+  /** Returns the number of bytes of a pixel in the buffer of the image.
+   * The ImageBase implementation returns 0, like the images which do not
+   * own a pixel buffer. Used to project the memory of a pipeline.
+   * \sa PipelinePlanner */
+  virtual SizeValueType
+  GetNumberOfBytesPerPixel() const;
+
+  /** Returns the pixel buffer of the image, of GetNumberOfBytesPerPixel()
+   * bytes per pixel of the buffered region, when its pixels can be copied
+   * as bytes. The ImageBase implementation returns nullptr. Used to hash
+   * and to copy images without knowing their pixel type.
+   * \sa PipelineResultCache */
+  virtual const void *
+  GetBufferBytes() const;
+  void *
+  GetBufferBytes()
+  {
+    return const_cast<void *>(static_cast<const ImageBase *>(this)->GetBufferBytes());
+  }
+
 protected:
   ImageBase() = default;
   ~ImageBase() override = default;
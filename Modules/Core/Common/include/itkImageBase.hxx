@@ -509,6 +509,24 @@ ImageBase<VImageDimension>::SetNumberOfComponentsPerPixel(unsigned int)
 }
 
 
+template <unsigned int VImageDimension>
+auto
+ImageBase<VImageDimension>::GetNumberOfBytesPerPixel() const -> SizeValueType
+{
+  // no pixel buffer
+  return 0;
+}
+
+
+template <unsigned int VImageDimension>
+const void *
+ImageBase<VImageDimension>::GetBufferBytes() const
+{
+  // no pixel buffer
+  return nullptr;
+}
+
+
 template <unsigned int VImageDimension>
 void
 ImageBase<VImageDimension>::PrintSelf(std::ostream & os, Indent indent) const
@@ -0,0 +1,151 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferAllocator_h
+#define itkImageBufferAllocator_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include "itkSingletonMacro.h"
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace itk
+{
+
+/** \class ImageBufferAllocatorEnums
+ *
+ * \brief enums for ImageBufferAllocator
+ *
+ * \ingroup ITKCommon
+ */
+class ImageBufferAllocatorEnums
+{
+public:
+  /** \class Policy
+   * \ingroup ITKCommon
+   * How the pixel buffers of the images are allocated.
+   */
+  enum class Policy : int8_t
+  {
+    /** Array new expression, buffers are aligned for the element type only. */
+    Default = 0,
+    /** Buffers aligned on ImageBufferAllocator::CacheLineAlignment bytes. */
+    Aligned,
+    /** Large buffers aligned on huge page boundaries, and advised to be
+     * backed by transparent huge pages where supported. */
+    HugePage,
+    /** Anonymous memory mappings, which are zero-filled on demand by the
+     * operating system, and returned to it as soon as they are released. */
+    MemoryMapped,
+    Unknown = -1
+  };
+};
+using ImageBufferAllocationPolicyEnum = ImageBufferAllocatorEnums::Policy;
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const ImageBufferAllocatorEnums::Policy value);
+
+struct ImageBufferAllocatorGlobals;
+
+/** \class ImageBufferAllocator
+ * \brief Allocates the raw memory of image pixel buffers according to an
+ * allocation policy.
+ *
+ * ImportImageContainer uses this class to allocate the buffers of images
+ * when a policy other than Default is selected, either globally with
+ * SetGlobalDefaultPolicy(), or for the buffers of one element type with
+ * ImportImageContainer::SetDefaultAllocationPolicy().
+ *
+ * The buffers are allocated with the size class of their size (see
+ * ImageBufferPool::GetSizeClass()), and are recycled by the ImageBufferPool
+ * when it is enabled.
+ *
+ * Aligned buffers let vectorized kernels use aligned loads and stores.
+ * Huge pages reduce the number of TLB misses when traversing multi-gigabyte
+ * volumes. Memory mapped buffers avoid zeroing the memory twice, and do not
+ * fragment the heap.
+ *
+ * The initial global default is taken from the
+ * ITK_IMAGE_BUFFER_ALLOCATION_POLICY environment variable, which may be
+ * DEFAULT, ALIGNED, HUGEPAGE or MEMORYMAPPED.
+ *
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageBufferAllocator
+{
+public:
+  using PolicyEnum = ImageBufferAllocationPolicyEnum;
+
+  /** Alignment of the Aligned buffers, in bytes. It is the size of a cache
+   * line, and of the widest vector registers. */
+  static constexpr size_t CacheLineAlignment = 64;
+
+  /** Size of the huge pages used by the HugePage policy, in bytes. Buffers
+   * smaller than a huge page are only cache line aligned. */
+  static constexpr size_t HugePageSize = size_t{ 2 } << 20;
+
+  /** Set/Get the policy used for the image buffers of all the element types
+   * which do not have their own policy. */
+  static void
+  SetGlobalDefaultPolicy(PolicyEnum policy);
+  static PolicyEnum
+  GetGlobalDefaultPolicy();
+
+  /** Convert a string (DEFAULT, ALIGNED, HUGEPAGE or MEMORYMAPPED, case
+   * insensitive) to the policy it names, or Unknown. */
+  static PolicyEnum
+  PolicyFromString(std::string policyString);
+
+  /** Minimum alignment, in bytes, of the buffers of the given size allocated
+   * with the given policy. For the Default policy, this is the alignment
+   * guaranteed by the array new expression for any element type. */
+  static size_t
+  GetAlignment(PolicyEnum policy, size_t numberOfBytes);
+
+  /** Alignment of a pointer, that is, the largest power of two dividing its
+   * address, or zero for a null pointer. */
+  static size_t
+  GetPointerAlignment(const void * pointer);
+
+  /** Allocate memory with the given policy, which must not be Default. The
+   * memory is zero-filled if initializeToZero is true, which is cheap for
+   * memory mapped buffers that do not come from the pool. Throws a
+   * MemoryAllocationError on failure. */
+  static void *
+  Allocate(size_t numberOfBytes, PolicyEnum policy, bool initializeToZero = false);
+
+  /** Release memory obtained with Allocate(), with the same size and policy.
+   * The memory is kept by the ImageBufferPool when it is enabled. */
+  static void
+  Deallocate(void * pointer, size_t numberOfBytes, PolicyEnum policy);
+
+  /** Return memory of the given size class to the operating system, bypassing
+   * the pool. Used by ImageBufferPool. */
+  static void
+  Free(void * pointer, size_t sizeClass, PolicyEnum policy);
+
+private:
+  itkGetGlobalDeclarationMacro(ImageBufferAllocatorGlobals, PimplGlobals);
+  static ImageBufferAllocatorGlobals * m_PimplGlobals;
+};
+
+} // end namespace itk
+
+#endif
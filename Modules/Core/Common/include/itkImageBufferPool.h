@@ -0,0 +1,133 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferPool_h
+#define itkImageBufferPool_h
+
+#include "itkImageBufferAllocator.h"
+#include <ostream>
+
+namespace itk
+{
+
+/** \class ImageBufferPool
+ * \brief Keeps released image buffers for reuse by later allocations.
+ *
+ * A pipeline which is executed repeatedly, or whose filters release their
+ * outputs with ProcessObject::ReleaseDataFlag, allocates and frees buffers
+ * of the same sizes over and over. Each fresh buffer costs a system call, a
+ * page fault per page, and zeroing by the operating system. When the pool
+ * is enabled, the buffers released by ImageBufferAllocator are kept instead,
+ * and handed out again to allocations of the same size class and policy.
+ *
+ * Buffer sizes are rounded up to size classes, eight per power of two, so
+ * that buffers of slightly different sizes can be reused for each other at
+ * the cost of at most 12.5% of unused memory.
+ *
+ * The pool holds at most MaximumNumberOfBytes bytes; the least recently
+ * released buffers are freed first when the limit is reached. Buffers
+ * smaller than MinimumNumberOfBytes are not pooled, as the heap already
+ * recycles them efficiently.
+ *
+ * The pool is disabled by default. Its initial state is taken from the
+ * ITK_IMAGE_BUFFER_POOL environment variable. While the pool is enabled,
+ * the buffers of the element types using the Default allocation policy are
+ * allocated with the Aligned policy, as the array new expression cannot be
+ * pooled. All the methods are thread safe.
+ *
+ * \sa ImageBufferAllocator
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageBufferPool
+{
+public:
+  using PolicyEnum = ImageBufferAllocationPolicyEnum;
+
+  /** Counters describing the use of the pool. */
+  struct Statistics
+  {
+    /** Number of allocations served by a pooled buffer. */
+    SizeValueType NumberOfHits{};
+    /** Number of allocations which found no pooled buffer. */
+    SizeValueType NumberOfMisses{};
+    /** Number of pooled buffers freed to respect the memory limit. */
+    SizeValueType NumberOfEvictions{};
+    /** Number of buffers currently held by the pool. */
+    SizeValueType NumberOfBuffers{};
+    /** Number of bytes currently held by the pool. */
+    SizeValueType NumberOfBytes{};
+    /** Largest number of bytes held by the pool since the last reset. */
+    SizeValueType PeakNumberOfBytes{};
+  };
+
+  /** Set/Get whether released buffers are pooled. Disabling the pool frees
+   * the buffers it holds. */
+  static void
+  SetEnabled(bool enabled);
+  static bool
+  GetEnabled();
+
+  /** Set/Get the maximum number of bytes held by the pool. Default is 1 GiB. */
+  static void
+  SetMaximumNumberOfBytes(SizeValueType numberOfBytes);
+  static SizeValueType
+  GetMaximumNumberOfBytes();
+
+  /** Set/Get the size below which buffers are not pooled. Default is 64 KiB. */
+  static void
+  SetMinimumNumberOfBytes(SizeValueType numberOfBytes);
+  static SizeValueType
+  GetMinimumNumberOfBytes();
+
+  /** Frees all the pooled buffers. */
+  static void
+  Clear();
+
+  /** Get a snapshot of the counters. */
+  static Statistics
+  GetStatistics();
+
+  /** Resets the hit, miss and eviction counters, and the peak number of bytes. */
+  static void
+  ResetStatistics();
+
+  /** Returns the size class of a buffer, that is, its size rounded up to the
+   * nearest of eight steps per power of two. Buffers are always allocated
+   * with the size of their class, so that they can be pooled even if the pool
+   * is enabled after their allocation. */
+  static size_t
+  GetSizeClass(size_t numberOfBytes);
+
+  /** Takes a pooled buffer of the given size class and policy, or returns
+   * nullptr. Used by ImageBufferAllocator. */
+  static void *
+  Acquire(size_t sizeClass, PolicyEnum policy);
+
+  /** Offers a buffer to the pool. Returns false if the buffer is not pooled,
+   * in which case the caller has to free it. Used by ImageBufferAllocator. */
+  static bool
+  Release(void * pointer, size_t sizeClass, PolicyEnum policy);
+};
+
+/** Print the statistics of the image buffer pool. */
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const ImageBufferPool::Statistics & statistics);
+
+} // end namespace itk
+
+#endif
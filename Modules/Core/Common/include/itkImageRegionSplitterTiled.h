@@ -0,0 +1,136 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageRegionSplitterTiled_h
+#define itkImageRegionSplitterTiled_h
+
+#include "itkImageRegionSplitterBase.h"
+#include "itkNumericTraits.h"
+#include <vector>
+
+namespace itk
+{
+
+/** \class ImageRegionSplitterTiled
+ * \brief Divide an image region into cache sized tiles.
+ *
+ * The other splitters divide a region into as many pieces as there are
+ * work units, so that with a 3D volume each work unit processes a slab of
+ * whole slices. A neighborhood filter then reads several slices of its
+ * input for every output slice, which does not fit in the cache of the
+ * core for large volumes, and the same input lines are fetched from memory
+ * several times.
+ *
+ * ImageRegionSplitterTiled divides the region into tiles (bricks in 3D) of
+ * about TileNumberOfPixels pixels, the default being sized to keep the
+ * tiles of an input and an output of 4 byte pixels, with their neighbors,
+ * in a 256 KiB L2 cache. The tiles extend at least 64 pixels along the
+ * first dimension, when the region allows it, so that the lines are
+ * streamed from memory, and are close to cubic along the other dimensions.
+ * The extent along some dimensions may be fixed with SetTileSize().
+ *
+ * To balance the load between the threads, the region is divided into at
+ * least NumberOfTilesPerWorkUnit tiles per requested work unit: the tiles
+ * are halved along their largest automatic dimension until there are
+ * enough of them. Therefore, unlike the other splitters, GetNumberOfSplits()
+ * usually returns more pieces than requested. The multi-threaders process
+ * the extra pieces as they become free, so that the splitter is meant for
+ * MultiThreaderBase::ParallelizeImageRegion(), that is, for filters using
+ * dynamic multi-threading. It is selected per filter with
+ * MultiThreaderBase::SetImageRegionSplitter():
+ *
+ * \code
+ * filter->GetMultiThreader()->SetImageRegionSplitter(ImageRegionSplitterTiled::New());
+ * \endcode
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageRegionSplitterTiled : public ImageRegionSplitterBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageRegionSplitterTiled);
+
+  /** Standard class type aliases. */
+  using Self = ImageRegionSplitterTiled;
+  using Superclass = ImageRegionSplitterBase;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(ImageRegionSplitterTiled);
+
+  /** Set/Get the number of pixels targeted for a tile. Default is 32768. */
+  itkSetClampMacro(TileNumberOfPixels, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(TileNumberOfPixels, SizeValueType);
+
+  /** Set/Get the minimum number of tiles per requested work unit, for load
+   * balancing. Default is 4. */
+  itkSetClampMacro(NumberOfTilesPerWorkUnit, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfTilesPerWorkUnit, unsigned int);
+
+  /** Set/Get the extent of the tiles along each dimension. A zero extent, or
+   * a missing one, is computed from TileNumberOfPixels. The fixed extents
+   * are kept for load balancing. Empty by default. */
+  void
+  SetTileSize(const std::vector<SizeValueType> & tileSize);
+  const std::vector<SizeValueType> &
+  GetTileSize() const
+  {
+    return m_TileSize;
+  }
+
+protected:
+  ImageRegionSplitterTiled();
+
+  unsigned int
+  GetNumberOfSplitsInternal(unsigned int         dim,
+                            const IndexValueType regionIndex[],
+                            const SizeValueType  regionSize[],
+                            unsigned int         requestedNumber) const override;
+
+  unsigned int
+  GetSplitInternal(unsigned int   dim,
+                   unsigned int   i,
+                   unsigned int   numberOfPieces,
+                   IndexValueType regionIndex[],
+                   SizeValueType  regionSize[]) const override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Computes the extent of the tiles, which are made smaller until there
+   * are at least minimumNumberOfTiles tiles, or no automatic extent can be
+   * halved. Returns the number of tiles. */
+  SizeValueType
+  ComputeTileSize(unsigned int        dim,
+                  const SizeValueType regionSize[],
+                  SizeValueType       minimumNumberOfTiles,
+                  SizeValueType       tileSize[]) const;
+
+  SizeValueType              m_TileNumberOfPixels{ 32768 };
+  unsigned int               m_NumberOfTilesPerWorkUnit{ 4 };
+  std::vector<SizeValueType> m_TileSize{};
+};
+} // end namespace itk
+
+#endif
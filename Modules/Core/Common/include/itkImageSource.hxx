@@ -286,6 +286,8 @@ ImageSource<TOutputImage>::ThreaderCallback(void * arg)
 
   if (workUnitID < total)
   {
+    PipelineTracer::Scope traceScope(str->Filter, "WorkUnit");
+    traceScope.SetRegion(splitRegion);
     str->Filter->ThreadedGenerateData(splitRegion, workUnitID);
 #if defined(ITKV4_COMPATIBILITY)
     if (str->Filter->GetAbortGenerateData())
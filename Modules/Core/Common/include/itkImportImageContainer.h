@@ -20,6 +20,8 @@
 
 #include "itkObject.h"
 #include "itkObjectFactory.h"
+#include "itkImageBufferPool.h"
+#include <atomic>
 #include <utility>
 
 namespace itk
@@ -36,6 +38,15 @@ namespace itk
  *
  * \tparam TElement The element type stored in the container.
  *
+ * The memory managed by the container is allocated according to an
+ * ImageBufferAllocationPolicyEnum: the global default of
+ * ImageBufferAllocator, unless a policy was set for the element type with
+ * SetDefaultAllocationPolicy(). Only buffers allocated with the Default
+ * policy may be released with delete[] by the application, after calling
+ * SetContainerManageMemory(false). While the ImageBufferPool is enabled,
+ * the Aligned policy is used instead of Default, so that released buffers
+ * can be recycled.
+ *
  * \ingroup ImageObjects
  * \ingroup IOFilters
  * \ingroup ITKCommon
@@ -57,6 +68,8 @@ public:
   using ElementIdentifier = TElementIdentifier;
   using Element = TElement;
 
+  using AllocationPolicyEnum = ImageBufferAllocationPolicyEnum;
+
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -107,6 +120,48 @@ public:
     return m_Size;
   }
 
+  /** Get the alignment of the buffer pointer in bytes, that is, the largest
+   * power of two dividing its address, or zero when there is no buffer.
+   * Kernels may use it to select aligned vector loads and stores. */
+  size_t
+  GetBufferAlignment() const
+  {
+    return ImageBufferAllocator::GetPointerAlignment(m_ImportPointer);
+  }
+
+  /** Get the allocation policy of the current buffer. It is Default when the
+   * buffer was provided by SetImportPointer(). */
+  AllocationPolicyEnum
+  GetBufferAllocationPolicy() const
+  {
+    return m_BufferAllocationPolicy;
+  }
+
+  /** Set/Get the allocation policy of the buffers allocated for this element
+   * type, overriding the global default of ImageBufferAllocator. This allows,
+   * for example, to use huge pages for the float images of a pipeline only.
+   * ResetDefaultAllocationPolicy() restores the use of the global default. */
+  static void
+  SetDefaultAllocationPolicy(AllocationPolicyEnum policy)
+  {
+    if (policy == AllocationPolicyEnum::Unknown)
+    {
+      itkGenericExceptionMacro("The image buffer allocation policy must not be Unknown");
+    }
+    m_DefaultAllocationPolicy = policy;
+  }
+  static void
+  ResetDefaultAllocationPolicy()
+  {
+    m_DefaultAllocationPolicy = AllocationPolicyEnum::Unknown;
+  }
+  static AllocationPolicyEnum
+  GetDefaultAllocationPolicy()
+  {
+    const AllocationPolicyEnum policy = m_DefaultAllocationPolicy;
+    return (policy == AllocationPolicyEnum::Unknown) ? ImageBufferAllocator::GetGlobalDefaultPolicy() : policy;
+  }
+
   /** Tell the container to allocate enough memory to allow at least
    * as many elements as the size given to be stored.  If new memory
    * needs to be allocated, the contents of the old buffer are copied
@@ -163,7 +218,8 @@ protected:
 
   /**
    * Allocates elements of the array.  If UseValueInitialization is true, then
-   * POD types will be zero-initialized.
+   * POD types will be zero-initialized. The elements are allocated according
+   * to GetDefaultAllocationPolicy().
    */
   virtual TElement *
   AllocateElements(ElementIdentifier size, bool UseValueInitialization = false) const;
@@ -198,10 +254,28 @@ protected:
   }
 
 private:
+  /** Calls AllocateElements(), and returns the policy with which the
+   * elements were allocated. */
+  TElement *
+  AllocateElementsWithPolicy(ElementIdentifier      size,
+                             bool                   UseValueInitialization,
+                             AllocationPolicyEnum & policy) const;
+
   TElement *         m_ImportPointer{};
   TElementIdentifier m_Size{};
   TElementIdentifier m_Capacity{};
   bool               m_ContainerManageMemory{ true };
+
+  // How m_ImportPointer was allocated, so that it is released accordingly.
+  AllocationPolicyEnum m_BufferAllocationPolicy{ AllocationPolicyEnum::Default };
+
+  // Policy of the elements last allocated by AllocateElements(). Overrides of
+  // AllocateElements() do not set it, their elements are considered to be
+  // allocated with new[], as they were before policies were introduced.
+  mutable AllocationPolicyEnum m_AllocatedElementsPolicy{ AllocationPolicyEnum::Default };
+
+  // Unknown when the element type uses the global default policy.
+  static inline std::atomic<AllocationPolicyEnum> m_DefaultAllocationPolicy{ AllocationPolicyEnum::Unknown };
 };
 } // end namespace itk
 
@@ -28,7 +28,11 @@
 #ifndef itkImportImageContainer_hxx
 #define itkImportImageContainer_hxx
 
+#include "itkPipelineMemoryAccounting.h"
+#include "itkPipelineTracer.h"
 #include <algorithm> // For copy_n.
+#include <memory>    // For uninitialized_value_construct_n and destroy_n.
+#include <type_traits>
 
 namespace itk
 {
@@ -53,13 +57,15 @@ ImportImageContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier si
   {
     if (size > m_Capacity)
     {
-      TElement * temp = this->AllocateElements(size, UseValueInitialization);
+      AllocationPolicyEnum policy;
+      TElement *           temp = this->AllocateElementsWithPolicy(size, UseValueInitialization, policy);
       // only copy the portion of the data used in the old buffer
       std::copy_n(m_ImportPointer, m_Size, temp);
 
       DeallocateManagedMemory();
 
       m_ImportPointer = temp;
+      m_BufferAllocationPolicy = policy;
       m_ContainerManageMemory = true;
       m_Capacity = size;
       m_Size = size;
@@ -73,7 +79,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier si
   }
   else
   {
-    m_ImportPointer = this->AllocateElements(size, UseValueInitialization);
+    m_ImportPointer = this->AllocateElementsWithPolicy(size, UseValueInitialization, m_BufferAllocationPolicy);
     m_Capacity = size;
     m_Size = size;
     m_ContainerManageMemory = true;
@@ -94,12 +100,14 @@ ImportImageContainer<TElementIdentifier, TElement>::Squeeze()
     if (m_Size < m_Capacity)
     {
       const TElementIdentifier size = m_Size;
-      TElement *               temp = this->AllocateElements(size, false);
+      AllocationPolicyEnum     policy;
+      TElement *               temp = this->AllocateElementsWithPolicy(size, false, policy);
       std::copy_n(m_ImportPointer, m_Size, temp);
 
       DeallocateManagedMemory();
 
       m_ImportPointer = temp;
+      m_BufferAllocationPolicy = policy;
       m_ContainerManageMemory = true;
       m_Capacity = size;
       m_Size = size;
@@ -155,7 +163,45 @@ TElement *
 ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIdentifier size,
                                                                      bool              UseValueInitialization) const
 {
-  TElement * data;
+  AllocationPolicyEnum policy = GetDefaultAllocationPolicy();
+  TElement *           data;
+
+  PipelineTracer::AddNumberOfBytesAllocated(size * sizeof(TElement));
+
+  if (policy == AllocationPolicyEnum::Default && ImageBufferPool::GetEnabled())
+  {
+    // Buffers allocated with new[] cannot be pooled.
+    policy = AllocationPolicyEnum::Aligned;
+  }
+
+  if (policy != AllocationPolicyEnum::Default)
+  {
+    // The allocator zero-fills the buffers of trivial types, which avoids
+    // touching the pages of fresh memory mappings. Throws a
+    // MemoryAllocationError on failure.
+    constexpr bool isTrivial = std::is_trivially_default_constructible_v<TElement>;
+    data = static_cast<TElement *>(
+      ImageBufferAllocator::Allocate(size * sizeof(TElement), policy, isTrivial && UseValueInitialization));
+    try
+    {
+      if (!UseValueInitialization)
+      {
+        std::uninitialized_default_construct_n(data, size);
+      }
+      else if (!isTrivial)
+      {
+        std::uninitialized_value_construct_n(data, size);
+      }
+    }
+    catch (...)
+    {
+      ImageBufferAllocator::Deallocate(data, size * sizeof(TElement), policy);
+      throw;
+    }
+    m_AllocatedElementsPolicy = policy;
+    PipelineMemoryAccounting::RecordAllocation(data, size * sizeof(TElement));
+    return data;
+  }
 
   try
   {
@@ -178,6 +224,21 @@ ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIden
     // of memory.  Do not use the exception macro.
     throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
   }
+  m_AllocatedElementsPolicy = AllocationPolicyEnum::Default;
+  PipelineMemoryAccounting::RecordAllocation(data, size * sizeof(TElement));
+  return data;
+}
+
+template <typename TElementIdentifier, typename TElement>
+TElement *
+ImportImageContainer<TElementIdentifier, TElement>::AllocateElementsWithPolicy(
+  ElementIdentifier      size,
+  bool                   UseValueInitialization,
+  AllocationPolicyEnum & policy) const
+{
+  m_AllocatedElementsPolicy = AllocationPolicyEnum::Default;
+  TElement * const data = this->AllocateElements(size, UseValueInitialization);
+  policy = m_AllocatedElementsPolicy;
   return data;
 }
 
@@ -188,8 +249,18 @@ ImportImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
   // Encapsulate all image memory deallocation here
   if (m_ContainerManageMemory)
   {
-    delete[] m_ImportPointer;
+    PipelineMemoryAccounting::RecordDeallocation(m_ImportPointer);
+    if (m_BufferAllocationPolicy == AllocationPolicyEnum::Default)
+    {
+      delete[] m_ImportPointer;
+    }
+    else if (m_ImportPointer)
+    {
+      std::destroy_n(m_ImportPointer, m_Capacity);
+      ImageBufferAllocator::Deallocate(m_ImportPointer, m_Capacity * sizeof(TElement), m_BufferAllocationPolicy);
+    }
   }
+  m_BufferAllocationPolicy = AllocationPolicyEnum::Default;
   m_ImportPointer = nullptr;
   m_Capacity = 0;
   m_Size = 0;
@@ -205,6 +276,7 @@ ImportImageContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream & os,
   os << indent << "Container manages memory: " << (m_ContainerManageMemory ? "true" : "false") << std::endl;
   os << indent << "Size: " << m_Size << std::endl;
   os << indent << "Capacity: " << m_Capacity << std::endl;
+  os << indent << "Buffer allocation policy: " << m_BufferAllocationPolicy << std::endl;
 }
 } // end namespace itk
 
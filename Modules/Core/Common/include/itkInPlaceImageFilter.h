@@ -125,6 +125,24 @@ public:
   virtual bool
   CanRunInPlace() const;
 
+  /** Forward the type independent in-place control of ProcessObject to
+   * CanRunInPlace() and to the InPlace flag. */
+  bool
+  SupportsInPlaceExecution() const override
+  {
+    return this->CanRunInPlace();
+  }
+  void
+  SetInPlaceExecution(bool inPlace) override
+  {
+    this->SetInPlace(inPlace);
+  }
+  bool
+  GetInPlaceExecution() const override
+  {
+    return this->GetInPlace();
+  }
+
 protected:
   InPlaceImageFilter() = default;
   ~InPlaceImageFilter() override = default;
@@ -0,0 +1,152 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedFile_h
+#define itkMemoryMappedFile_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace itk
+{
+
+/** \class MemoryMappedFileEnums
+ *
+ * \brief enums for MemoryMappedFile
+ *
+ * \ingroup ITKCommon
+ */
+class MemoryMappedFileEnums
+{
+public:
+  /** \class Mode
+   * \ingroup ITKCommon
+   * How a file is mapped into memory.
+   */
+  enum class Mode : uint8_t
+  {
+    /** The mapped memory may only be read. */
+    ReadOnly = 0,
+    /** The mapped memory may be modified, but the modifications are private
+     * to the process, and are never written to the file. */
+    CopyOnWrite,
+    /** The modifications of the mapped memory are written to the file, which
+     * is created or enlarged if needed. */
+    ReadWrite
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const MemoryMappedFileEnums::Mode value);
+
+/** \class MemoryMappedFile
+ * \brief Maps a range of bytes of a file into memory.
+ *
+ * The pages of the range are read from the file on demand, when they are
+ * first accessed, and may be evicted by the operating system under memory
+ * pressure, which allows to process files larger than the physical memory.
+ *
+ * The range does not need to start on a page boundary: the mapping starts
+ * at the enclosing page boundary, and GetPointer() returns the address of
+ * the first byte of the range. The mapping is released by Unmap(), or when
+ * the object is destroyed. Errors are reported by throwing an
+ * ExceptionObject.
+ *
+ * \sa MemoryMappedImageContainer
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT MemoryMappedFile
+{
+public:
+  using ModeEnum = MemoryMappedFileEnums::Mode;
+
+  MemoryMappedFile() = default;
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile &) = delete;
+  MemoryMappedFile &
+  operator=(const MemoryMappedFile &) = delete;
+
+  /** Map numberOfBytes bytes of the file, starting at the given offset. Any
+   * previous mapping is released first. In ReadOnly and CopyOnWrite modes,
+   * the range must lie within the file. */
+  void
+  Map(const std::string & fileName, SizeValueType offset, SizeValueType numberOfBytes, ModeEnum mode);
+
+  /** Release the mapping. Does nothing if there is none. */
+  void
+  Unmap();
+
+  /** Write the modified pages of a ReadWrite mapping to the file. */
+  void
+  Flush();
+
+  /** Address of the first byte of the mapped range, or nullptr. */
+  void *
+  GetPointer() const
+  {
+    return m_Pointer;
+  }
+
+  /** Number of bytes of the mapped range. */
+  SizeValueType
+  GetNumberOfBytes() const
+  {
+    return m_NumberOfBytes;
+  }
+
+  bool
+  IsMapped() const
+  {
+    return m_Pointer != nullptr;
+  }
+
+  const std::string &
+  GetFileName() const
+  {
+    return m_FileName;
+  }
+
+  ModeEnum
+  GetMode() const
+  {
+    return m_Mode;
+  }
+
+  /** Granularity of the mapping offsets of the operating system: the page
+   * size, or the allocation granularity on Windows. */
+  static SizeValueType
+  GetMappingGranularity();
+
+private:
+  std::string   m_FileName{};
+  ModeEnum      m_Mode{ ModeEnum::ReadOnly };
+  void *        m_Pointer{};
+  SizeValueType m_NumberOfBytes{};
+
+  // The mapping itself starts at the page boundary preceding m_Pointer.
+  void *        m_MappingPointer{};
+  SizeValueType m_MappingNumberOfBytes{};
+};
+
+} // end namespace itk
+
+#endif
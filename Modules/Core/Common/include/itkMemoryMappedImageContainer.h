@@ -0,0 +1,135 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedImageContainer_h
+#define itkMemoryMappedImageContainer_h
+
+#include "itkImportImageContainer.h"
+#include "itkMemoryMappedFile.h"
+#include <type_traits>
+
+namespace itk
+{
+
+/** \class MemoryMappedImageContainer
+ * \brief Image container whose elements are stored in a memory mapped file.
+ *
+ * The elements are the bytes of the mapped range of the file, in the byte
+ * order of the machine. The pages of the file are read lazily, when the
+ * pixels are first accessed, and may be dropped again by the operating
+ * system under memory pressure, so that images larger than the physical
+ * memory can be processed. The container can be used as the pixel
+ * container of an Image, with Image::SetPixelContainer().
+ *
+ * In ReadWrite mode, the file is created or enlarged as needed, and the
+ * pixels written to the container are stored in the file without any
+ * extra copy, which allows a filter to produce its output directly into a
+ * file: map the file into the pixel container of the output before
+ * updating the filter, with ReleaseDataBeforeUpdateFlag off, so that the
+ * container is kept when the output is allocated.
+ *
+ * Reserve() keeps the mapping when the requested size does not exceed the
+ * mapped number of elements. Otherwise, or after Squeeze(), the elements
+ * are copied to memory allocated as done by ImportImageContainer, and the
+ * file is unmapped.
+ *
+ * \sa MemoryMappedFile
+ * \sa ImageFileReader::SetUseMemoryMapping()
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template <typename TElementIdentifier, typename TElement>
+class ITK_TEMPLATE_EXPORT MemoryMappedImageContainer : public ImportImageContainer<TElementIdentifier, TElement>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MemoryMappedImageContainer);
+
+  /** Standard class type aliases. */
+  using Self = MemoryMappedImageContainer;
+  using Superclass = ImportImageContainer<TElementIdentifier, TElement>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Save the template parameters. */
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+  using ModeEnum = MemoryMappedFileEnums::Mode;
+
+  static_assert(std::is_trivially_destructible_v<TElement>,
+                "The elements of a mapped file are never constructed nor destroyed.");
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(MemoryMappedImageContainer);
+
+  /** Map numberOfElements elements stored in the file from the given byte
+   * offset. Any previous buffer of the container is released first. */
+  void
+  MapFile(const std::string & fileName, SizeValueType offset, ElementIdentifier numberOfElements, ModeEnum mode);
+
+  /** Unmap the file, and release the elements. In ReadWrite mode, the
+   * elements are written to the file. */
+  void
+  UnmapFile();
+
+  /** Write the modified elements to the file, in ReadWrite mode. */
+  void
+  Flush();
+
+  /** Whether the elements of the container are those of a mapped file. */
+  bool
+  IsMapped() const
+  {
+    return m_MappedFile.IsMapped();
+  }
+
+  const std::string &
+  GetFileName() const
+  {
+    return m_MappedFile.GetFileName();
+  }
+
+  ModeEnum
+  GetMode() const
+  {
+    return m_MappedFile.GetMode();
+  }
+
+protected:
+  MemoryMappedImageContainer() = default;
+  ~MemoryMappedImageContainer() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Unmaps the file, when the buffer of the container is the mapped one. */
+  void
+  DeallocateManagedMemory() override;
+
+private:
+  MemoryMappedFile m_MappedFile{};
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkMemoryMappedImageContainer.hxx"
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedImageContainer_hxx
+#define itkMemoryMappedImageContainer_hxx
+
+
+namespace itk
+{
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedImageContainer<TElementIdentifier, TElement>::MapFile(const std::string & fileName,
+                                                                  SizeValueType       offset,
+                                                                  ElementIdentifier   numberOfElements,
+                                                                  ModeEnum            mode)
+{
+  // Release the previous buffer before mapping, to limit the address space
+  // and the memory used at once.
+  this->Initialize();
+
+  m_MappedFile.Map(fileName, offset, static_cast<SizeValueType>(numberOfElements) * sizeof(TElement), mode);
+
+  // The superclass does not release the memory of the mapping, see
+  // DeallocateManagedMemory().
+  this->SetImportPointer(static_cast<TElement *>(m_MappedFile.GetPointer()));
+  this->SetCapacity(numberOfElements);
+  this->SetSize(numberOfElements);
+  this->SetContainerManageMemory(false);
+  this->Modified();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedImageContainer<TElementIdentifier, TElement>::UnmapFile()
+{
+  if (m_MappedFile.IsMapped())
+  {
+    this->Initialize();
+  }
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedImageContainer<TElementIdentifier, TElement>::Flush()
+{
+  m_MappedFile.Flush();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
+{
+  // The container does not manage the memory of the mapping, so that the
+  // superclass only resets the buffer.
+  Superclass::DeallocateManagedMemory();
+  m_MappedFile.Unmap();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedImageContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "Mapped: " << (m_MappedFile.IsMapped() ? "true" : "false") << std::endl;
+  if (m_MappedFile.IsMapped())
+  {
+    os << indent << "FileName: " << m_MappedFile.GetFileName() << std::endl;
+    os << indent << "Mode: " << m_MappedFile.GetMode() << std::endl;
+  }
+}
+} // end namespace itk
+
+#endif
@@ -34,6 +34,8 @@
 #include "itkIntTypes.h"
 #include "itkImageRegion.h"
 #include "itkImageIORegion.h"
+#include "itkImageRegionSplitterBase.h"
+#include "itkPipelineTracer.h"
 #include "itkSingletonMacro.h"
 #include <atomic>
 #include <functional>
@@ -139,6 +141,14 @@ public:
   SetUpdateProgress(bool updates);
   itkGetConstMacro(UpdateProgress, bool);
 
+  /** Set/Get the splitter which divides the region given to
+   * ParallelizeImageRegion() into pieces. When it is not set (the default),
+   * the global default splitter of ImageSourceCommon is used. The splitter may
+   * return more pieces than work units, as ImageRegionSplitterTiled does: the
+   * pieces are then distributed between the work units as they become free. */
+  itkSetConstObjectMacro(ImageRegionSplitter, ImageRegionSplitterBase);
+  itkGetConstObjectMacro(ImageRegionSplitter, ImageRegionSplitterBase);
+
   /** Set/Get the maximum number of threads to use when multithreading.  It
    * will be clamped to the range [ 1, ITK_MAX_THREADS ] because several arrays
    * are already statically allocated using the ITK_MAX_THREADS number.
@@ -343,13 +353,15 @@ ITK_GCC_PRAGMA_DIAG_POP()
       VDimension,
       requestedRegion.GetIndex().m_InternalArray,
       requestedRegion.GetSize().m_InternalArray,
-      [&funcP](const IndexValueType index[], const SizeValueType size[]) {
+      [&funcP, filter](const IndexValueType index[], const SizeValueType size[]) {
         ImageRegion<VDimension> region;
         for (unsigned int d = 0; d < VDimension; ++d)
         {
           region.SetIndex(d, index[d]);
           region.SetSize(d, size[d]);
         }
+        PipelineTracer::Scope traceScope(filter, "WorkUnit");
+        traceScope.SetRegion(region);
         funcP(region);
       },
       filter);
@@ -391,7 +403,8 @@ ITK_GCC_PRAGMA_DIAG_POP()
         SplitDimension,
         splitIndex.m_InternalArray,
         splitSize.m_InternalArray,
-        [restrictedDirection, &requestedRegion, &funcP](const IndexValueType index[], const SizeValueType size[]) {
+        [restrictedDirection, &requestedRegion, &funcP, filter](const IndexValueType index[],
+                                                                const SizeValueType  size[]) {
           ImageRegion<VDimension> restrictedRequestedRegion;
           restrictedRequestedRegion.SetIndex(restrictedDirection, requestedRegion.GetIndex(restrictedDirection));
           restrictedRequestedRegion.SetSize(restrictedDirection, requestedRegion.GetSize(restrictedDirection));
@@ -404,6 +417,8 @@ ITK_GCC_PRAGMA_DIAG_POP()
               ++splitDimension;
             }
           }
+          PipelineTracer::Scope traceScope(filter, "WorkUnit");
+          traceScope.SetRegion(restrictedRequestedRegion);
           funcP(restrictedRequestedRegion);
         },
         filter);
@@ -443,11 +458,18 @@ protected:
     const IndexValueType * index;
     const SizeValueType *  size;
     ProcessObject *        filter;
+
+    const ImageRegionSplitterBase * splitter;
   };
 
   static ITK_THREAD_RETURN_FUNCTION_CALL_CONVENTION
   ParallelizeImageRegionHelper(void * arg);
 
+  /** Returns the splitter set by SetImageRegionSplitter(), or the global
+   * default splitter. */
+  const ImageRegionSplitterBase *
+  GetImageRegionSplitterOrDefault() const;
+
   /** The number of work units to create. */
   ThreadIdType m_NumberOfWorkUnits{};
 
@@ -487,6 +509,8 @@ private:
 
   std::atomic<bool> m_UpdateProgress{ true };
 
+  ImageRegionSplitterBase::ConstPointer m_ImageRegionSplitter{};
+
   static MultiThreaderBaseGlobals * m_PimplGlobals;
   /** Friends of Multithreader.
    * ProcessObject is a friend so that it can call PrintSelf() on its
@@ -0,0 +1,109 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkNUMAPolicy_h
+#define itkNUMAPolicy_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include "itkSingletonMacro.h"
+
+namespace itk
+{
+
+struct NUMAPolicyGlobals;
+
+/** \class NUMAPolicy
+ * \brief Global settings controlling the placement of image buffers and
+ * pool threads on Non-Uniform Memory Access (NUMA) machines.
+ *
+ * On NUMA machines, a memory page is physically allocated on the node of
+ * the thread which first writes to it. When a large image buffer is
+ * initialized by the thread calling Image::Allocate, the whole buffer ends
+ * up on one node, and half of the later multi-threaded accesses of a
+ * dual-socket machine go through the interconnect.
+ *
+ * When FirstTouch is enabled, Image::Allocate touches large buffers in
+ * parallel, using ParallelizeImageRegion and thereby the same region
+ * partition as multi-threaded filters, so that each part of the buffer is
+ * placed close to the threads which will process it.
+ *
+ * When ThreadPinning is enabled, the threads of the ThreadPool are bound
+ * to the CPUs of the NUMA nodes, in a round-robin fashion, so that they do
+ * not migrate away from the memory they touched.
+ *
+ * Both settings are disabled by default. Their initial values are taken
+ * from the ITK_NUMA_FIRST_TOUCH and ITK_NUMA_THREAD_PINNING environment
+ * variables. The node topology is only known on Linux, on other platforms
+ * the machine is considered to have a single node and pinning has no effect.
+ *
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT NUMAPolicy
+{
+public:
+  /** Set/Get whether large image buffers are first touched in parallel. */
+  static void
+  SetGlobalDefaultFirstTouch(bool firstTouch);
+  static bool
+  GetGlobalDefaultFirstTouch();
+
+  /** Set/Get the minimum size of a buffer, in bytes, for which parallel
+   * first touch is performed. Smaller buffers are initialized serially, as
+   * the cost of dispatching the work to the threads would outweigh the
+   * benefits. Default is 4 MiB. */
+  static void
+  SetGlobalDefaultFirstTouchMinimumNumberOfBytes(SizeValueType numberOfBytes);
+  static SizeValueType
+  GetGlobalDefaultFirstTouchMinimumNumberOfBytes();
+
+  /** Returns whether a buffer of the given size should be first touched in parallel. */
+  static bool
+  UseFirstTouch(SizeValueType numberOfBytes)
+  {
+    return GetGlobalDefaultFirstTouch() && numberOfBytes >= GetGlobalDefaultFirstTouchMinimumNumberOfBytes();
+  }
+
+  /** Set/Get whether the threads of the ThreadPool are pinned to NUMA nodes.
+   * The threads apply a change of this setting before executing their next job. */
+  static void
+  SetGlobalDefaultThreadPinning(bool threadPinning);
+  static bool
+  GetGlobalDefaultThreadPinning();
+
+  /** Number of NUMA nodes of the machine, at least one. */
+  static unsigned int
+  GetNumberOfNodes();
+
+  /** Restricts the calling thread to the CPUs of the given node (modulo the
+   * number of nodes). Returns false if the affinity could not be changed. */
+  static bool
+  PinCurrentThreadToNode(unsigned int node);
+
+  /** Allows the calling thread to run on all the CPUs of the process again. */
+  static bool
+  UnpinCurrentThread();
+
+private:
+  itkGetGlobalDeclarationMacro(NUMAPolicyGlobals, PimplGlobals);
+  static NUMAPolicyGlobals * m_PimplGlobals;
+};
+
+} // end namespace itk
+
+#endif
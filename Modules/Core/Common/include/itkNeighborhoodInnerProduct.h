@@ -19,6 +19,7 @@
 #define itkNeighborhoodInnerProduct_h
 
 #include "itkNeighborhoodIterator.h"
+#include "itkConstInteriorNeighborhoodIterator.h"
 #include "itkConstSliceIterator.h"
 #include "itkImageBoundaryCondition.h"
 
@@ -70,6 +71,13 @@ public:
           const unsigned int                        start = 0,
           const unsigned int                        stride = 1);
 
+  /** Same inner product, on the non-boundary region of the image. */
+  static OutputPixelType
+  Compute(const ConstInteriorNeighborhoodIterator<TImage> & it,
+          const OperatorType &                              op,
+          const unsigned int                                start = 0,
+          const unsigned int                                stride = 1);
+
   static OutputPixelType
   Compute(const NeighborhoodType & N,
           const OperatorType &     op,
@@ -89,6 +97,18 @@ public:
     return Self::Compute(it, op);
   }
 
+  OutputPixelType
+  operator()(const std::slice & s, const ConstInteriorNeighborhoodIterator<TImage> & it, const OperatorType & op) const
+  {
+    return Self::Compute(it, op, s.start(), s.stride());
+  }
+
+  OutputPixelType
+  operator()(const ConstInteriorNeighborhoodIterator<TImage> & it, const OperatorType & op) const
+  {
+    return Self::Compute(it, op);
+  }
+
   OutputPixelType
   operator()(const std::slice & s, const NeighborhoodType & N, const OperatorType & op) const
   {
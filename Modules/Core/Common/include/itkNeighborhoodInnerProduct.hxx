@@ -48,6 +48,35 @@ NeighborhoodInnerProduct<TImage, TOperator, TComputation>::Compute(const ConstNe
   return static_cast<OutputPixelType>(sum);
 }
 
+template <typename TImage, typename TOperator, typename TComputation>
+auto
+NeighborhoodInnerProduct<TImage, TOperator, TComputation>::Compute(const ConstInteriorNeighborhoodIterator<TImage> & it,
+                                                                   const OperatorType &                              op,
+                                                                   const unsigned int start,
+                                                                   const unsigned int stride) -> OutputPixelType
+{
+  using InputPixelType = typename TImage::PixelType;
+  using InputPixelRealType = typename NumericTraits<InputPixelType>::RealType;
+  using AccumulateRealType = typename NumericTraits<InputPixelRealType>::AccumulateType;
+
+  using OutputPixelValueType = typename NumericTraits<OutputPixelType>::ValueType;
+
+  const typename OperatorType::ConstIterator op_end = op.End();
+  typename OperatorType::ConstIterator       o_it = op.Begin();
+  AccumulateRealType                         sum{};
+
+  // The pixels are read at their offsets to the center, without any check.
+  const InputPixelType *  center = &it.GetCenterPixel();
+  const OffsetValueType * offsets = it.GetNeighborOffsets().data();
+  for (unsigned int i = start; o_it < op_end; i += stride, ++o_it)
+  {
+    sum += static_cast<AccumulateRealType>(static_cast<OutputPixelValueType>(*o_it) *
+                                           static_cast<InputPixelRealType>(center[offsets[i]]));
+  }
+
+  return static_cast<OutputPixelType>(sum);
+}
+
 template <typename TImage, typename TOperator, typename TComputation>
 auto
 NeighborhoodInnerProduct<TImage, TOperator, TComputation>::Compute(
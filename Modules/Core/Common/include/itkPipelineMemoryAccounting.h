@@ -0,0 +1,152 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelineMemoryAccounting_h
+#define itkPipelineMemoryAccounting_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace itk
+{
+class ProcessObject;
+
+/** \class PipelineMemoryAccounting
+ * \brief Attributes the image buffers to the filters which allocated them,
+ * and reports the live and peak memory of a pipeline.
+ *
+ * MemoryUsageObserver reports the memory of the whole process, which does
+ * not tell which filters drive the peak memory of a pipeline. When the
+ * accounting is enabled, each buffer allocated by ImportImageContainer
+ * while ProcessObject::UpdateOutputData() executes GenerateData() is
+ * attributed to the filter, usually to one of its outputs, until the buffer
+ * is released. The report gives for each filter the bytes it currently
+ * holds, its own peak, and the bytes it held when the pipeline reached its
+ * peak, so that the filters to stream, or whose outputs to release, can be
+ * identified. An output whose buffer was released, for example because its
+ * ReleaseDataFlag is set, holds no bytes any more; the others are retained.
+ *
+ * Buffers allocated outside of GenerateData(), or by the threads of the
+ * work units, are counted as unattributed. Buffers allocated before the
+ * accounting is enabled are ignored.
+ *
+ * The accounting is disabled by default. Its initial state is taken from
+ * the ITK_PIPELINE_MEMORY_ACCOUNTING environment variable. All the methods
+ * are thread safe.
+ *
+ * \code
+ * PipelineMemoryAccounting::SetEnabled(true);
+ * writer->Update();
+ * std::cout << PipelineMemoryAccounting::GetReport();
+ * \endcode
+ *
+ * \sa MemoryUsageObserver, PipelineTracer
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelineMemoryAccounting
+{
+public:
+  /** The memory attributed to a filter. */
+  struct ProcessObjectRecord
+  {
+    /** Class name of the filter, followed by its object name if any. */
+    std::string Name{};
+    /** ReleaseDataFlag of the filter at its last execution. */
+    bool ReleaseDataFlag{};
+    /** Whether the filter was destroyed. */
+    bool IsDestroyed{};
+    /** Number of executions of GenerateData(). */
+    SizeValueType NumberOfExecutions{};
+    /** Bytes of the buffers currently held. */
+    SizeValueType LiveNumberOfBytes{};
+    /** Largest LiveNumberOfBytes. */
+    SizeValueType PeakNumberOfBytes{};
+    /** LiveNumberOfBytes when the pipeline reached its peak. */
+    SizeValueType NumberOfBytesAtPipelinePeak{};
+    /** Bytes of all the buffers allocated. */
+    SizeValueType AllocatedNumberOfBytes{};
+  };
+
+  /** The memory of the pipeline. */
+  struct Report
+  {
+    SizeValueType LiveNumberOfBytes{};
+    SizeValueType PeakNumberOfBytes{};
+    /** The bytes which are not attributed to a filter. */
+    SizeValueType UnattributedLiveNumberOfBytes{};
+    SizeValueType UnattributedNumberOfBytesAtPipelinePeak{};
+    /** In the order of the first execution of the filters. */
+    std::vector<ProcessObjectRecord> ProcessObjects{};
+  };
+
+  /** \class OwnerScope
+   * \brief Attributes the buffers allocated by the calling thread to a
+   * filter, from its construction to its destruction.
+   * \ingroup ITKCommon
+   */
+  class ITKCommon_EXPORT OwnerScope
+  {
+  public:
+    explicit OwnerScope(const ProcessObject * filter);
+    ~OwnerScope();
+    OwnerScope(const OwnerScope &) = delete;
+    OwnerScope &
+    operator=(const OwnerScope &) = delete;
+
+  private:
+    bool   m_Active;
+    size_t m_PreviousOwner{};
+  };
+
+  /** Set/Get whether the buffers are accounted. */
+  static void
+  SetEnabled(bool enabled);
+  static bool
+  GetEnabled();
+
+  /** Forgets the filters and the buffers accounted so far. */
+  static void
+  Reset();
+
+  /** Get a snapshot of the accounting. */
+  static Report
+  GetReport();
+
+  /** Accounts the allocation and the release of a buffer. Used by
+   * ImportImageContainer. */
+  static void
+  RecordAllocation(const void * pointer, SizeValueType numberOfBytes);
+  static void
+  RecordDeallocation(const void * pointer);
+
+  /** Marks the record of a filter as destroyed. Used by ProcessObject. */
+  static void
+  ForgetProcessObject(const ProcessObject * filter);
+};
+
+/** Print the report as a table, from the filter holding the most bytes at
+ * the peak of the pipeline. */
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const PipelineMemoryAccounting::Report & report);
+
+} // end namespace itk
+
+#endif
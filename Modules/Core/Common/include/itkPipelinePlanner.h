@@ -0,0 +1,144 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelinePlanner_h
+#define itkPipelinePlanner_h
+
+#include "itkProcessObject.h"
+#include <string>
+#include <vector>
+
+namespace itk
+{
+/** \class PipelinePlanner
+ * \brief Enables the early release and the in-place execution of the
+ * intermediate data of a pipeline, and projects its peak memory.
+ *
+ * Keeping the memory of a pipeline down requires setting the
+ * ReleaseDataFlag of the intermediate outputs and the InPlace flag of the
+ * InPlaceImageFilter's, while making sure that no output which is used
+ * twice is released or overwritten: the filter producing it would be
+ * executed again. The planner does it for the pipeline upstream of the
+ * sinks, i.e. of the filters whose outputs are requested, before their
+ * update.
+ *
+ * Plan() walks the pipeline from the sinks, in the order of the execution
+ * of the filters, and counts the consumers of each data object. A data
+ * object is released after its use when it has a source, is consumed once,
+ * is not an output of a sink, and is not referenced outside of the
+ * pipeline, i.e. its reference count is not larger than the references of
+ * its source and of its consumer. In that case, its ReleaseDataFlag is set,
+ * and its consumer is executed in place if the data object is its primary
+ * input and the filter supports it. The in-place execution of the other
+ * filters is disabled, as it would overwrite data which is still needed.
+ * The ReleaseDataFlag of the other data objects is left unchanged.
+ *
+ * The peak memory is projected before and after planning, from the size of
+ * the largest possible regions of the images, by replaying the execution
+ * of the filters. It is an upper bound for streamed pipelines. A released
+ * output is regenerated when its consumer is executed again, for example
+ * after the modification of a filter downstream of it.
+ *
+ * \code
+ * auto planner = PipelinePlanner::New();
+ * planner->AddSink(writer);
+ * planner->Update();
+ * std::cout << planner->GetProjectedPeakNumberOfBytes() << std::endl;
+ * \endcode
+ *
+ * \sa PipelineMemoryAccounting, InPlaceImageFilter
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelinePlanner : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(PipelinePlanner);
+
+  /** Standard class type aliases. */
+  using Self = PipelinePlanner;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(PipelinePlanner);
+
+  /** The plan of a data object of the pipeline. */
+  struct DataObjectPlan
+  {
+    /** The name of the source and of the output, or the class name of a
+     * data object without source. */
+    std::string Name{};
+    /** The number of inputs of the filters of the pipeline which use it. */
+    SizeValueType NumberOfConsumers{};
+    /** Projected size of the bulk data. */
+    SizeValueType NumberOfBytes{};
+    /** Whether it is released after its use. */
+    bool ReleaseData{};
+    /** Whether its bulk data is reused in place by its consumer. */
+    bool ConsumedInPlace{};
+  };
+
+  /** Add a filter whose outputs are requested. */
+  void
+  AddSink(ProcessObject * sink);
+
+  /** Remove the sinks, and forget the plan. */
+  void
+  ClearSinks();
+
+  /** Set the flags of the pipeline upstream of the sinks, and project its
+   * peak memory. Updates the output information of the sinks. */
+  void
+  Plan();
+
+  /** Plan() then update the sinks. */
+  void
+  Update();
+
+  /** The data objects of the pipeline, in the order of their first use. */
+  const std::vector<DataObjectPlan> &
+  GetDataObjectPlans() const
+  {
+    return m_DataObjectPlans;
+  }
+
+  /** The peak memory projected by the last Plan(), with the flags it set,
+   * and with the flags it found. */
+  itkGetConstMacro(ProjectedPeakNumberOfBytes, SizeValueType);
+  itkGetConstMacro(ProjectedPeakNumberOfBytesBeforePlanning, SizeValueType);
+
+protected:
+  PipelinePlanner() = default;
+  ~PipelinePlanner() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  std::vector<ProcessObject::Pointer> m_Sinks{};
+  std::vector<DataObjectPlan>         m_DataObjectPlans{};
+  SizeValueType                       m_ProjectedPeakNumberOfBytes{};
+  SizeValueType                       m_ProjectedPeakNumberOfBytesBeforePlanning{};
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,137 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelineResultCache_h
+#define itkPipelineResultCache_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include <ostream>
+#include <string>
+
+namespace itk
+{
+class ProcessObject;
+
+/** \class PipelineResultCache
+ * \brief Reuses the outputs of the filters executed before on the same
+ * inputs with the same parameters.
+ *
+ * When the UseResultCache flag of a ProcessObject is set, the key of its
+ * execution is computed before GenerateData(), by hashing:
+ * - the class of the filter and its parameters, as written at full
+ *   precision by ProcessObject::PrintResultCacheParameters();
+ * - the type, the geometry and the pixels of its input images, and the
+ *   content of its decorated inputs, printed at full precision;
+ * - the requested regions of its output images.
+ *
+ * When the key is cached, the outputs are restored from the cache instead
+ * of executing GenerateData(). Otherwise, the outputs are copied to the
+ * cache after GenerateData(). The cache keeps the most recently used
+ * outputs in memory, up to MaximumNumberOfBytes, and, when a directory is
+ * set, also writes them to that directory, where they can be found by
+ * other processes. The directory is never pruned.
+ *
+ * Only the filters which opt in, by overriding
+ * ProcessObject::CanUseResultCache(), are cached. Their inputs must be
+ * images or decorators, and their outputs images of trivially copyable
+ * pixels. The other filters, like the filters with decorated outputs or
+ * the filters which compute other results than their outputs, are executed
+ * normally and counted as Uncacheable.
+ *
+ * The entries read from the directory are checked against the outputs
+ * before their pixels are copied. The entries which are truncated, corrupt
+ * or do not match are counted as Misses and removed.
+ *
+ * The in-memory cache is limited to 1 GiB by default. The directory is
+ * initialized from the ITK_PIPELINE_RESULT_CACHE_DIRECTORY environment
+ * variable. All the methods are thread safe.
+ *
+ * \code
+ * PipelineResultCache::SetDirectory("/var/cache/itk");
+ * smoother->UseResultCacheOn();
+ * writer->Update();
+ * std::cout << PipelineResultCache::GetStatistics() << std::endl;
+ * \endcode
+ *
+ * \sa ProcessObject::SetUseResultCache
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelineResultCache
+{
+public:
+  /** The activity of the cache since the last Clear(). */
+  struct Statistics
+  {
+    /** Executions restored from the cache, including from the directory. */
+    SizeValueType Hits{};
+    SizeValueType DirectoryHits{};
+    SizeValueType Misses{};
+    /** Executions of filters which cannot be cached. */
+    SizeValueType Uncacheable{};
+    /** Entries removed from memory to respect MaximumNumberOfBytes. */
+    SizeValueType Evictions{};
+    SizeValueType NumberOfEntries{};
+    SizeValueType NumberOfBytes{};
+  };
+
+  /** Set/Get the maximum number of bytes of the outputs kept in memory. */
+  static void
+  SetMaximumNumberOfBytes(SizeValueType numberOfBytes);
+  static SizeValueType
+  GetMaximumNumberOfBytes();
+
+  /** Set/Get the directory where the outputs are written, or an empty
+   * string to keep them in memory only. */
+  static void
+  SetDirectory(const std::string & directory);
+  static std::string
+  GetDirectory();
+
+  /** Get the activity of the cache. */
+  static Statistics
+  GetStatistics();
+
+  /** Remove the entries kept in memory and reset the statistics. The
+   * directory is left unchanged. */
+  static void
+  Clear();
+
+  /** Compute the key of the execution of the filter, or an empty string
+   * when it cannot be cached. */
+  static std::string
+  ComputeKey(ProcessObject * filter);
+
+  /** Restore the outputs of the filter from the cache. Returns false, and
+   * leaves the outputs unchanged, when the key is not cached. Used by
+   * ProcessObject. */
+  static bool
+  Restore(ProcessObject * filter, const std::string & key);
+
+  /** Copy the outputs of the filter to the cache. Used by ProcessObject. */
+  static void
+  Store(ProcessObject * filter, const std::string & key);
+};
+
+/** Print the statistics, like "Hits: 2, DirectoryHits: 0, ...". */
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const PipelineResultCache::Statistics & statistics);
+
+} // end namespace itk
+
+#endif
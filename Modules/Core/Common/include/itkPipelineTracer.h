@@ -0,0 +1,165 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelineTracer_h
+#define itkPipelineTracer_h
+
+#include "ITKCommonExport.h"
+#include "itkImageRegion.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace itk
+{
+class DataObject;
+class ProcessObject;
+
+/** \class PipelineTracer
+ * \brief Records the execution of the filters and of their work units, for
+ * display in a trace viewer.
+ *
+ * When the tracer is enabled, ProcessObject::UpdateOutputData() records an
+ * event for each execution of GenerateData(), and MultiThreaderBase and
+ * ImageSource record an event for each work unit of
+ * ParallelizeImageRegion() and of ThreadedGenerateData(). Each event holds
+ * the name of the filter, its start time and duration, the thread which
+ * executed it, the region it processed, and the number of bytes of image
+ * buffers allocated by this thread during the event.
+ *
+ * The events are exported with WriteChromeTrace() in the Trace Event
+ * format, which is displayed by chrome://tracing and https://ui.perfetto.dev,
+ * where the work units of a filter appear on the threads of the pool, nested
+ * below the filter which dispatched them.
+ *
+ * The tracer is disabled by default, and then costs a single flag test per
+ * filter execution, per work unit and per buffer allocation. When the
+ * ITK_PIPELINE_TRACE environment variable is set to a file name, the tracer
+ * is enabled, and the trace is written to this file at the exit of the
+ * program. At most MaximumNumberOfEvents events are kept; the later ones are
+ * counted but dropped. All the methods are thread safe.
+ *
+ * \sa TimeProbe, ResourceProbesCollectorBase
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelineTracer
+{
+public:
+  /** A recorded execution. Times are in microseconds since the first use of
+   * the tracer. */
+  struct Event
+  {
+    /** Class name of the filter, followed by its object name if any. */
+    std::string Name{};
+    /** "Filter" or "WorkUnit". */
+    std::string Category{};
+    double      StartTime{};
+    double      Duration{};
+    /** Small sequential number of the thread, starting at 1. */
+    unsigned int ThreadId{};
+    /** The requested region of the filter, or the region of the work unit. */
+    std::string Region{};
+    /** Bytes of image buffers allocated by the thread during the event. */
+    SizeValueType NumberOfBytesAllocated{};
+  };
+
+  /** \class Scope
+   * \brief Records an event from its construction to its destruction, when
+   * the tracer is enabled at its construction.
+   * \ingroup ITKCommon
+   */
+  class ITKCommon_EXPORT Scope
+  {
+  public:
+    Scope(const ProcessObject * filter, const char * category);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &
+    operator=(const Scope &) = delete;
+
+    bool
+    IsActive() const
+    {
+      return m_Active;
+    }
+
+    template <unsigned int VDimension>
+    void
+    SetRegion(const ImageRegion<VDimension> & region)
+    {
+      if (m_Active)
+      {
+        m_Event.Region = PipelineTracer::RegionToString(VDimension, region.GetIndex().data(), region.GetSize().data());
+      }
+    }
+
+    /** Sets the region of the event to the requested region of an image. */
+    void
+    SetRequestedRegion(const DataObject * output);
+
+  private:
+    bool          m_Active;
+    SizeValueType m_NumberOfBytesAllocatedAtStart{};
+    Event         m_Event{};
+  };
+
+  /** Set/Get whether the events are recorded. */
+  static void
+  SetEnabled(bool enabled);
+  static bool
+  GetEnabled();
+
+  /** Set/Get the maximum number of events kept. Default is 1000000. */
+  static void
+  SetMaximumNumberOfEvents(SizeValueType numberOfEvents);
+  static SizeValueType
+  GetMaximumNumberOfEvents();
+
+  /** Get a copy of the recorded events, in the order of their end. */
+  static std::vector<Event>
+  GetEvents();
+
+  /** Number of events dropped since the last Clear(), because
+   * MaximumNumberOfEvents were already recorded. */
+  static SizeValueType
+  GetNumberOfDroppedEvents();
+
+  /** Discards the recorded events. */
+  static void
+  Clear();
+
+  /** Writes the recorded events as a JSON trace in the Chrome Trace Event
+   * format. The file version throws an ExceptionObject when the file
+   * cannot be written. */
+  static void
+  WriteChromeTrace(std::ostream & os);
+  static void
+  WriteChromeTrace(const std::string & fileName);
+
+  /** Counts an allocation of an image buffer by the calling thread, when the
+   * tracer is enabled. Used by ImportImageContainer. */
+  static void
+  AddNumberOfBytesAllocated(SizeValueType numberOfBytes);
+
+  /** Formats a region as "[index] [size]". */
+  static std::string
+  RegionToString(unsigned int dimension, const IndexValueType index[], const SizeValueType size[]);
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPixelSpan_h
+#define itkPixelSpan_h
+
+#include "itkIndexRange.h"
+#include "itkSIMDPixelTransform.h"
+#include <type_traits>
+
+namespace itk
+{
+/** \class PixelSpan
+ * \brief A view of contiguous pixels in the buffer of an image, such as a
+ * line of the image, or the whole buffer.
+ *
+ * It has the interface of the std::span of C++20 that the filters need: the
+ * pixels may be accessed by a range-based for loop, by operator[], or by
+ * data() and size(). TPixel is const for the pixels of an input image.
+ *
+ * \sa ForEachPixelSpan
+ * \ingroup ITKCommon
+ */
+template <typename TPixel>
+class PixelSpan
+{
+public:
+  using element_type = TPixel;
+  using value_type = std::remove_cv_t<TPixel>;
+  using size_type = SizeValueType;
+  using pointer = TPixel *;
+  using reference = TPixel &;
+  using iterator = TPixel *;
+
+  constexpr PixelSpan() noexcept = default;
+
+  constexpr PixelSpan(TPixel * const data, const SizeValueType size) noexcept
+    : m_Data(data)
+    , m_Size(size)
+  {}
+
+  constexpr pointer
+  data() const noexcept
+  {
+    return m_Data;
+  }
+
+  constexpr size_type
+  size() const noexcept
+  {
+    return m_Size;
+  }
+
+  constexpr bool
+  empty() const noexcept
+  {
+    return m_Size == 0;
+  }
+
+  constexpr iterator
+  begin() const noexcept
+  {
+    return m_Data;
+  }
+
+  constexpr iterator
+  end() const noexcept
+  {
+    return m_Data + m_Size;
+  }
+
+  constexpr reference
+  operator[](const size_type i) const noexcept
+  {
+    return m_Data[i];
+  }
+
+private:
+  TPixel *      m_Data{ nullptr };
+  SizeValueType m_Size{ 0 };
+};
+
+template <typename TPixel>
+PixelSpan(TPixel *, SizeValueType) -> PixelSpan<TPixel>;
+
+/** Calls function(span...) with one PixelSpan per image, over the pixels of
+ * the region in the buffers of the images. When the region is contiguous in
+ * all the buffers, as when it is their buffered region, or a part of it split
+ * along the last dimension, the function is called once with all the pixels.
+ * Otherwise it is called for each line of the region. The spans of a call
+ * have the same size, and correspond pixel by pixel.
+ *
+ * The images must have a HasPixelArrayBuffer, so filters which also accept a
+ * VectorImage or an ImageAdaptor select it with "if constexpr", and keep
+ * their iterators otherwise:
+ *
+   \code
+   if constexpr (HasPixelArrayBuffer<TInputImage> && HasPixelArrayBuffer<TOutputImage>)
+   {
+     ForEachPixelSpan(
+       region,
+       [](PixelSpan<const InputPixelType> input, PixelSpan<OutputPixelType> output) {
+         for (SizeValueType i = 0; i < output.size(); ++i)
+         {
+           output[i] = f(input[i]);
+         }
+       },
+       inputImage,
+       outputImage);
+   }
+   \endcode
+ *
+ * \sa PixelSpan
+ * \ingroup ITKCommon
+ */
+template <unsigned int VDimension, typename TFunction, typename... TImages>
+void
+ForEachPixelSpan(const ImageRegion<VDimension> & region, TFunction && function, TImages *... images)
+{
+  static_assert(sizeof...(TImages) > 0, "ForEachPixelSpan needs at least one image.");
+  static_assert((HasPixelArrayBuffer<std::remove_const_t<TImages>> && ...),
+                "The buffers of the images must be arrays of their pixels.");
+  static_assert(((TImages::ImageDimension == VDimension) && ...),
+                "The images must have the dimension of the region.");
+
+  if (region.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+  if ((IsContiguousInBuffer(region, images->GetBufferedRegion()) && ...))
+  {
+    const SizeValueType numberOfPixels = region.GetNumberOfPixels();
+    function(PixelSpan(images->GetBufferPointer() + images->ComputeOffset(region.GetIndex()), numberOfPixels)...);
+    return;
+  }
+
+  const SizeValueType     lineLength = region.GetSize(0);
+  ImageRegion<VDimension> lineStarts = region;
+  lineStarts.SetSize(0, 1);
+  for (const auto & index : ImageRegionIndexRange<VDimension>(lineStarts))
+  {
+    function(PixelSpan(images->GetBufferPointer() + images->ComputeOffset(index), lineLength)...);
+  }
+}
+} // end namespace itk
+
+#endif
@@ -0,0 +1,94 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPixelwiseFusionStage_h
+#define itkPixelwiseFusionStage_h
+
+#include "itkImage.h"
+#include <type_traits>
+
+namespace itk
+{
+
+/** \class PixelwiseFusionStage
+ * \brief Interface of the filters which can be fused into a single pass.
+ *
+ * A filter implementing this interface computes each output pixel from the
+ * input pixel at the same index only, and its output has the region and
+ * the information of its input. FusedPixelwiseImageFilter recognizes a
+ * chain of such filters and applies their operations one after the other
+ * to small chunks of pixels, without the intermediate images.
+ *
+ * The fused filter calls BeforeFusedTransformPixels() on each stage, then
+ * FusedTransformPixels() concurrently from several threads, then
+ * AfterFusedTransformPixels(). The output of the stage is never allocated,
+ * nor its input buffer read outside of FusedTransformPixels(), so a filter
+ * whose BeforeThreadedGenerateData() reads its input image, like
+ * RescaleIntensityImageFilter, must return false from CanFusePixelwise().
+ * GenerateData() is not called either, so a filter must configure its
+ * operation in BeforeThreadedGenerateData(), as BinaryNotImageFilter does.
+ *
+ * \sa FusedPixelwiseImageFilter
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PixelwiseFusionStage
+{
+public:
+  virtual ~PixelwiseFusionStage();
+
+  /** Returns whether the filter can currently be fused. */
+  virtual bool
+  CanFusePixelwise() const = 0;
+
+  /** Size in bytes of the input and the output pixels. */
+  virtual size_t
+  GetFusionInputPixelSize() const = 0;
+  virtual size_t
+  GetFusionOutputPixelSize() const = 0;
+
+  /** Prepares the operation, as BeforeThreadedGenerateData() does. */
+  virtual void
+  BeforeFusedTransformPixels() = 0;
+
+  /** Computes numberOfPixels output pixels from as many contiguous input
+   * pixels. The pointers point to the pixel types of the input and the output
+   * images of the filter. Called concurrently by several threads. */
+  virtual void
+  FusedTransformPixels(const void * input, void * output, SizeValueType numberOfPixels) = 0;
+
+  /** Completes the operation, as AfterThreadedGenerateData() does. */
+  virtual void
+  AfterFusedTransformPixels() = 0;
+
+  /** Whether the pixel operation between these image types may be fused: the
+   * images are itk::Image instances of the same dimension, with pixels which
+   * may be stored in raw buffers. */
+  template <typename TInputImage, typename TOutputImage>
+  static constexpr bool
+  IsFusable()
+  {
+    using InputPixelType = typename TInputImage::PixelType;
+    using OutputPixelType = typename TOutputImage::PixelType;
+    return std::is_same_v<TInputImage, Image<InputPixelType, TInputImage::ImageDimension>> &&
+           std::is_same_v<TOutputImage, Image<OutputPixelType, TOutputImage::ImageDimension>> &&
+           TInputImage::ImageDimension == TOutputImage::ImageDimension &&
+           std::is_trivially_copyable_v<InputPixelType> && std::is_trivially_copyable_v<OutputPixelType>;
+  }
+};
+} // end namespace itk
+
+#endif
@@ -37,6 +37,13 @@ namespace itk
  * \brief A class for performing multithreaded execution with a thread
  * pool back end
  *
+ * Parallel sections may be nested, e.g. when the DynamicThreadedGenerateData
+ * of a filter running in a pool thread calls ParallelizeImageRegion or
+ * updates another filter. A pool thread which waits for its work units to
+ * complete executes pending jobs of the pool meanwhile, instead of blocking.
+ * This way nested parallel sections neither deadlock when all the threads of
+ * the pool are waiting, nor require additional threads.
+ *
  * \ingroup OSSystemObjects
  *
  * \ingroup ITKCommon
@@ -107,6 +114,21 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** Processes the splitCount pieces of the region when the splitter returned
+   * more pieces than work units. */
+  void
+  ParallelizeImageRegionPieces(const ImageIORegion & region,
+                               ThreadIdType          splitCount,
+                               ThreadingFunctorType  funcP,
+                               ProcessObject *       filter);
+
+  /** Waits until the work unit associated with the future is completed,
+   * and rethrows its exception, if any. The progress of the filter is
+   * updated while waiting. Called from a pool thread, pending jobs of
+   * the pool are executed while waiting. */
+  void
+  WaitForWorkUnit(std::future<ITK_THREAD_RETURN_TYPE> & future, ProcessObject * filter);
+
   // Thread pool instance and factory
   ThreadPool::Pointer m_ThreadPool{};
 
@@ -490,6 +490,48 @@ public:
   itkGetConstReferenceMacro(ReleaseDataBeforeUpdateFlag, bool);
   itkBooleanMacro(ReleaseDataBeforeUpdateFlag);
 
+  /** Turn on/off the reuse of the outputs computed before for the same
+   * inputs and parameters. When on, GenerateData() is skipped if the
+   * outputs are found in the PipelineResultCache. Default value is off.
+   * \sa PipelineResultCache */
+  itkSetMacro(UseResultCache, bool);
+  itkGetConstReferenceMacro(UseResultCache, bool);
+  itkBooleanMacro(UseResultCache);
+
+  /** Whether the outputs of the filter can be restored from the
+   * PipelineResultCache. All the results of the filter must be its data
+   * object outputs, and all its parameters must be written by
+   * PrintResultCacheParameters(). The ProcessObject implementation returns
+   * false, so that UseResultCache has no effect on the filters which do not
+   * opt in. The filters which compute other results, like the threshold of
+   * HistogramThresholdImageFilter, must not opt in.
+   * \sa PipelineResultCache */
+  virtual bool
+  CanUseResultCache() const;
+
+  /** Write all the parameters which change the outputs of the filter, and
+   * none of the values computed by its executions, to the key of the
+   * PipelineResultCache. The stream is set to the full precision of double.
+   * The filters which override CanUseResultCache() override it too, and
+   * call the implementation of their superclass first, like PrintSelf().
+   * The ProcessObject implementation writes nothing. */
+  virtual void
+  PrintResultCacheParameters(std::ostream & os) const;
+
+  /** Whether the filter can reuse the bulk data of its primary input for
+   * its primary output, and whether it is allowed to do so. The
+   * ProcessObject implementation never runs in place. InPlaceImageFilter
+   * and InPlaceLabelMapFilter forward them to CanRunInPlace() and to their
+   * InPlace flag, so that the in-place execution can be controlled without
+   * knowing the type of the filter.
+   * \sa PipelinePlanner */
+  virtual bool
+  SupportsInPlaceExecution() const;
+  virtual void
+  SetInPlaceExecution(bool inPlace);
+  virtual bool
+  GetInPlaceExecution() const;
+
   /** Get/Set the number of work units to create when executing. */
   itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
   itkGetConstReferenceMacro(NumberOfWorkUnits, ThreadIdType);
@@ -981,6 +1023,8 @@ private:
   /** Memory management ivars */
   bool m_ReleaseDataBeforeUpdateFlag{};
 
+  bool m_UseResultCache{ false };
+
   /** Friends of ProcessObject */
   friend class DataObject;
 
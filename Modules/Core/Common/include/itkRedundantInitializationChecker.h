@@ -0,0 +1,89 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRedundantInitializationChecker_h
+#define itkRedundantInitializationChecker_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include <map>
+#include <string>
+
+namespace itk
+{
+
+/** \class RedundantInitializationChecker
+ * \brief Detects filters which zero their output buffer, and then overwrite every pixel.
+ *
+ * Image::Allocate(true), or AllocateInitialized(), writes the whole buffer
+ * once more than Allocate(). The extra pass is wasted when the filter then
+ * writes every pixel anyway, which costs a full write of the buffer, that is
+ * as much memory bandwidth as a simple pixel-wise filter.
+ *
+ * When the checker is enabled, an Image whose buffer was zero-initialized
+ * scans it when its source reports that the data has been generated
+ * (DataObject::DataHasBeenGenerated()). If no pixel is left with all its
+ * bytes zero, the initialization was not needed, and the class name of the
+ * source is reported: a warning is displayed the first time, and the number
+ * of buffers and bytes are accumulated in the records. Outputs keeping some
+ * zero pixels are not reported, as the zeros may come from the initialization.
+ *
+ * The check costs a read of every initialized output buffer, so that it is
+ * meant for debugging and tests. It is disabled by default, and its initial
+ * state is taken from the ITK_CHECK_REDUNDANT_INITIALIZATION environment
+ * variable. Only images whose pixels are trivially destructible are checked.
+ * All the methods are thread safe.
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT RedundantInitializationChecker
+{
+public:
+  /** What was reported for a source class. */
+  struct Record
+  {
+    /** Number of fully overwritten buffers. */
+    SizeValueType NumberOfBuffers{};
+    /** Number of bytes initialized in vain. */
+    SizeValueType NumberOfBytes{};
+  };
+
+  using RecordMapType = std::map<std::string, Record>;
+
+  /** Set/Get whether the zero-initialized image buffers are checked. */
+  static void
+  SetEnabled(bool enabled);
+  static bool
+  GetEnabled();
+
+  /** Reports a buffer of numberOfBytes bytes, zero-initialized and then
+   * fully overwritten by a source of class sourceName. Used by Image. */
+  static void
+  Report(const std::string & sourceName, SizeValueType numberOfBytes);
+
+  /** Get a snapshot of the records, by class name of the source. */
+  static RecordMapType
+  GetRecords();
+
+  /** Forgets the records, so that the warnings are displayed again. */
+  static void
+  Clear();
+};
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,162 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSIMDPixelTransform_h
+#define itkSIMDPixelTransform_h
+
+#include "itkDefaultPixelAccessor.h"
+#include "itkDefaultVectorPixelAccessor.h"
+#include "itkImageRegion.h"
+#include <type_traits>
+
+namespace itk
+{
+namespace Functor
+{
+/** \class IsSIMDVectorizable
+ * \brief Whether the functor is a plain arithmetic operation, which may be
+ * applied to blocks of pixels with SIMD instructions.
+ *
+ * The pixel-wise filters (UnaryFunctorImageFilter, UnaryGeneratorImageFilter
+ * and BinaryGeneratorImageFilter) apply such functors to the lines of their
+ * images with SIMDTransformPixels(), instead of one pixel at a time through
+ * their iterators. It is specialized next to Add2, Sub2, Mult, Abs, Sqrt and
+ * Clamp. Other functors may be added when their operator() is inline, has no
+ * side effect, and does not depend on the position of the pixel.
+ *
+ * \ingroup ITKCommon
+ */
+template <typename TFunctor>
+struct IsSIMDVectorizable : std::false_type
+{};
+} // namespace Functor
+
+namespace Details
+{
+template <typename TImage, typename = void>
+struct HasPixelArrayBuffer : std::false_type
+{};
+
+template <typename TImage>
+struct HasPixelArrayBuffer<TImage, std::void_t<typename TImage::AccessorType>>
+  : std::is_same<typename TImage::AccessorType, DefaultPixelAccessor<typename TImage::PixelType>>
+{};
+
+template <typename TImage, typename = void>
+struct HasVectorPixelArrayBuffer : std::false_type
+{};
+
+template <typename TImage>
+struct HasVectorPixelArrayBuffer<TImage,
+                                 std::void_t<typename TImage::AccessorType, typename TImage::InternalPixelType>>
+  : std::is_same<typename TImage::AccessorType, DefaultVectorPixelAccessor<typename TImage::InternalPixelType>>
+{};
+} // namespace Details
+
+/** Whether the buffer of the image is an array of its pixels, such as the
+ * buffer of an Image, so that each line of the image is a C array. It is
+ * not the case of the VectorImage and of the ImageAdaptor. */
+template <typename TImage>
+constexpr bool HasPixelArrayBuffer = Details::HasPixelArrayBuffer<TImage>::value;
+
+/** Whether the buffer of the image is an array of the components of its
+ * pixels, each pixel being GetNumberOfComponentsPerPixel() contiguous
+ * components, such as the buffer of a VectorImage. */
+template <typename TImage>
+constexpr bool HasVectorPixelArrayBuffer = Details::HasVectorPixelArrayBuffer<TImage>::value;
+
+/** Whether the pixels of the region follow each other in the buffer of an
+ * image whose buffered region is bufferedRegion: the region spans the whole
+ * buffered region in its first dimensions, and a single line, slice, ...
+ * in its last dimensions. */
+template <unsigned int VDimension>
+bool
+IsContiguousInBuffer(const ImageRegion<VDimension> & region, const ImageRegion<VDimension> & bufferedRegion)
+{
+  unsigned int d = 0;
+  while (d < VDimension && region.GetSize(d) == bufferedRegion.GetSize(d))
+  {
+    ++d;
+  }
+  // The dimension d may be partial, the following ones must be flat.
+  for (++d; d < VDimension; ++d)
+  {
+    if (region.GetSize(d) > 1)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Sets output[i] = functor(input[i]) for the numberOfPixels contiguous
+ * pixels. The loops are written for the vectorizer of the compiler: a
+ * single pointer when the pixels are transformed in place, and two
+ * pointers, which it checks for overlap once, otherwise. */
+template <typename TFunctor, typename TInputPixel, typename TOutputPixel>
+void
+SIMDTransformPixels(const TFunctor &    functor,
+                    const TInputPixel * input,
+                    TOutputPixel *      output,
+                    const SizeValueType numberOfPixels)
+{
+  if constexpr (std::is_same_v<TInputPixel, TOutputPixel>)
+  {
+    if (input == output)
+    {
+      for (SizeValueType i = 0; i < numberOfPixels; ++i)
+      {
+        output[i] = functor(output[i]);
+      }
+      return;
+    }
+  }
+  for (SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    output[i] = functor(input[i]);
+  }
+}
+
+/** Sets output[i] = functor(input1[i], input2[i]) for the numberOfPixels
+ * contiguous pixels, like the unary SIMDTransformPixels(). */
+template <typename TFunctor, typename TInputPixel1, typename TInputPixel2, typename TOutputPixel>
+void
+SIMDTransformPixels(const TFunctor &     functor,
+                    const TInputPixel1 * input1,
+                    const TInputPixel2 * input2,
+                    TOutputPixel *       output,
+                    const SizeValueType  numberOfPixels)
+{
+  if constexpr (std::is_same_v<TInputPixel1, TOutputPixel>)
+  {
+    if (input1 == output)
+    {
+      for (SizeValueType i = 0; i < numberOfPixels; ++i)
+      {
+        output[i] = functor(output[i], input2[i]);
+      }
+      return;
+    }
+  }
+  for (SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    output[i] = functor(input1[i], input2[i]);
+  }
+}
+} // end namespace itk
+
+#endif
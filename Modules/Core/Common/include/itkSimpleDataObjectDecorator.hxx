@@ -29,9 +29,22 @@
 #define itkSimpleDataObjectDecorator_hxx
 
 #include "itkMath.h"
+#include <type_traits>
 
 namespace itk
 {
+namespace Details
+{
+/** Whether objects of type T can be written to a std::ostream. */
+template <typename T, typename = void>
+struct IsPrintable : std::false_type
+{};
+template <typename T>
+struct IsPrintable<T, std::void_t<decltype(std::declval<std::ostream &>() << std::declval<const T &>())>>
+  : std::true_type
+{};
+} // namespace Details
+
 /**
  *
  */
@@ -62,6 +75,10 @@ SimpleDataObjectDecorator<T>::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "Component  : " << typeid(this->m_Component).name() << std::endl;
 #endif
   os << indent << "Initialized: " << this->m_Initialized << std::endl;
+  if constexpr (Details::IsPrintable<T>::value)
+  {
+    os << indent << "Value: " << this->m_Component << std::endl;
+  }
 }
 } // end namespace itk
 
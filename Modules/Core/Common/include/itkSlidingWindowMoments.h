@@ -0,0 +1,169 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSlidingWindowMoments_h
+#define itkSlidingWindowMoments_h
+
+#include "itkImage.h"
+#include "itkNumericTraits.h"
+#include <vector>
+
+namespace itk
+{
+/** \class SlidingWindowMoments
+ * \brief Sums, and sums of squares, of the pixels in the box neighborhoods of
+ * all the pixels of a region, in constant time per pixel.
+ *
+ * Compute() computes, for each pixel of the region, the sum of the pixels
+ * in the box of the given radius centered at the pixel, and optionally the sum
+ * of their squares. The pixels outside the buffered region of the image are
+ * the nearest pixels of the buffered region, as with the
+ * ZeroFluxNeumannBoundaryCondition of a ConstNeighborhoodIterator.
+ *
+ * Since such a box sum is separable, it is computed as a sequence of sums
+ * along each axis. Each of them is a running sum: it adds the pixel which
+ * enters the window, and subtracts the one which leaves it, so the cost per
+ * pixel does not depend on the radius. The sums along the axes 1 to
+ * Dimension - 1 are computed for whole lines of the region at once, which the
+ * compiler vectorizes.
+ *
+ * The sums are stored in the order of an ImageRegionConstIterator over the
+ * region, so that a filter reads them along with its output iterator:
+ *
+   \code
+   SlidingWindowMoments<InputImageType> moments;
+   moments.Compute(*input, outputRegionForThread, radius, true);
+   SizeValueType i = 0;
+   for (ImageRegionIterator<OutputImageType> it(output, outputRegionForThread); !it.IsAtEnd(); ++it, ++i)
+   {
+     it.Set(static_cast<OutputPixelType>(std::sqrt(moments.GetVariance(i))));
+   }
+   \endcode
+ *
+ * The sums are exact for integer pixels, as long as they are exactly
+ * represented by TRealType. For floating point pixels, they may differ from
+ * the sums of the pixels of each box by a few rounding errors.
+ *
+ * \tparam TImage    The type of the image.
+ * \tparam TRealType The type of the sums, which must support the arithmetic
+ * operators. Its default is the RealType of the pixels.
+ *
+ * \sa BoxMeanImageFilter, BoxSigmaImageFilter, which use an accumulated image.
+ * \ingroup ITKCommon
+ */
+template <typename TImage, typename TRealType = typename NumericTraits<typename TImage::PixelType>::RealType>
+class ITK_TEMPLATE_EXPORT SlidingWindowMoments
+{
+public:
+  /** Standard class type aliases. */
+  using Self = SlidingWindowMoments;
+
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  using ImageType = TImage;
+  using RealType = TRealType;
+  using RegionType = typename TImage::RegionType;
+  using SizeType = typename TImage::SizeType;
+  using RadiusType = SizeType;
+
+  /** Computes the sums of the boxes of the radius, centered at the pixels of
+   * the region, which must be inside the buffered region of the image. The
+   * sums of squares are computed when computeSumsOfSquares is true. */
+  void
+  Compute(const ImageType & image,
+          const RegionType & region,
+          const RadiusType & radius,
+          bool               computeSumsOfSquares = false);
+
+  /** The region and the radius of the last Compute(). */
+  const RegionType &
+  GetRegion() const
+  {
+    return m_Region;
+  }
+
+  const RadiusType &
+  GetRadius() const
+  {
+    return m_Radius;
+  }
+
+  /** The number of pixels of a box, including the pixels outside the
+   * buffered region. */
+  SizeValueType
+  GetNumberOfPixelsPerWindow() const
+  {
+    return m_NumberOfPixelsPerWindow;
+  }
+
+  /** The sums and the sums of squares of the boxes, in the order of the pixels
+   * of the region. The sums of squares are empty when they were not computed. */
+  const std::vector<RealType> &
+  GetSums() const
+  {
+    return m_Sums;
+  }
+
+  const std::vector<RealType> &
+  GetSumsOfSquares() const
+  {
+    return m_SumsOfSquares;
+  }
+
+  /** The mean of the box of pixel i of the region. */
+  RealType
+  GetMean(const SizeValueType i) const
+  {
+    return m_Sums[i] / static_cast<double>(m_NumberOfPixelsPerWindow);
+  }
+
+  /** The unbiased variance of the box of pixel i of the region, which needs
+   * the sums of squares. It is zero rather than a rounding error below zero,
+   * for a box of equal pixels. */
+  RealType
+  GetVariance(const SizeValueType i) const
+  {
+    const auto     num = static_cast<double>(m_NumberOfPixelsPerWindow);
+    const RealType variance = (m_SumsOfSquares[i] - (m_Sums[i] * m_Sums[i] / num)) / (num - 1.0);
+    return variance > RealType{} ? variance : RealType{};
+  }
+
+private:
+  /** Sets output to the sums along the axis of the boxes of the input, whose
+   * size is inputSize, in the region along the axis, and in the whole input
+   * along the other axes. */
+  void
+  SumAlongAxis(const std::vector<RealType> & input,
+               std::vector<RealType> &       output,
+               const SizeType &              inputSize,
+               unsigned int                  axis) const;
+
+  RegionType            m_Region{};
+  RadiusType            m_Radius{};
+  RegionType            m_BufferedRegion{};
+  RegionType            m_InputRegion{};
+  SizeValueType         m_NumberOfPixelsPerWindow{ 0 };
+  std::vector<RealType> m_Sums{};
+  std::vector<RealType> m_SumsOfSquares{};
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSlidingWindowMoments.hxx"
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSlidingWindowMoments_hxx
+#define itkSlidingWindowMoments_hxx
+
+#include "itkImageRegionConstIterator.h"
+#include <algorithm>
+
+namespace itk
+{
+template <typename TImage, typename TRealType>
+void
+SlidingWindowMoments<TImage, TRealType>::Compute(const ImageType &  image,
+                                                 const RegionType & region,
+                                                 const RadiusType & radius,
+                                                 const bool         computeSumsOfSquares)
+{
+  m_Region = region;
+  m_Radius = radius;
+  m_BufferedRegion = image.GetBufferedRegion();
+  m_NumberOfPixelsPerWindow = 1;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    m_NumberOfPixelsPerWindow *= 2 * radius[d] + 1;
+  }
+  m_Sums.clear();
+  m_SumsOfSquares.clear();
+
+  if (region.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+  if (!m_BufferedRegion.IsInside(region))
+  {
+    itkGenericExceptionMacro("The region " << region << " is not inside the buffered region " << m_BufferedRegion
+                                           << '.');
+  }
+
+  // The pixels which are in the boxes: the others are copies of the pixels at
+  // the boundary of the buffered region.
+  m_InputRegion = region;
+  m_InputRegion.PadByRadius(radius);
+  m_InputRegion.Crop(m_BufferedRegion);
+
+  m_Sums.resize(m_InputRegion.GetNumberOfPixels());
+  if (computeSumsOfSquares)
+  {
+    m_SumsOfSquares.resize(m_Sums.size());
+  }
+  SizeValueType i = 0;
+  for (ImageRegionConstIterator<ImageType> it(&image, m_InputRegion); !it.IsAtEnd(); ++it, ++i)
+  {
+    const auto value = static_cast<RealType>(it.Get());
+    m_Sums[i] = value;
+    if (computeSumsOfSquares)
+    {
+      m_SumsOfSquares[i] = value * value;
+    }
+  }
+
+  // After the sums along the axes 0 to d - 1, the values span the region along
+  // these axes, and the input region along the others.
+  std::vector<RealType> buffer;
+  for (std::vector<RealType> * values : { &m_Sums, &m_SumsOfSquares })
+  {
+    if (values->empty())
+    {
+      continue;
+    }
+    SizeType size = m_InputRegion.GetSize();
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      this->SumAlongAxis(*values, buffer, size, d);
+      values->swap(buffer);
+      size[d] = region.GetSize(d);
+    }
+  }
+}
+
+
+template <typename TImage, typename TRealType>
+void
+SlidingWindowMoments<TImage, TRealType>::SumAlongAxis(const std::vector<RealType> & input,
+                                                      std::vector<RealType> &       output,
+                                                      const SizeType &              inputSize,
+                                                      const unsigned int            axis) const
+{
+  // The values are lines of "inner" values along the axis, in "outer" blocks.
+  SizeValueType inner = 1;
+  for (unsigned int d = 0; d < axis; ++d)
+  {
+    inner *= inputSize[d];
+  }
+  SizeValueType outer = 1;
+  for (unsigned int d = axis + 1; d < ImageDimension; ++d)
+  {
+    outer *= inputSize[d];
+  }
+  const SizeValueType inputLength = inputSize[axis];
+  const SizeValueType outputLength = m_Region.GetSize(axis);
+  output.resize(inner * outputLength * outer);
+
+  // The line of the input at a position along the axis, clamped to the
+  // buffered region.
+  const auto          radius = static_cast<IndexValueType>(m_Radius[axis]);
+  const IndexValueType first = m_Region.GetIndex(axis);
+  const IndexValueType inputFirst = m_InputRegion.GetIndex(axis);
+  const IndexValueType bufferedFirst = m_BufferedRegion.GetIndex(axis);
+  const IndexValueType bufferedLast = bufferedFirst + static_cast<IndexValueType>(m_BufferedRegion.GetSize(axis)) - 1;
+  const auto           inputLine = [=](const RealType * inputBlock, const IndexValueType position) {
+    return inputBlock + (std::clamp(position, bufferedFirst, bufferedLast) - inputFirst) * inner;
+  };
+
+  for (SizeValueType o = 0; o < outer; ++o)
+  {
+    const RealType * const inputBlock = input.data() + o * inputLength * inner;
+    RealType *             outputLine = output.data() + o * outputLength * inner;
+
+    // The first window is summed, the next ones are updated.
+    std::fill_n(outputLine, inner, RealType{});
+    for (IndexValueType position = first - radius; position <= first + radius; ++position)
+    {
+      const RealType * const line = inputLine(inputBlock, position);
+      for (SizeValueType j = 0; j < inner; ++j)
+      {
+        outputLine[j] += line[j];
+      }
+    }
+    for (SizeValueType x = 1; x < outputLength; ++x)
+    {
+      const RealType * const previousLine = outputLine;
+      outputLine += inner;
+      const auto             position = first + static_cast<IndexValueType>(x);
+      const RealType * const enteringLine = inputLine(inputBlock, position + radius);
+      const RealType * const leavingLine = inputLine(inputBlock, position - radius - 1);
+      for (SizeValueType j = 0; j < inner; ++j)
+      {
+        outputLine[j] = previousLine[j] + enteringLine[j] - leavingLine[j];
+      }
+    }
+  }
+}
+} // end namespace itk
+
+#endif
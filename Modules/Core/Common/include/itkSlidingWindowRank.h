@@ -0,0 +1,190 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSlidingWindowRank_h
+#define itkSlidingWindowRank_h
+
+#include "itkImage.h"
+#include "itkSIMDPixelTransform.h"
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace itk
+{
+/** \class SlidingWindowRank
+ * \brief Exact ranks, such as the medians, of the pixels in the box
+ * neighborhoods of all the pixels of a region.
+ *
+ * Compute() computes, for each pixel of the region, the value of the given
+ * rank among the pixels in the box of the given radius centered at the pixel.
+ * A rank of 0.5 gives the median, 0 the minimum and 1 the maximum. The value
+ * is the k-th smallest pixel of the box, with k = rank * (n - 1) + 1 rounded
+ * down, n being the number of pixels of the box, as in RankImageFilter.
+ *
+ * The pixels outside the buffered region of the image are either the nearest
+ * pixels of the buffered region, as with the ZeroFluxNeumannBoundaryCondition
+ * of a ConstNeighborhoodIterator, or not part of the boxes, which are then
+ * cropped at the boundary.
+ *
+ * The boxes are counted in a histogram, which slides along the lines of the
+ * region: moving to the next pixel adds the pixels of the box which enter
+ * it, and removes the ones which leave it, that is (2r + 1)^(Dimension - 1)
+ * pixels rather than the (2r + 1)^Dimension pixels of the box. The histogram
+ * has tiers of coarser bins, with which the bin of the rank is found from the
+ * bin of the previous pixel in a few steps.
+ *
+ * The bins are the values of the pixels for integers of 8 or 16 bits, between
+ * the minimum and the maximum of the pixels of the boxes. For the other pixel
+ * types, they are the ranks of the pixels among the distinct values of the
+ * pixels of the boxes, which are sorted once for the whole region.
+ *
+ * The values are stored in the order of an ImageRegionConstIterator over the
+ * region.
+ *
+ * \tparam TImage The type of the image, whose buffer must be an array of
+ * scalar pixels.
+ *
+ * \sa MedianImageFilter, RankImageFilter
+ * \ingroup ITKCommon
+ */
+template <typename TImage>
+class ITK_TEMPLATE_EXPORT SlidingWindowRank
+{
+public:
+  /** Standard class type aliases. */
+  using Self = SlidingWindowRank;
+
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  using ImageType = TImage;
+  using PixelType = typename TImage::PixelType;
+  using RegionType = typename TImage::RegionType;
+  using SizeType = typename TImage::SizeType;
+  using RadiusType = SizeType;
+
+  /** Whether the bins of the histogram are the values of the pixels, rather
+   * than their ranks among the distinct values of the pixels. */
+  static constexpr bool UsesPixelValueBins = std::is_integral_v<PixelType> && sizeof(PixelType) <= 2;
+
+  /** Computes the values of the rank in the boxes of the radius, centered at
+   * the pixels of the region, which must be inside the buffered region of the
+   * image. The boxes are cropped at the boundary of the buffered region when
+   * cropAtBoundary is true. */
+  void
+  Compute(const ImageType &  image,
+          const RegionType & region,
+          const RadiusType & radius,
+          float              rank,
+          bool               cropAtBoundary = false);
+
+  /** The region and the radius of the last Compute(). */
+  const RegionType &
+  GetRegion() const
+  {
+    return m_Region;
+  }
+
+  const RadiusType &
+  GetRadius() const
+  {
+    return m_Radius;
+  }
+
+  /** The values of the rank, in the order of the pixels of the region. */
+  const std::vector<PixelType> &
+  GetValues() const
+  {
+    return m_Values;
+  }
+
+private:
+  using BinType = uint32_t;
+
+  /** Counts of the bins, and of tiers of 2^6 and 2^12 bins, with the rank of
+   * the bin found last. */
+  class TieredHistogram
+  {
+  public:
+    explicit TieredHistogram(BinType numberOfBins)
+      : m_Counts(numberOfBins)
+      , m_Counts1((numberOfBins >> Shift1) + 1)
+      , m_Counts2((numberOfBins >> Shift2) + 1)
+    {}
+
+    void
+    AddBin(const BinType bin)
+    {
+      ++m_Counts[bin];
+      ++m_Counts1[bin >> Shift1];
+      ++m_Counts2[bin >> Shift2];
+      m_Below += (bin < m_Bin);
+    }
+
+    void
+    RemoveBin(const BinType bin)
+    {
+      --m_Counts[bin];
+      --m_Counts1[bin >> Shift1];
+      --m_Counts2[bin >> Shift2];
+      m_Below -= (bin < m_Bin);
+    }
+
+    uint32_t
+    GetCount(const BinType bin) const
+    {
+      return m_Counts[bin];
+    }
+
+    /** The bin of the k-th smallest value, k being at least 1, and at most the
+     * number of values. */
+    BinType
+    FindBin(SizeValueType k);
+
+  private:
+    static constexpr unsigned int Shift1 = 6;
+    static constexpr unsigned int Shift2 = 12;
+
+    std::vector<uint32_t> m_Counts;
+    std::vector<uint32_t> m_Counts1;
+    std::vector<uint32_t> m_Counts2;
+
+    /** The last bin found, and the number of values in the bins below it. */
+    BinType       m_Bin{ 0 };
+    SizeValueType m_Below{ 0 };
+  };
+
+  /** Sets the bins of the pixels of the padded region, and the values of the
+   * bins. The pixels outside the buffered region are in the bin after the
+   * bins of the values when the boxes are cropped. */
+  void
+  ComputeBins(const ImageType & image, bool cropAtBoundary);
+
+  RegionType             m_Region{};
+  RadiusType             m_Radius{};
+  RegionType             m_PaddedRegion{};
+  std::vector<BinType>   m_Bins{};
+  std::vector<PixelType> m_BinValues{};
+  std::vector<PixelType> m_Values{};
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSlidingWindowRank.hxx"
+#endif
+
+#endif
@@ -0,0 +1,272 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSlidingWindowRank_hxx
+#define itkSlidingWindowRank_hxx
+
+#include "itkImageRegionConstIterator.h"
+#include "itkIndexRange.h"
+#include <algorithm>
+
+namespace itk
+{
+template <typename TImage>
+void
+SlidingWindowRank<TImage>::Compute(const ImageType &  image,
+                                   const RegionType & region,
+                                   const RadiusType & radius,
+                                   const float        rank,
+                                   const bool         cropAtBoundary)
+{
+  static_assert(HasPixelArrayBuffer<TImage> && std::is_arithmetic_v<PixelType>,
+                "The buffer of the image must be an array of scalar pixels.");
+
+  m_Region = region;
+  m_Radius = radius;
+  m_Values.clear();
+
+  if (region.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+  if (!image.GetBufferedRegion().IsInside(region))
+  {
+    itkGenericExceptionMacro("The region " << region << " is not inside the buffered region "
+                                           << image.GetBufferedRegion() << '.');
+  }
+
+  m_PaddedRegion = region;
+  m_PaddedRegion.PadByRadius(radius);
+  this->ComputeBins(image, cropAtBoundary);
+
+  // The offsets in the bins of the pixels of the cross section of a box, along
+  // the axes 1 to ImageDimension - 1.
+  const SizeType             paddedSize = m_PaddedRegion.GetSize();
+  SizeValueType              stride = paddedSize[0];
+  std::vector<SizeValueType> crossSectionOffsets{ 0 };
+  for (unsigned int d = 1; d < ImageDimension; ++d)
+  {
+    std::vector<SizeValueType> offsets;
+    offsets.reserve(crossSectionOffsets.size() * (2 * radius[d] + 1));
+    for (SizeValueType j = 0; j <= 2 * radius[d]; ++j)
+    {
+      for (const SizeValueType offset : crossSectionOffsets)
+      {
+        offsets.push_back(offset + j * stride);
+      }
+    }
+    crossSectionOffsets.swap(offsets);
+    stride *= paddedSize[d];
+  }
+
+  const auto            outsideBin = static_cast<BinType>(m_BinValues.size());
+  TieredHistogram       histogram(outsideBin + 1);
+  const BinType * const bins = m_Bins.data();
+  const auto            addSection = [&](const BinType * const section) {
+    for (const SizeValueType offset : crossSectionOffsets)
+    {
+      histogram.AddBin(section[offset]);
+    }
+  };
+  const auto removeSection = [&](const BinType * const section) {
+    for (const SizeValueType offset : crossSectionOffsets)
+    {
+      histogram.RemoveBin(section[offset]);
+    }
+  };
+
+  const SizeValueType lineLength = region.GetSize(0);
+  const SizeValueType diameter = 2 * radius[0] + 1;
+  const SizeValueType numberOfPixelsPerWindow = diameter * crossSectionOffsets.size();
+  m_Values.resize(region.GetNumberOfPixels());
+  PixelType * value = m_Values.data();
+
+  // The first pixel of the box of a pixel of the region is at the same offset
+  // from the start of the padded region as the pixel from the start of the
+  // region.
+  SizeType lineRegionSize = region.GetSize();
+  lineRegionSize[0] = 1;
+  for (const auto & lineIndex : ImageRegionIndexRange<ImageDimension>(RegionType(region.GetIndex(), lineRegionSize)))
+  {
+    SizeValueType lineOffset = 0;
+    stride = 1;
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      lineOffset += static_cast<SizeValueType>(lineIndex[d] - region.GetIndex(d)) * stride;
+      stride *= paddedSize[d];
+    }
+    const BinType * const line = bins + lineOffset;
+
+    for (SizeValueType x = 0; x < diameter; ++x)
+    {
+      addSection(line + x);
+    }
+    for (SizeValueType x = 0;; ++x)
+    {
+      const SizeValueType numberOfValues = numberOfPixelsPerWindow - histogram.GetCount(outsideBin);
+      const auto          k = static_cast<SizeValueType>(rank * static_cast<float>(numberOfValues - 1)) + 1;
+      *value = m_BinValues[histogram.FindBin(k)];
+      ++value;
+      if (x + 1 == lineLength)
+      {
+        break;
+      }
+      addSection(line + x + diameter);
+      removeSection(line + x);
+    }
+    for (SizeValueType x = lineLength - 1; x < lineLength - 1 + diameter; ++x)
+    {
+      removeSection(line + x);
+    }
+  }
+}
+
+
+template <typename TImage>
+void
+SlidingWindowRank<TImage>::ComputeBins(const ImageType & image, const bool cropAtBoundary)
+{
+  const RegionType & bufferedRegion = image.GetBufferedRegion();
+  RegionType         inputRegion = m_PaddedRegion;
+  inputRegion.Crop(bufferedRegion);
+
+  // The values of the bins.
+  m_BinValues.clear();
+  if constexpr (UsesPixelValueBins)
+  {
+    ImageRegionConstIterator<ImageType> it(&image, inputRegion);
+    PixelType                           minimum = it.Get();
+    PixelType                           maximum = minimum;
+    for (; !it.IsAtEnd(); ++it)
+    {
+      minimum = std::min(minimum, it.Get());
+      maximum = std::max(maximum, it.Get());
+    }
+    for (auto binValue = static_cast<int32_t>(minimum); binValue <= static_cast<int32_t>(maximum); ++binValue)
+    {
+      m_BinValues.push_back(static_cast<PixelType>(binValue));
+    }
+  }
+  else
+  {
+    m_BinValues.reserve(inputRegion.GetNumberOfPixels());
+    for (ImageRegionConstIterator<ImageType> it(&image, inputRegion); !it.IsAtEnd(); ++it)
+    {
+      m_BinValues.push_back(it.Get());
+    }
+    std::sort(m_BinValues.begin(), m_BinValues.end());
+    m_BinValues.erase(std::unique(m_BinValues.begin(), m_BinValues.end()), m_BinValues.end());
+  }
+  const PixelType firstBinValue = m_BinValues.front();
+  const auto      outsideBin = static_cast<BinType>(m_BinValues.size());
+  const auto      toBin = [this, firstBinValue](const PixelType pixel) {
+    if constexpr (UsesPixelValueBins)
+    {
+      return static_cast<BinType>(static_cast<int32_t>(pixel) - static_cast<int32_t>(firstBinValue));
+    }
+    else
+    {
+      return static_cast<BinType>(std::lower_bound(m_BinValues.cbegin(), m_BinValues.cend(), pixel) -
+                                  m_BinValues.cbegin());
+    }
+  };
+
+  // The bins of the lines of the padded region, from the nearest lines of the
+  // buffered region.
+  const auto bufferedFirst = bufferedRegion.GetIndex();
+  const auto bufferedSize = bufferedRegion.GetSize();
+  const auto clampToBuffer = [&](const IndexValueType position, const unsigned int d) {
+    return std::clamp(position, bufferedFirst[d], bufferedFirst[d] + static_cast<IndexValueType>(bufferedSize[d]) - 1);
+  };
+  SizeType lineRegionSize = m_PaddedRegion.GetSize();
+  lineRegionSize[0] = 1;
+  m_Bins.resize(m_PaddedRegion.GetNumberOfPixels());
+  BinType * bin = m_Bins.data();
+  for (auto lineIndex : ImageRegionIndexRange<ImageDimension>(RegionType(m_PaddedRegion.GetIndex(), lineRegionSize)))
+  {
+    bool isOutside = false;
+    for (unsigned int d = 1; d < ImageDimension; ++d)
+    {
+      const IndexValueType position = clampToBuffer(lineIndex[d], d);
+      isOutside = isOutside || (position != lineIndex[d]);
+      lineIndex[d] = position;
+    }
+    lineIndex[0] = bufferedFirst[0];
+    const PixelType * const line = image.GetBufferPointer() + image.ComputeOffset(lineIndex);
+
+    const IndexValueType first = m_PaddedRegion.GetIndex(0);
+    const IndexValueType last = first + static_cast<IndexValueType>(m_PaddedRegion.GetSize(0));
+    for (IndexValueType x = first; x < last; ++x, ++bin)
+    {
+      const IndexValueType position = clampToBuffer(x, 0);
+      *bin = (cropAtBoundary && (isOutside || position != x)) ? outsideBin : toBin(line[position - bufferedFirst[0]]);
+    }
+  }
+}
+
+
+template <typename TImage>
+auto
+SlidingWindowRank<TImage>::TieredHistogram::FindBin(const SizeValueType k) -> BinType
+{
+  constexpr BinType tier1 = BinType{ 1 } << Shift1;
+  constexpr BinType tier2 = BinType{ 1 } << Shift2;
+
+  // Down to a bin whose values are not all of rank k or more.
+  while (m_Below >= k)
+  {
+    if ((m_Bin & (tier2 - 1)) == 0 && m_Below - m_Counts2[(m_Bin >> Shift2) - 1] >= k)
+    {
+      m_Bin -= tier2;
+      m_Below -= m_Counts2[m_Bin >> Shift2];
+    }
+    else if ((m_Bin & (tier1 - 1)) == 0 && m_Below - m_Counts1[(m_Bin >> Shift1) - 1] >= k)
+    {
+      m_Bin -= tier1;
+      m_Below -= m_Counts1[m_Bin >> Shift1];
+    }
+    else
+    {
+      --m_Bin;
+      m_Below -= m_Counts[m_Bin];
+    }
+  }
+
+  // Up to the bin of the value of rank k.
+  while (m_Below + m_Counts[m_Bin] < k)
+  {
+    if ((m_Bin & (tier2 - 1)) == 0 && m_Below + m_Counts2[m_Bin >> Shift2] < k)
+    {
+      m_Below += m_Counts2[m_Bin >> Shift2];
+      m_Bin += tier2;
+    }
+    else if ((m_Bin & (tier1 - 1)) == 0 && m_Below + m_Counts1[m_Bin >> Shift1] < k)
+    {
+      m_Below += m_Counts1[m_Bin >> Shift1];
+      m_Bin += tier1;
+    }
+    else
+    {
+      m_Below += m_Counts[m_Bin];
+      ++m_Bin;
+    }
+  }
+  return m_Bin;
+}
+} // end namespace itk
+
+#endif
@@ -324,6 +324,23 @@ public:
                       Point<TCoordRep, VImageDimension>& point ) const = 0;
   */
 
+  SizeValueType
+  GetNumberOfBytesPerPixel() const override
+  {
+    return sizeof(PixelType);
+  }
+
+  using Superclass::GetBufferBytes;
+  const void *
+  GetBufferBytes() const override
+  {
+    if constexpr (std::is_trivially_copyable_v<PixelType>)
+    {
+      return this->GetBufferPointer();
+    }
+    return nullptr;
+  }
+
 protected:
   SpecialCoordinatesImage() = default;
   void
@@ -43,6 +43,17 @@ namespace itk
  * Initially the thread pool is started with GlobalDefaultNumberOfThreads.
  * The jobs are submitted via AddWork method.
  *
+ * By default all jobs go through a single queue guarded by one mutex.
+ * Optionally, the pool can run in a work-stealing mode, where every worker
+ * thread owns a Chase-Lev deque: jobs submitted from a worker thread are
+ * pushed onto that worker's deque, jobs submitted from other threads are
+ * distributed round-robin over the workers, and idle workers steal from
+ * randomly chosen victims before parking. Work-stealing reduces lock
+ * contention when many small jobs are submitted, e.g. when
+ * ParallelizeArray or ParallelizeImageRegion are used with many work units.
+ * It is enabled by SetWorkStealing(true), or by setting the environment
+ * variable ITK_THREAD_POOL_WORK_STEALING to ON.
+ *
  * This implementation heavily borrows from:
  * https://github.com/progschj/ThreadPool
  *
@@ -92,11 +103,7 @@ auto result = pool->AddWork([](int param) { return param; }, 7);
       [function, arguments...]() -> return_type { return function(arguments...); });
 
     std::future<return_type> res = task->get_future();
-    {
-      const std::lock_guard<std::mutex> lockGuard(this->GetMutex());
-      m_WorkQueue.emplace_back([task]() { (*task)(); });
-    }
-    m_Condition.notify_one();
+    this->SubmitTask([task]() { (*task)(); });
     return res;
   }
 
@@ -124,12 +131,40 @@ auto result = pool->AddWork([](int param) { return param; }, 7);
   static void
   SetDoNotWaitForThreads(bool doNotWaitForThreads);
 
+  /** Set/Get whether jobs are scheduled with per-worker work-stealing deques
+   * instead of the single shared queue. The initial value is taken from the
+   * ITK_THREAD_POOL_WORK_STEALING environment variable (OFF by default).
+   * The mode can be changed at any time, it only affects jobs submitted
+   * afterwards. */
+  static bool
+  GetWorkStealing();
+  static void
+  SetWorkStealing(bool workStealing);
+
+  /** Returns true if the calling thread is one of the worker threads of the pool. */
+  static bool
+  IsWorkerThread();
+
+  /** Takes one pending job from the queues and executes it in the calling
+   * thread. Returns false if no job was pending. A worker thread which has
+   * to wait for jobs it submitted calls this method to help executing them
+   * instead of blocking, which avoids deadlocks and idle workers when
+   * parallel sections are nested. Exceptions thrown by the job are stored
+   * in its future, like for jobs executed by the pool. */
+  bool
+  TryExecutePendingTask();
+
 protected:
   /** We need access to the mutex in AddWork, and the variable is only
    * visible in the .cxx file, so this method returns it. */
   std::mutex &
   GetMutex() const;
 
+  /** Enqueue a job, either in the shared queue or, in work-stealing mode,
+   * in the deque of a worker thread, and wake up an idle thread if needed. */
+  void
+  SubmitTask(std::function<void()> && task);
+
   ThreadPool();
 
   /** Stop the pool and release threads. To be called by the destructor and atfork. */
@@ -153,7 +188,8 @@ private:
   std::deque<std::function<void()>> m_WorkQueue; // guarded by m_PimplGlobals->m_Mutex
 
   /** When a thread is idle, it is waiting on m_Condition.
-   * AddWork signals it to resume a (random) thread. */
+   * AddWork signals it to resume a (random) thread. In work-stealing mode,
+   * it is only signaled when at least one thread is parked. */
   std::condition_variable m_Condition;
 
   /** Vector to hold all thread handles.
@@ -166,9 +202,10 @@ private:
   /** To lock on the internal variables */
   static ThreadPoolGlobals * m_PimplGlobals;
 
-  /** The continuously running thread function */
+  /** The continuously running thread function. workerIndex identifies the
+   * work-stealing deque owned by the thread. */
   static void
-  ThreadExecute();
+  ThreadExecute(ThreadIdType workerIndex);
 };
 
 } // namespace itk
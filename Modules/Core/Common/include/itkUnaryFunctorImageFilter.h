@@ -20,6 +20,8 @@
 
 #include "itkMath.h"
 #include "itkInPlaceImageFilter.h"
+#include "itkPixelwiseFusionStage.h"
+#include "itkSIMDPixelTransform.h"
 #include "itkImageRegionIteratorWithIndex.h"
 
 namespace itk
@@ -47,7 +49,9 @@ namespace itk
  * \endsphinx
  */
 template <typename TInputImage, typename TOutputImage, typename TFunction>
-class ITK_TEMPLATE_EXPORT UnaryFunctorImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+class ITK_TEMPLATE_EXPORT UnaryFunctorImageFilter
+  : public InPlaceImageFilter<TInputImage, TOutputImage>
+  , public PixelwiseFusionStage
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(UnaryFunctorImageFilter);
@@ -108,6 +112,37 @@ public:
     }
   }
 
+  /** The functor may be fused with the neighboring filters by
+   * FusedPixelwiseImageFilter, for itk::Image inputs and outputs of the same
+   * dimension. \sa PixelwiseFusionStage */
+  bool
+  CanFusePixelwise() const override
+  {
+    return PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>();
+  }
+  size_t
+  GetFusionInputPixelSize() const override
+  {
+    return sizeof(InputImagePixelType);
+  }
+  size_t
+  GetFusionOutputPixelSize() const override
+  {
+    return sizeof(OutputImagePixelType);
+  }
+  void
+  BeforeFusedTransformPixels() override
+  {
+    this->BeforeThreadedGenerateData();
+  }
+  void
+  FusedTransformPixels(const void * input, void * output, SizeValueType numberOfPixels) override;
+  void
+  AfterFusedTransformPixels() override
+  {
+    this->AfterThreadedGenerateData();
+  }
+
 protected:
   UnaryFunctorImageFilter();
   ~UnaryFunctorImageFilter() override = default;
@@ -88,6 +88,33 @@ UnaryFunctorImageFilter<TInputImage, TOutputImage, TFunction>::DynamicThreadedGe
   ImageScanlineConstIterator inputIt(inputPtr, inputRegionForThread);
   ImageScanlineIterator      outputIt(outputPtr, outputRegionForThread);
 
+  if constexpr (Functor::IsSIMDVectorizable<TFunction>::value && HasPixelArrayBuffer<TInputImage> &&
+                HasPixelArrayBuffer<TOutputImage> && TInputImage::ImageDimension == TOutputImage::ImageDimension)
+  {
+    // The lines of the images are arrays, to which the functor is applied
+    // with SIMD instructions, all at once when they follow each other.
+    const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+    if (IsContiguousInBuffer(inputRegionForThread, inputPtr->GetBufferedRegion()) &&
+        IsContiguousInBuffer(outputRegionForThread, outputPtr->GetBufferedRegion()))
+    {
+      const SizeValueType numberOfPixels = outputRegionForThread.GetNumberOfPixels();
+      SIMDTransformPixels(m_Functor,
+                          inputPtr->GetBufferPointer() + inputPtr->ComputeOffset(inputRegionForThread.GetIndex()),
+                          outputPtr->GetBufferPointer() + outputPtr->ComputeOffset(outputRegionForThread.GetIndex()),
+                          numberOfPixels);
+      progress.Completed(numberOfPixels);
+      return;
+    }
+    while (!inputIt.IsAtEnd())
+    {
+      SIMDTransformPixels(m_Functor, &inputIt.Value(), &outputIt.Value(), lineLength);
+      inputIt.NextLine();
+      outputIt.NextLine();
+      progress.Completed(lineLength);
+    }
+    return;
+  }
+
   inputIt.GoToBegin();
   outputIt.GoToBegin();
   while (!inputIt.IsAtEnd())
@@ -103,6 +130,37 @@ UnaryFunctorImageFilter<TInputImage, TOutputImage, TFunction>::DynamicThreadedGe
     progress.Completed(outputRegionForThread.GetSize()[0]);
   }
 }
+
+template <typename TInputImage, typename TOutputImage, typename TFunction>
+void
+UnaryFunctorImageFilter<TInputImage, TOutputImage, TFunction>::FusedTransformPixels(const void *  input,
+                                                                                    void *        output,
+                                                                                    SizeValueType numberOfPixels)
+{
+  if constexpr (PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>())
+  {
+    const auto * inputPixels = static_cast<const InputImagePixelType *>(input);
+    auto *       outputPixels = static_cast<OutputImagePixelType *>(output);
+    if constexpr (Functor::IsSIMDVectorizable<TFunction>::value)
+    {
+      SIMDTransformPixels(m_Functor, inputPixels, outputPixels, numberOfPixels);
+    }
+    else
+    {
+      for (SizeValueType i = 0; i < numberOfPixels; ++i)
+      {
+        outputPixels[i] = m_Functor(inputPixels[i]);
+      }
+    }
+  }
+  else
+  {
+    (void)input;
+    (void)output;
+    (void)numberOfPixels;
+    itkExceptionMacro("The pixels of " << this->GetNameOfClass() << " cannot be fused.");
+  }
+}
 } // end namespace itk
 
 #endif
@@ -295,6 +295,16 @@ public:
     return m_Buffer ? m_Buffer->GetBufferPointer() : nullptr;
   }
 
+  /** Return the alignment of the buffer pointer in bytes, that is, the
+   * largest power of two dividing its address, or zero when the image has no
+   * buffer. Kernels may use it to select aligned vector loads and stores.
+   * \sa ImageBufferAllocator */
+  size_t
+  GetBufferAlignment() const
+  {
+    return ImageBufferAllocator::GetPointerAlignment(this->GetBufferPointer());
+  }
+
   /** Return a pointer to the container. */
   PixelContainer *
   GetPixelContainer()
@@ -366,6 +376,23 @@ public:
   void
   SetNumberOfComponentsPerPixel(unsigned int n) override;
 
+  SizeValueType
+  GetNumberOfBytesPerPixel() const override
+  {
+    return sizeof(InternalPixelType) * m_VectorLength;
+  }
+
+  using Superclass::GetBufferBytes;
+  const void *
+  GetBufferBytes() const override
+  {
+    if constexpr (std::is_trivially_copyable_v<InternalPixelType>)
+    {
+      return this->GetBufferPointer();
+    }
+    return nullptr;
+  }
+
 protected:
   VectorImage() = default;
   void
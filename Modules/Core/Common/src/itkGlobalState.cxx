@@ -0,0 +1,38 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkGlobalState.h"
+#include "itksys/SystemTools.hxx"
+
+#include <string>
+
+namespace itk
+{
+
+bool
+GetBooleanEnvironmentVariable(const char * name, bool defaultValue)
+{
+  std::string envVar;
+  if (!itksys::SystemTools::GetEnv(name, envVar))
+  {
+    return defaultValue;
+  }
+  envVar = itksys::SystemTools::UpperCase(envVar);
+  return envVar == "ON" || envVar == "TRUE" || envVar == "YES" || envVar == "1";
+}
+
+} // end namespace itk
@@ -0,0 +1,269 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageBufferAllocator.h"
+#include "itkImageBufferPool.h"
+#include "itkMacro.h"
+#include "itkSingleton.h"
+#include "itksys/SystemTools.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(_WIN32)
+#  include "itkWindows.h"
+#  include <malloc.h>
+#else
+#  include <sys/mman.h>
+#endif
+
+namespace itk
+{
+
+struct ImageBufferAllocatorGlobals
+{
+  ImageBufferAllocatorGlobals()
+  {
+    std::string envVar;
+    if (itksys::SystemTools::GetEnv("ITK_IMAGE_BUFFER_ALLOCATION_POLICY", envVar))
+    {
+      const ImageBufferAllocationPolicyEnum policy = ImageBufferAllocator::PolicyFromString(envVar);
+      if (policy != ImageBufferAllocationPolicyEnum::Unknown)
+      {
+        m_GlobalDefaultPolicy = policy;
+      }
+    }
+  }
+
+  std::atomic<ImageBufferAllocationPolicyEnum> m_GlobalDefaultPolicy{ ImageBufferAllocationPolicyEnum::Default };
+};
+
+itkGetGlobalSimpleMacro(ImageBufferAllocator, ImageBufferAllocatorGlobals, PimplGlobals);
+ImageBufferAllocatorGlobals * ImageBufferAllocator::m_PimplGlobals;
+
+namespace
+{
+void *
+AllocateAligned(size_t numberOfBytes, size_t alignment)
+{
+#if defined(_WIN32)
+  return _aligned_malloc(numberOfBytes, alignment);
+#else
+  void * pointer = nullptr;
+  return (posix_memalign(&pointer, alignment, numberOfBytes) == 0) ? pointer : nullptr;
+#endif
+}
+
+void
+FreeAligned(void * pointer)
+{
+#if defined(_WIN32)
+  _aligned_free(pointer);
+#else
+  free(pointer);
+#endif
+}
+} // namespace
+
+void
+ImageBufferAllocator::SetGlobalDefaultPolicy(PolicyEnum policy)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  if (policy == PolicyEnum::Unknown)
+  {
+    itkGenericExceptionMacro("The image buffer allocation policy must not be Unknown");
+  }
+  m_PimplGlobals->m_GlobalDefaultPolicy = policy;
+}
+
+ImageBufferAllocator::PolicyEnum
+ImageBufferAllocator::GetGlobalDefaultPolicy()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_GlobalDefaultPolicy;
+}
+
+ImageBufferAllocator::PolicyEnum
+ImageBufferAllocator::PolicyFromString(std::string policyString)
+{
+  policyString = itksys::SystemTools::UpperCase(policyString);
+  if (policyString == "DEFAULT")
+  {
+    return PolicyEnum::Default;
+  }
+  if (policyString == "ALIGNED")
+  {
+    return PolicyEnum::Aligned;
+  }
+  if (policyString == "HUGEPAGE")
+  {
+    return PolicyEnum::HugePage;
+  }
+  if (policyString == "MEMORYMAPPED")
+  {
+    return PolicyEnum::MemoryMapped;
+  }
+  return PolicyEnum::Unknown;
+}
+
+size_t
+ImageBufferAllocator::GetAlignment(PolicyEnum policy, size_t numberOfBytes)
+{
+  switch (policy)
+  {
+    case PolicyEnum::Aligned:
+      return CacheLineAlignment;
+    case PolicyEnum::HugePage:
+      return (numberOfBytes >= HugePageSize) ? HugePageSize : CacheLineAlignment;
+    case PolicyEnum::MemoryMapped:
+      // Mappings start on a page boundary, and pages are at least 4 KiB large.
+      return 4096;
+    default:
+      return __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  }
+}
+
+size_t
+ImageBufferAllocator::GetPointerAlignment(const void * pointer)
+{
+  const auto address = reinterpret_cast<uintptr_t>(pointer);
+  return static_cast<size_t>(address & (~address + 1));
+}
+
+void *
+ImageBufferAllocator::Allocate(size_t numberOfBytes, PolicyEnum policy, bool initializeToZero)
+{
+  // Zero sized buffers still get a unique address.
+  const size_t sizeClass = ImageBufferPool::GetSizeClass(numberOfBytes);
+
+  if (void * const pooled = ImageBufferPool::Acquire(sizeClass, policy))
+  {
+    if (initializeToZero)
+    {
+      std::memset(pooled, 0, numberOfBytes);
+    }
+    return pooled;
+  }
+
+  void * pointer = nullptr;
+  switch (policy)
+  {
+    case PolicyEnum::Aligned:
+      pointer = AllocateAligned(sizeClass, CacheLineAlignment);
+      break;
+    case PolicyEnum::HugePage:
+      pointer = AllocateAligned(sizeClass, GetAlignment(policy, sizeClass));
+#if defined(MADV_HUGEPAGE)
+      if (pointer && sizeClass >= HugePageSize)
+      {
+        // Only a hint: the kernel falls back to regular pages when transparent
+        // huge pages are disabled, so the result is deliberately ignored.
+        madvise(pointer, sizeClass - sizeClass % HugePageSize, MADV_HUGEPAGE);
+      }
+#endif
+      break;
+    case PolicyEnum::MemoryMapped:
+#if defined(_WIN32)
+      pointer = VirtualAlloc(nullptr, sizeClass, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+      pointer = mmap(nullptr, sizeClass, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+      if (pointer == MAP_FAILED)
+      {
+        pointer = nullptr;
+      }
+#endif
+      break;
+    default:
+      itkGenericExceptionMacro("ImageBufferAllocator cannot allocate memory with the " << policy << " policy");
+  }
+
+  if (!pointer)
+  {
+    // We cannot construct an error string here because we may be out
+    // of memory.  Do not use the exception macro.
+    throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
+  }
+  if (initializeToZero && policy != PolicyEnum::MemoryMapped)
+  {
+    std::memset(pointer, 0, numberOfBytes);
+  }
+  return pointer;
+}
+
+void
+ImageBufferAllocator::Deallocate(void * pointer, size_t numberOfBytes, PolicyEnum policy)
+{
+  if (!pointer)
+  {
+    return;
+  }
+  const size_t sizeClass = ImageBufferPool::GetSizeClass(numberOfBytes);
+  if (!ImageBufferPool::Release(pointer, sizeClass, policy))
+  {
+    Free(pointer, sizeClass, policy);
+  }
+}
+
+void
+ImageBufferAllocator::Free(void * pointer, size_t sizeClass, PolicyEnum policy)
+{
+  switch (policy)
+  {
+    case PolicyEnum::Aligned:
+    case PolicyEnum::HugePage:
+      FreeAligned(pointer);
+      break;
+    case PolicyEnum::MemoryMapped:
+#if defined(_WIN32)
+      (void)sizeClass;
+      VirtualFree(pointer, 0, MEM_RELEASE);
+#else
+      munmap(pointer, sizeClass);
+#endif
+      break;
+    default:
+      break;
+  }
+}
+
+/** Print enum values */
+std::ostream &
+operator<<(std::ostream & out, const ImageBufferAllocatorEnums::Policy value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case ImageBufferAllocatorEnums::Policy::Default:
+        return "itk::ImageBufferAllocatorEnums::Policy::Default";
+      case ImageBufferAllocatorEnums::Policy::Aligned:
+        return "itk::ImageBufferAllocatorEnums::Policy::Aligned";
+      case ImageBufferAllocatorEnums::Policy::HugePage:
+        return "itk::ImageBufferAllocatorEnums::Policy::HugePage";
+      case ImageBufferAllocatorEnums::Policy::MemoryMapped:
+        return "itk::ImageBufferAllocatorEnums::Policy::MemoryMapped";
+      case ImageBufferAllocatorEnums::Policy::Unknown:
+        return "itk::ImageBufferAllocatorEnums::Policy::Unknown";
+      default:
+        return "INVALID VALUE FOR itk::ImageBufferAllocatorEnums::Policy";
+    }
+  }();
+}
+
+} // end namespace itk
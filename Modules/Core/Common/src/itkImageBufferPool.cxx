@@ -0,0 +1,236 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageBufferPool.h"
+#include "itkGlobalState.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+
+namespace itk
+{
+namespace
+{
+struct PooledBuffer
+{
+  void *                          m_Pointer;
+  size_t                          m_SizeClass;
+  ImageBufferAllocationPolicyEnum m_Policy;
+};
+
+struct ImageBufferPoolState
+{
+  std::atomic<bool>          m_Enabled{ GetBooleanEnvironmentVariable("ITK_IMAGE_BUFFER_POOL") };
+  std::atomic<SizeValueType> m_MaximumNumberOfBytes{ SizeValueType{ 1 } << 30 };
+  std::atomic<SizeValueType> m_MinimumNumberOfBytes{ SizeValueType{ 64 } << 10 };
+
+  std::mutex m_Mutex;
+  // Most recently released buffers first. Guarded by m_Mutex, like m_Statistics.
+  std::list<PooledBuffer>    m_Buffers;
+  ImageBufferPool::Statistics m_Statistics;
+};
+
+ImageBufferPoolState &
+GetState()
+{
+  return GetNeverDestroyedInstance<ImageBufferPoolState>();
+}
+
+// Frees the least recently released buffers until at most maximumNumberOfBytes
+// are pooled. Must be called with the mutex held; the buffers to free are
+// appended to evicted, so that they are freed after the mutex is released.
+void
+EvictBuffers(ImageBufferPoolState & state, SizeValueType maximumNumberOfBytes, std::list<PooledBuffer> & evicted)
+{
+  while (state.m_Statistics.NumberOfBytes > maximumNumberOfBytes)
+  {
+    const PooledBuffer & oldest = state.m_Buffers.back();
+    state.m_Statistics.NumberOfBytes -= oldest.m_SizeClass;
+    --state.m_Statistics.NumberOfBuffers;
+    evicted.splice(evicted.end(), state.m_Buffers, std::prev(state.m_Buffers.end()));
+  }
+}
+
+void
+FreeBuffers(const std::list<PooledBuffer> & buffers)
+{
+  for (const PooledBuffer & buffer : buffers)
+  {
+    ImageBufferAllocator::Free(buffer.m_Pointer, buffer.m_SizeClass, buffer.m_Policy);
+  }
+}
+} // namespace
+
+void
+ImageBufferPool::SetEnabled(bool enabled)
+{
+  GetState().m_Enabled = enabled;
+  if (!enabled)
+  {
+    Clear();
+  }
+}
+
+bool
+ImageBufferPool::GetEnabled()
+{
+  return GetState().m_Enabled;
+}
+
+void
+ImageBufferPool::SetMaximumNumberOfBytes(SizeValueType numberOfBytes)
+{
+  ImageBufferPoolState & state = GetState();
+  state.m_MaximumNumberOfBytes = numberOfBytes;
+
+  std::list<PooledBuffer> evicted;
+  {
+    const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+    EvictBuffers(state, numberOfBytes, evicted);
+    state.m_Statistics.NumberOfEvictions += evicted.size();
+  }
+  FreeBuffers(evicted);
+}
+
+SizeValueType
+ImageBufferPool::GetMaximumNumberOfBytes()
+{
+  return GetState().m_MaximumNumberOfBytes;
+}
+
+void
+ImageBufferPool::SetMinimumNumberOfBytes(SizeValueType numberOfBytes)
+{
+  GetState().m_MinimumNumberOfBytes = numberOfBytes;
+}
+
+SizeValueType
+ImageBufferPool::GetMinimumNumberOfBytes()
+{
+  return GetState().m_MinimumNumberOfBytes;
+}
+
+void
+ImageBufferPool::Clear()
+{
+  ImageBufferPoolState &  state = GetState();
+  std::list<PooledBuffer> buffers;
+  {
+    const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+    buffers.swap(state.m_Buffers);
+    state.m_Statistics.NumberOfBuffers = 0;
+    state.m_Statistics.NumberOfBytes = 0;
+  }
+  FreeBuffers(buffers);
+}
+
+ImageBufferPool::Statistics
+ImageBufferPool::GetStatistics()
+{
+  ImageBufferPoolState &            state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_Statistics;
+}
+
+void
+ImageBufferPool::ResetStatistics()
+{
+  ImageBufferPoolState &            state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.m_Statistics.NumberOfHits = 0;
+  state.m_Statistics.NumberOfMisses = 0;
+  state.m_Statistics.NumberOfEvictions = 0;
+  state.m_Statistics.PeakNumberOfBytes = state.m_Statistics.NumberOfBytes;
+}
+
+size_t
+ImageBufferPool::GetSizeClass(size_t numberOfBytes)
+{
+  // Steps of an eighth of the largest power of two not exceeding the size,
+  // and at least of a cache line.
+  size_t powerOfTwo = 1;
+  while (powerOfTwo <= numberOfBytes / 2)
+  {
+    powerOfTwo *= 2;
+  }
+  const size_t step = std::max(powerOfTwo / 8, ImageBufferAllocator::CacheLineAlignment);
+  return std::max((numberOfBytes + step - 1) / step, size_t{ 1 }) * step;
+}
+
+void *
+ImageBufferPool::Acquire(size_t sizeClass, PolicyEnum policy)
+{
+  ImageBufferPoolState & state = GetState();
+  if (!state.m_Enabled || sizeClass < state.m_MinimumNumberOfBytes)
+  {
+    return nullptr;
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  const auto                        found =
+    std::find_if(state.m_Buffers.begin(), state.m_Buffers.end(), [sizeClass, policy](const PooledBuffer & buffer) {
+      return buffer.m_SizeClass == sizeClass && buffer.m_Policy == policy;
+    });
+  if (found == state.m_Buffers.end())
+  {
+    ++state.m_Statistics.NumberOfMisses;
+    return nullptr;
+  }
+  void * const pointer = found->m_Pointer;
+  state.m_Buffers.erase(found);
+  ++state.m_Statistics.NumberOfHits;
+  --state.m_Statistics.NumberOfBuffers;
+  state.m_Statistics.NumberOfBytes -= sizeClass;
+  return pointer;
+}
+
+bool
+ImageBufferPool::Release(void * pointer, size_t sizeClass, PolicyEnum policy)
+{
+  ImageBufferPoolState & state = GetState();
+  const SizeValueType    maximumNumberOfBytes = state.m_MaximumNumberOfBytes;
+  if (!state.m_Enabled || sizeClass < state.m_MinimumNumberOfBytes || sizeClass > maximumNumberOfBytes)
+  {
+    return false;
+  }
+
+  std::list<PooledBuffer> evicted;
+  {
+    const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+    state.m_Buffers.push_front(PooledBuffer{ pointer, sizeClass, policy });
+    ++state.m_Statistics.NumberOfBuffers;
+    state.m_Statistics.NumberOfBytes += sizeClass;
+    EvictBuffers(state, maximumNumberOfBytes, evicted);
+    state.m_Statistics.NumberOfEvictions += evicted.size();
+    state.m_Statistics.PeakNumberOfBytes =
+      std::max(state.m_Statistics.PeakNumberOfBytes, state.m_Statistics.NumberOfBytes);
+  }
+  FreeBuffers(evicted);
+  return true;
+}
+
+std::ostream &
+operator<<(std::ostream & out, const ImageBufferPool::Statistics & statistics)
+{
+  return out << "Hits: " << statistics.NumberOfHits << ", Misses: " << statistics.NumberOfMisses
+             << ", Evictions: " << statistics.NumberOfEvictions << ", Buffers: " << statistics.NumberOfBuffers
+             << ", Bytes: " << statistics.NumberOfBytes << ", Peak bytes: " << statistics.PeakNumberOfBytes;
+}
+
+} // end namespace itk
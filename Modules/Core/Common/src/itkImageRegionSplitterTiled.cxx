@@ -0,0 +1,187 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterTiled.h"
+#include <algorithm>
+#include <cmath>
+
+namespace itk
+{
+namespace
+{
+// Minimum extent of the tiles along the first dimension, when the region allows it.
+constexpr SizeValueType minimumLineLength = 64;
+
+SizeValueType
+GetNumberOfTiles(unsigned int dim, const SizeValueType regionSize[], const SizeValueType tileSize[])
+{
+  SizeValueType numberOfTiles = 1;
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    numberOfTiles *= (regionSize[d] + tileSize[d] - 1) / tileSize[d];
+  }
+  return numberOfTiles;
+}
+} // namespace
+
+ImageRegionSplitterTiled::ImageRegionSplitterTiled() = default;
+
+void
+ImageRegionSplitterTiled::SetTileSize(const std::vector<SizeValueType> & tileSize)
+{
+  if (m_TileSize != tileSize)
+  {
+    m_TileSize = tileSize;
+    this->Modified();
+  }
+}
+
+unsigned int
+ImageRegionSplitterTiled::GetNumberOfSplitsInternal(unsigned int         dim,
+                                                    const IndexValueType itkNotUsed(regionIndex)[],
+                                                    const SizeValueType  regionSize[],
+                                                    unsigned int         requestedNumber) const
+{
+  std::vector<SizeValueType> tileSize(dim); // Note: stack allocation preferred
+
+  const SizeValueType numberOfTiles =
+    this->ComputeTileSize(dim, regionSize, SizeValueType{ requestedNumber } * m_NumberOfTilesPerWorkUnit, &tileSize[0]);
+  return static_cast<unsigned int>(std::min<SizeValueType>(numberOfTiles, NumericTraits<unsigned int>::max()));
+}
+
+unsigned int
+ImageRegionSplitterTiled::GetSplitInternal(unsigned int   dim,
+                                           unsigned int   i,
+                                           unsigned int   numberOfPieces,
+                                           IndexValueType regionIndex[],
+                                           SizeValueType  regionSize[]) const
+{
+  std::vector<SizeValueType> tileSize(dim); // Note: stack allocation preferred
+
+  // The tiles are made smaller until there are at least numberOfPieces of
+  // them: when numberOfPieces was returned by GetNumberOfSplits(), this
+  // yields the same tiles.
+  const SizeValueType numberOfTiles = this->ComputeTileSize(dim, regionSize, numberOfPieces, &tileSize[0]);
+
+  // The tiles are numbered along the first dimension first.
+  SizeValueType tileIndex = i;
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    const SizeValueType numberOfTilesAlongDimension = (regionSize[d] + tileSize[d] - 1) / tileSize[d];
+    const SizeValueType offset = (tileIndex % numberOfTilesAlongDimension) * tileSize[d];
+    tileIndex /= numberOfTilesAlongDimension;
+
+    regionIndex[d] += static_cast<IndexValueType>(offset);
+    regionSize[d] = std::min(tileSize[d], regionSize[d] - offset);
+  }
+
+  return static_cast<unsigned int>(std::min<SizeValueType>(numberOfTiles, NumericTraits<unsigned int>::max()));
+}
+
+SizeValueType
+ImageRegionSplitterTiled::ComputeTileSize(unsigned int        dim,
+                                          const SizeValueType regionSize[],
+                                          SizeValueType       minimumNumberOfTiles,
+                                          SizeValueType       tileSize[]) const
+{
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    if (regionSize[d] == 0)
+    {
+      // An empty region is a single piece.
+      std::copy_n(regionSize, dim, tileSize);
+      std::replace(tileSize, tileSize + dim, SizeValueType{ 0 }, SizeValueType{ 1 });
+      return 1;
+    }
+  }
+
+  // The fixed extents first, then the automatic ones share the remaining
+  // number of pixels, from the first dimension.
+  std::vector<bool> automatic(dim, false);
+  unsigned int      numberOfAutomaticDimensions = 0;
+  SizeValueType     numberOfPixels = m_TileNumberOfPixels;
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    if (d < m_TileSize.size() && m_TileSize[d] > 0)
+    {
+      tileSize[d] = std::min(m_TileSize[d], regionSize[d]);
+      numberOfPixels = std::max<SizeValueType>(numberOfPixels / tileSize[d], 1);
+    }
+    else
+    {
+      automatic[d] = true;
+      ++numberOfAutomaticDimensions;
+    }
+  }
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    if (automatic[d])
+    {
+      auto extent = static_cast<SizeValueType>(
+        std::pow(static_cast<double>(numberOfPixels), 1.0 / numberOfAutomaticDimensions) + 0.5);
+      if (d == 0)
+      {
+        extent = std::max(extent, minimumLineLength);
+      }
+      tileSize[d] = std::clamp<SizeValueType>(extent, 1, regionSize[d]);
+      numberOfPixels = std::max<SizeValueType>(numberOfPixels / tileSize[d], 1);
+      --numberOfAutomaticDimensions;
+    }
+  }
+
+  // Halve the largest automatic extent, preferring the last dimensions,
+  // until there are enough tiles.
+  SizeValueType numberOfTiles = GetNumberOfTiles(dim, regionSize, tileSize);
+  while (numberOfTiles < minimumNumberOfTiles)
+  {
+    unsigned int  splitDimension = dim;
+    SizeValueType largestExtent = 1;
+    for (unsigned int d = dim; d > 0; --d)
+    {
+      if (automatic[d - 1] && tileSize[d - 1] > largestExtent)
+      {
+        splitDimension = d - 1;
+        largestExtent = tileSize[d - 1];
+      }
+    }
+    if (splitDimension == dim)
+    {
+      break;
+    }
+    tileSize[splitDimension] = (largestExtent + 1) / 2;
+    numberOfTiles = GetNumberOfTiles(dim, regionSize, tileSize);
+  }
+  return numberOfTiles;
+}
+
+void
+ImageRegionSplitterTiled::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "TileNumberOfPixels: " << m_TileNumberOfPixels << std::endl;
+  os << indent << "NumberOfTilesPerWorkUnit: " << m_NumberOfTilesPerWorkUnit << std::endl;
+  os << indent << "TileSize:";
+  for (const SizeValueType extent : m_TileSize)
+  {
+    os << ' ' << extent;
+  }
+  os << std::endl;
+}
+
+} // end namespace itk
@@ -0,0 +1,232 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkMemoryMappedFile.h"
+#include "itkMacro.h"
+#include "itksys/SystemTools.hxx"
+
+#if defined(_WIN32)
+#  include "itkWindows.h"
+#  include "itksys/Encoding.hxx"
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace itk
+{
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  this->Unmap();
+}
+
+SizeValueType
+MemoryMappedFile::GetMappingGranularity()
+{
+#if defined(_WIN32)
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return systemInfo.dwAllocationGranularity;
+#else
+  return static_cast<SizeValueType>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+void
+MemoryMappedFile::Map(const std::string & fileName, SizeValueType offset, SizeValueType numberOfBytes, ModeEnum mode)
+{
+  this->Unmap();
+
+  const SizeValueType mappingOffset = offset - offset % GetMappingGranularity();
+  const SizeValueType mappingNumberOfBytes = numberOfBytes + (offset - mappingOffset);
+  const SizeValueType requiredFileSize = offset + numberOfBytes;
+
+#if defined(_WIN32)
+  const std::wstring wideFileName = itksys::Encoding::ToWindowsExtendedPath(fileName);
+  const DWORD        access = (mode == ModeEnum::ReadWrite) ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+  const DWORD        creation = (mode == ModeEnum::ReadWrite) ? OPEN_ALWAYS : OPEN_EXISTING;
+  const HANDLE       file =
+    CreateFileW(wideFileName.c_str(), access, FILE_SHARE_READ, nullptr, creation, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    itkGenericExceptionMacro("Cannot open " << fileName << " for memory mapping.");
+  }
+  LARGE_INTEGER fileSize;
+  GetFileSizeEx(file, &fileSize);
+  if (mode != ModeEnum::ReadWrite && static_cast<SizeValueType>(fileSize.QuadPart) < requiredFileSize)
+  {
+    CloseHandle(file);
+    itkGenericExceptionMacro("Cannot map " << numberOfBytes << " bytes at offset " << offset << " of " << fileName
+                                           << ", which is only " << fileSize.QuadPart << " bytes long.");
+  }
+
+  void * mappingPointer = nullptr;
+  if (mappingNumberOfBytes > 0)
+  {
+    // A ReadWrite mapping larger than the file enlarges it.
+    const DWORD protection = (mode == ModeEnum::ReadOnly)      ? PAGE_READONLY
+                             : (mode == ModeEnum::CopyOnWrite) ? PAGE_WRITECOPY
+                                                               : PAGE_READWRITE;
+    const auto  maximumSize = static_cast<unsigned long long>(requiredFileSize);
+    const HANDLE mapping = CreateFileMappingW(file,
+                                              nullptr,
+                                              protection,
+                                              static_cast<DWORD>(maximumSize >> 32),
+                                              static_cast<DWORD>(maximumSize & 0xFFFFFFFF),
+                                              nullptr);
+    if (mapping)
+    {
+      const DWORD viewAccess = (mode == ModeEnum::ReadOnly)      ? FILE_MAP_READ
+                               : (mode == ModeEnum::CopyOnWrite) ? FILE_MAP_COPY
+                                                                 : FILE_MAP_WRITE;
+      const auto  viewOffset = static_cast<unsigned long long>(mappingOffset);
+      mappingPointer = MapViewOfFile(mapping,
+                                     viewAccess,
+                                     static_cast<DWORD>(viewOffset >> 32),
+                                     static_cast<DWORD>(viewOffset & 0xFFFFFFFF),
+                                     static_cast<SIZE_T>(mappingNumberOfBytes));
+      // The view keeps the mapping, and the file, open.
+      CloseHandle(mapping);
+    }
+    if (!mappingPointer)
+    {
+      CloseHandle(file);
+      itkGenericExceptionMacro("Cannot memory map " << fileName << '.');
+    }
+  }
+  CloseHandle(file);
+#else
+  const int flags = (mode == ModeEnum::ReadWrite) ? (O_RDWR | O_CREAT) : O_RDONLY;
+  const int fileDescriptor = open(fileName.c_str(), flags, 0644);
+  if (fileDescriptor < 0)
+  {
+    itkGenericExceptionMacro("Cannot open " << fileName << " for memory mapping: "
+                                            << itksys::SystemTools::GetLastSystemError());
+  }
+  struct stat fileStatus;
+  if (fstat(fileDescriptor, &fileStatus) != 0)
+  {
+    close(fileDescriptor);
+    itkGenericExceptionMacro("Cannot get the size of " << fileName << ": "
+                                                       << itksys::SystemTools::GetLastSystemError());
+  }
+  const auto fileSize = static_cast<SizeValueType>(fileStatus.st_size);
+  if (fileSize < requiredFileSize)
+  {
+    // Accessing the pages of a mapping beyond the end of the file is an error.
+    if (mode != ModeEnum::ReadWrite)
+    {
+      close(fileDescriptor);
+      itkGenericExceptionMacro("Cannot map " << numberOfBytes << " bytes at offset " << offset << " of " << fileName
+                                             << ", which is only " << fileSize << " bytes long.");
+    }
+    if (ftruncate(fileDescriptor, static_cast<off_t>(requiredFileSize)) != 0)
+    {
+      close(fileDescriptor);
+      itkGenericExceptionMacro("Cannot resize " << fileName << " to " << requiredFileSize
+                                                << " bytes: " << itksys::SystemTools::GetLastSystemError());
+    }
+  }
+
+  void * mappingPointer = nullptr;
+  if (mappingNumberOfBytes > 0)
+  {
+    const int protection = (mode == ModeEnum::ReadOnly) ? PROT_READ : (PROT_READ | PROT_WRITE);
+    const int sharing = (mode == ModeEnum::ReadWrite) ? MAP_SHARED : MAP_PRIVATE;
+    mappingPointer = mmap(nullptr,
+                          static_cast<size_t>(mappingNumberOfBytes),
+                          protection,
+                          sharing,
+                          fileDescriptor,
+                          static_cast<off_t>(mappingOffset));
+    if (mappingPointer == MAP_FAILED)
+    {
+      close(fileDescriptor);
+      itkGenericExceptionMacro("Cannot memory map " << fileName << ": " << itksys::SystemTools::GetLastSystemError());
+    }
+  }
+  // The mapping keeps a reference to the file.
+  close(fileDescriptor);
+#endif
+
+  m_FileName = fileName;
+  m_Mode = mode;
+  m_MappingPointer = mappingPointer;
+  m_MappingNumberOfBytes = mappingNumberOfBytes;
+  m_Pointer = mappingPointer ? static_cast<char *>(mappingPointer) + (offset - mappingOffset) : nullptr;
+  m_NumberOfBytes = numberOfBytes;
+}
+
+void
+MemoryMappedFile::Unmap()
+{
+  if (m_MappingPointer)
+  {
+#if defined(_WIN32)
+    UnmapViewOfFile(m_MappingPointer);
+#else
+    munmap(m_MappingPointer, static_cast<size_t>(m_MappingNumberOfBytes));
+#endif
+  }
+  m_MappingPointer = nullptr;
+  m_MappingNumberOfBytes = 0;
+  m_Pointer = nullptr;
+  m_NumberOfBytes = 0;
+}
+
+void
+MemoryMappedFile::Flush()
+{
+  if (!m_MappingPointer || m_Mode != ModeEnum::ReadWrite)
+  {
+    return;
+  }
+#if defined(_WIN32)
+  const bool flushed = FlushViewOfFile(m_MappingPointer, 0) != 0;
+#else
+  const bool flushed = msync(m_MappingPointer, static_cast<size_t>(m_MappingNumberOfBytes), MS_SYNC) == 0;
+#endif
+  if (!flushed)
+  {
+    itkGenericExceptionMacro("Cannot write the mapped memory to " << m_FileName << ": "
+                                                                  << itksys::SystemTools::GetLastSystemError());
+  }
+}
+
+/** Print enum values */
+std::ostream &
+operator<<(std::ostream & out, const MemoryMappedFileEnums::Mode value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case MemoryMappedFileEnums::Mode::ReadOnly:
+        return "itk::MemoryMappedFileEnums::Mode::ReadOnly";
+      case MemoryMappedFileEnums::Mode::CopyOnWrite:
+        return "itk::MemoryMappedFileEnums::Mode::CopyOnWrite";
+      case MemoryMappedFileEnums::Mode::ReadWrite:
+        return "itk::MemoryMappedFileEnums::Mode::ReadWrite";
+      default:
+        return "INVALID VALUE FOR itk::MemoryMappedFileEnums::Mode";
+    }
+  }();
+}
+
+} // end namespace itk
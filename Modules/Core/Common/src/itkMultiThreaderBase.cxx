@@ -545,11 +545,21 @@ MultiThreaderBase::ParallelizeImageRegion(unsigned int
 
   struct RegionAndCallback rnc
   {
-    funcP, dimension, index, size, filter
+    funcP, dimension, index, size, filter, this->GetImageRegionSplitterOrDefault()
   };
   this->SetSingleMethodAndExecute(&MultiThreaderBase::ParallelizeImageRegionHelper, &rnc);
 }
 
+const ImageRegionSplitterBase *
+MultiThreaderBase::GetImageRegionSplitterOrDefault() const
+{
+  if (m_ImageRegionSplitter)
+  {
+    return m_ImageRegionSplitter;
+  }
+  return ImageSourceCommon::GetGlobalDefaultSplitter();
+}
+
 ITK_THREAD_RETURN_FUNCTION_CALL_CONVENTION
 MultiThreaderBase::ParallelizeImageRegionHelper(void * arg)
 {
@@ -558,19 +568,37 @@ MultiThreaderBase::ParallelizeImageRegionHelper(void * arg)
   ThreadIdType workUnitCount = workUnitInfo->NumberOfWorkUnits;
   auto *       rnc = static_cast<struct RegionAndCallback *>(workUnitInfo->UserData);
 
-  const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
-  ImageIORegion                   region(rnc->dimension);
+  const ImageRegionSplitterBase * splitter = rnc->splitter;
+  ImageIORegion                   wholeRegion(rnc->dimension);
   for (unsigned int d = 0; d < rnc->dimension; ++d)
   {
-    region.SetIndex(d, rnc->index[d]);
-    region.SetSize(d, rnc->size[d]);
+    wholeRegion.SetIndex(d, rnc->index[d]);
+    wholeRegion.SetSize(d, rnc->size[d]);
   }
-  ThreadIdType total = splitter->GetSplit(workUnitID, workUnitCount, region);
+  const ThreadIdType total = splitter->GetNumberOfSplits(wholeRegion, workUnitCount);
 
-  TotalProgressReporter reporter(rnc->filter, 0);
+  if (total <= workUnitCount)
+  {
+    TotalProgressReporter reporter(rnc->filter, 0);
+    ImageIORegion         region = wholeRegion;
+    splitter->GetSplit(workUnitID, workUnitCount, region);
+    if (workUnitID < total)
+    {
+      rnc->functor(&region.GetIndex()[0], &region.GetSize()[0]);
+
+      reporter.Completed(region.GetNumberOfPixels());
+    }
+    return ITK_THREAD_RETURN_DEFAULT_VALUE;
+  }
 
-  if (workUnitID < total)
+  // The splitter returned more pieces than work units: each work unit
+  // processes every workUnitCount-th piece, and reports the progress of its
+  // pieces as a part of the whole region.
+  TotalProgressReporter reporter(rnc->filter, wholeRegion.GetNumberOfPixels());
+  for (ThreadIdType i = workUnitID; i < total; i += workUnitCount)
   {
+    ImageIORegion region = wholeRegion;
+    splitter->GetSplit(i, total, region);
     rnc->functor(&region.GetIndex()[0], &region.GetSize()[0]);
 
     reporter.Completed(region.GetNumberOfPixels());
@@ -592,6 +620,7 @@ MultiThreaderBase::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "Global Default Threader Type: " << m_PimplGlobals->m_GlobalDefaultThreader << std::endl;
   os << indent << "SingleMethod: " << m_SingleMethod << std::endl;
   os << indent << "SingleData: " << m_SingleData << std::endl;
+  itkPrintSelfObjectMacro(ImageRegionSplitter);
 }
 
 MultiThreaderBaseGlobals * MultiThreaderBase::m_PimplGlobals;
@@ -0,0 +1,197 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkNUMAPolicy.h"
+#include "itkSingleton.h"
+#include "itkGlobalState.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(ITK_HAS_SCHED_GETAFFINITY)
+#  include <sched.h>
+#endif
+
+namespace itk
+{
+namespace
+{
+/** Parses a Linux cpulist, e.g. "0-3,8-11". */
+std::vector<unsigned int>
+ParseCPUList(const std::string & cpuList)
+{
+  std::vector<unsigned int> cpus;
+  std::stringstream         stream(cpuList);
+  std::string               range;
+  while (std::getline(stream, range, ','))
+  {
+    const auto dash = range.find('-');
+    try
+    {
+      const unsigned long first = std::stoul(range.substr(0, dash));
+      const unsigned long last = (dash == std::string::npos) ? first : std::stoul(range.substr(dash + 1));
+      for (unsigned long cpu = first; cpu <= last; ++cpu)
+      {
+        cpus.push_back(static_cast<unsigned int>(cpu));
+      }
+    }
+    catch (const std::exception &)
+    {
+      // Skip malformed ranges, e.g. the empty list of a memory-only node.
+    }
+  }
+  return cpus;
+}
+} // namespace
+
+struct NUMAPolicyGlobals
+{
+  NUMAPolicyGlobals()
+    : m_FirstTouch(GetBooleanEnvironmentVariable("ITK_NUMA_FIRST_TOUCH", false))
+    , m_ThreadPinning(GetBooleanEnvironmentVariable("ITK_NUMA_THREAD_PINNING", false))
+  {
+#if defined(__linux__)
+    for (unsigned int node = 0;; ++node)
+    {
+      std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+      std::string   cpuList;
+      if (!cpuListFile || !std::getline(cpuListFile, cpuList))
+      {
+        break;
+      }
+      std::vector<unsigned int> cpus = ParseCPUList(cpuList);
+      if (!cpus.empty())
+      {
+        m_NodeCPUs.push_back(std::move(cpus));
+      }
+    }
+#endif
+#if defined(ITK_HAS_SCHED_GETAFFINITY)
+    CPU_ZERO(&m_ProcessAffinity);
+    m_HasProcessAffinity = sched_getaffinity(0, sizeof(cpu_set_t), &m_ProcessAffinity) == 0;
+#endif
+  }
+
+  std::atomic<bool>          m_FirstTouch;
+  std::atomic<SizeValueType> m_FirstTouchMinimumNumberOfBytes{ SizeValueType{ 4 } << 20 };
+  std::atomic<bool>          m_ThreadPinning;
+
+  // The CPUs of each node having CPUs; empty when the topology is unknown.
+  std::vector<std::vector<unsigned int>> m_NodeCPUs;
+
+#if defined(ITK_HAS_SCHED_GETAFFINITY)
+  // The CPUs the process was allowed to run on, restored by UnpinCurrentThread.
+  cpu_set_t m_ProcessAffinity;
+  bool      m_HasProcessAffinity{ false };
+#endif
+};
+
+itkGetGlobalSimpleMacro(NUMAPolicy, NUMAPolicyGlobals, PimplGlobals);
+NUMAPolicyGlobals * NUMAPolicy::m_PimplGlobals;
+
+void
+NUMAPolicy::SetGlobalDefaultFirstTouch(bool firstTouch)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_FirstTouch = firstTouch;
+}
+
+bool
+NUMAPolicy::GetGlobalDefaultFirstTouch()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_FirstTouch;
+}
+
+void
+NUMAPolicy::SetGlobalDefaultFirstTouchMinimumNumberOfBytes(SizeValueType numberOfBytes)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_FirstTouchMinimumNumberOfBytes = numberOfBytes;
+}
+
+SizeValueType
+NUMAPolicy::GetGlobalDefaultFirstTouchMinimumNumberOfBytes()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_FirstTouchMinimumNumberOfBytes;
+}
+
+void
+NUMAPolicy::SetGlobalDefaultThreadPinning(bool threadPinning)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_ThreadPinning = threadPinning;
+}
+
+bool
+NUMAPolicy::GetGlobalDefaultThreadPinning()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_ThreadPinning;
+}
+
+unsigned int
+NUMAPolicy::GetNumberOfNodes()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return std::max<unsigned int>(1, static_cast<unsigned int>(m_PimplGlobals->m_NodeCPUs.size()));
+}
+
+bool
+NUMAPolicy::PinCurrentThreadToNode(unsigned int node)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+#if defined(ITK_HAS_SCHED_GETAFFINITY)
+  if (m_PimplGlobals->m_NodeCPUs.empty() || !m_PimplGlobals->m_HasProcessAffinity)
+  {
+    return false;
+  }
+  // Only use the CPUs of the node which the process is allowed to run on.
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for (const unsigned int cpu : m_PimplGlobals->m_NodeCPUs[node % m_PimplGlobals->m_NodeCPUs.size()])
+  {
+    if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &m_PimplGlobals->m_ProcessAffinity))
+    {
+      CPU_SET(cpu, &mask);
+    }
+  }
+  return CPU_COUNT(&mask) > 0 && sched_setaffinity(0, sizeof(cpu_set_t), &mask) == 0;
+#else
+  (void)node;
+  return false;
+#endif
+}
+
+bool
+NUMAPolicy::UnpinCurrentThread()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+#if defined(ITK_HAS_SCHED_GETAFFINITY)
+  return m_PimplGlobals->m_HasProcessAffinity &&
+         sched_setaffinity(0, sizeof(cpu_set_t), &m_PimplGlobals->m_ProcessAffinity) == 0;
+#else
+  return false;
+#endif
+}
+
+} // end namespace itk
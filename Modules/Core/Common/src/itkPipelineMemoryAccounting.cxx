@@ -0,0 +1,271 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPipelineMemoryAccounting.h"
+#include "itkProcessObject.h"
+#include "itkGlobalState.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+namespace itk
+{
+namespace
+{
+constexpr size_t NoOwner = std::numeric_limits<size_t>::max();
+
+struct AccountedBuffer
+{
+  size_t        m_Owner;
+  SizeValueType m_NumberOfBytes;
+};
+
+struct PipelineMemoryAccountingState
+{
+  std::atomic<bool> m_Enabled{ GetBooleanEnvironmentVariable("ITK_PIPELINE_MEMORY_ACCOUNTING") };
+  // Let the destruction of filters and buffers skip the mutex when nothing is accounted.
+  std::atomic<bool>   m_HasProcessObjects{ false };
+  std::atomic<size_t> m_NumberOfBuffers{ 0 };
+
+  std::mutex m_Mutex;
+  // Guarded by m_Mutex, like the maps.
+  PipelineMemoryAccounting::Report                  m_Report;
+  std::unordered_map<const ProcessObject *, size_t> m_ProcessObjectIndices;
+  std::unordered_map<const void *, AccountedBuffer> m_Buffers;
+};
+
+PipelineMemoryAccountingState &
+GetState()
+{
+  return GetNeverDestroyedInstance<PipelineMemoryAccountingState>();
+}
+
+// Index of the record of the filter executed by the thread, if any.
+thread_local size_t currentOwner = NoOwner;
+
+// Stops accounting a buffer. Must be called with the mutex held.
+void
+ForgetBuffer(PipelineMemoryAccountingState & state, std::unordered_map<const void *, AccountedBuffer>::iterator it)
+{
+  const AccountedBuffer buffer = it->second;
+  state.m_Buffers.erase(it);
+  --state.m_NumberOfBuffers;
+
+  PipelineMemoryAccounting::Report & report = state.m_Report;
+  report.LiveNumberOfBytes -= buffer.m_NumberOfBytes;
+  if (buffer.m_Owner != NoOwner)
+  {
+    report.ProcessObjects[buffer.m_Owner].LiveNumberOfBytes -= buffer.m_NumberOfBytes;
+  }
+  else
+  {
+    report.UnattributedLiveNumberOfBytes -= buffer.m_NumberOfBytes;
+  }
+}
+} // namespace
+
+PipelineMemoryAccounting::OwnerScope::OwnerScope(const ProcessObject * filter)
+  : m_Active(GetState().m_Enabled && filter != nullptr)
+{
+  if (!m_Active)
+  {
+    return;
+  }
+  std::string name = filter->GetNameOfClass();
+  if (!filter->GetObjectName().empty())
+  {
+    name += ' ' + filter->GetObjectName();
+  }
+
+  PipelineMemoryAccountingState &   state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  const auto [it, inserted] = state.m_ProcessObjectIndices.emplace(filter, state.m_Report.ProcessObjects.size());
+  if (inserted)
+  {
+    state.m_Report.ProcessObjects.emplace_back();
+    state.m_HasProcessObjects = true;
+  }
+  ProcessObjectRecord & record = state.m_Report.ProcessObjects[it->second];
+  record.Name = std::move(name);
+  record.ReleaseDataFlag = filter->GetReleaseDataFlag();
+  ++record.NumberOfExecutions;
+
+  m_PreviousOwner = currentOwner;
+  currentOwner = it->second;
+}
+
+PipelineMemoryAccounting::OwnerScope::~OwnerScope()
+{
+  if (m_Active)
+  {
+    currentOwner = m_PreviousOwner;
+  }
+}
+
+void
+PipelineMemoryAccounting::SetEnabled(bool enabled)
+{
+  GetState().m_Enabled = enabled;
+}
+
+bool
+PipelineMemoryAccounting::GetEnabled()
+{
+  return GetState().m_Enabled;
+}
+
+void
+PipelineMemoryAccounting::Reset()
+{
+  PipelineMemoryAccountingState &   state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.m_Report = Report();
+  state.m_ProcessObjectIndices.clear();
+  state.m_Buffers.clear();
+  state.m_HasProcessObjects = false;
+  state.m_NumberOfBuffers = 0;
+}
+
+PipelineMemoryAccounting::Report
+PipelineMemoryAccounting::GetReport()
+{
+  PipelineMemoryAccountingState &   state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_Report;
+}
+
+void
+PipelineMemoryAccounting::RecordAllocation(const void * pointer, SizeValueType numberOfBytes)
+{
+  PipelineMemoryAccountingState & state = GetState();
+  if (!state.m_Enabled)
+  {
+    return;
+  }
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  Report &                          report = state.m_Report;
+  // The records are gone if the accounting was reset during the execution of the filter.
+  const size_t owner = (currentOwner < report.ProcessObjects.size()) ? currentOwner : NoOwner;
+
+  // A buffer at the same address was released without being accounted.
+  const auto stale = state.m_Buffers.find(pointer);
+  if (stale != state.m_Buffers.end())
+  {
+    ForgetBuffer(state, stale);
+  }
+  state.m_Buffers.emplace(pointer, AccountedBuffer{ owner, numberOfBytes });
+  ++state.m_NumberOfBuffers;
+
+  report.LiveNumberOfBytes += numberOfBytes;
+  if (owner != NoOwner)
+  {
+    ProcessObjectRecord & record = report.ProcessObjects[owner];
+    record.LiveNumberOfBytes += numberOfBytes;
+    record.AllocatedNumberOfBytes += numberOfBytes;
+    record.PeakNumberOfBytes = std::max(record.PeakNumberOfBytes, record.LiveNumberOfBytes);
+  }
+  else
+  {
+    report.UnattributedLiveNumberOfBytes += numberOfBytes;
+  }
+
+  if (report.LiveNumberOfBytes > report.PeakNumberOfBytes)
+  {
+    report.PeakNumberOfBytes = report.LiveNumberOfBytes;
+    report.UnattributedNumberOfBytesAtPipelinePeak = report.UnattributedLiveNumberOfBytes;
+    for (ProcessObjectRecord & record : report.ProcessObjects)
+    {
+      record.NumberOfBytesAtPipelinePeak = record.LiveNumberOfBytes;
+    }
+  }
+}
+
+void
+PipelineMemoryAccounting::RecordDeallocation(const void * pointer)
+{
+  // The buffers allocated while the accounting was enabled are still
+  // accounted when they are released after it is disabled.
+  PipelineMemoryAccountingState & state = GetState();
+  if (state.m_NumberOfBuffers == 0)
+  {
+    return;
+  }
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  const auto                        it = state.m_Buffers.find(pointer);
+  if (it != state.m_Buffers.end())
+  {
+    ForgetBuffer(state, it);
+  }
+}
+
+void
+PipelineMemoryAccounting::ForgetProcessObject(const ProcessObject * filter)
+{
+  PipelineMemoryAccountingState & state = GetState();
+  if (!state.m_HasProcessObjects)
+  {
+    return;
+  }
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  const auto                        it = state.m_ProcessObjectIndices.find(filter);
+  if (it != state.m_ProcessObjectIndices.end())
+  {
+    // A filter allocated later at the same address gets a new record.
+    state.m_Report.ProcessObjects[it->second].IsDestroyed = true;
+    state.m_ProcessObjectIndices.erase(it);
+  }
+}
+
+std::ostream &
+operator<<(std::ostream & out, const PipelineMemoryAccounting::Report & report)
+{
+  out << "Live bytes: " << report.LiveNumberOfBytes << ", Peak bytes: " << report.PeakNumberOfBytes
+      << ", Unattributed live bytes: " << report.UnattributedLiveNumberOfBytes
+      << ", Unattributed bytes at peak: " << report.UnattributedNumberOfBytesAtPipelinePeak << std::endl;
+
+  std::vector<const PipelineMemoryAccounting::ProcessObjectRecord *> records;
+  for (const auto & record : report.ProcessObjects)
+  {
+    records.push_back(&record);
+  }
+  std::stable_sort(records.begin(), records.end(), [](const auto * first, const auto * second) {
+    return first->NumberOfBytesAtPipelinePeak > second->NumberOfBytesAtPipelinePeak;
+  });
+  for (const auto * record : records)
+  {
+    const char * outputs = "none";
+    if (record->LiveNumberOfBytes > 0)
+    {
+      outputs = "retained";
+    }
+    else if (record->AllocatedNumberOfBytes > 0)
+    {
+      outputs = "released";
+    }
+    out << "  " << record->Name << ": Bytes at peak: " << record->NumberOfBytesAtPipelinePeak
+        << ", Peak bytes: " << record->PeakNumberOfBytes << ", Live bytes: " << record->LiveNumberOfBytes
+        << ", Allocated bytes: " << record->AllocatedNumberOfBytes << ", Executions: " << record->NumberOfExecutions
+        << ", ReleaseDataFlag: " << (record->ReleaseDataFlag ? "On" : "Off") << ", Outputs: " << outputs
+        << (record->IsDestroyed ? ", Destroyed" : "") << std::endl;
+  }
+  return out;
+}
+
+} // end namespace itk
@@ -0,0 +1,347 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPipelinePlanner.h"
+#include "itkImageBase.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace itk
+{
+namespace
+{
+constexpr size_t NoDataObject = std::numeric_limits<size_t>::max();
+
+struct DataObjectNode
+{
+  DataObject *    m_DataObject;
+  ProcessObject * m_Source;
+  SizeValueType   m_NumberOfConsumers{};
+  SizeValueType   m_NumberOfBytes{};
+  bool            m_IsSinkOutput{};
+};
+
+// The execution of a filter.
+struct ExecutionStep
+{
+  ProcessObject *     m_Filter;
+  std::vector<size_t> m_Inputs{};
+  std::vector<size_t> m_Outputs{};
+  size_t              m_PrimaryInput{ NoDataObject };
+};
+
+template <unsigned int VDimension>
+bool
+GetNumberOfBytes(const DataObject * dataObject, SizeValueType & numberOfBytes)
+{
+  const auto * image = dynamic_cast<const ImageBase<VDimension> *>(dataObject);
+  if (image == nullptr)
+  {
+    return false;
+  }
+  numberOfBytes = image->GetLargestPossibleRegion().GetNumberOfPixels() * image->GetNumberOfBytesPerPixel();
+  return true;
+}
+
+std::string
+GetName(const Object * object)
+{
+  std::string name = object->GetNameOfClass();
+  if (!object->GetObjectName().empty())
+  {
+    name += ' ' + object->GetObjectName();
+  }
+  return name;
+}
+
+// The data objects and the filters upstream of the sinks. Holds no
+// reference to the data objects, so that their reference counts tell
+// whether they are referenced outside of the pipeline.
+class PipelineGraph
+{
+public:
+  explicit PipelineGraph(const std::vector<ProcessObject::Pointer> & sinks)
+  {
+    for (const auto & sink : sinks)
+    {
+      m_Sinks.insert(sink.GetPointer());
+    }
+    for (const auto & sink : sinks)
+    {
+      this->Visit(sink.GetPointer());
+    }
+    for (DataObjectNode & node : m_Nodes)
+    {
+      GetNumberOfBytes<1>(node.m_DataObject, node.m_NumberOfBytes) ||
+        GetNumberOfBytes<2>(node.m_DataObject, node.m_NumberOfBytes) ||
+        GetNumberOfBytes<3>(node.m_DataObject, node.m_NumberOfBytes) ||
+        GetNumberOfBytes<4>(node.m_DataObject, node.m_NumberOfBytes);
+    }
+  }
+
+  std::vector<DataObjectNode> m_Nodes{};
+  // In the order of execution.
+  std::vector<ExecutionStep> m_Steps{};
+
+  // Whether the data object may be released after its use.
+  bool
+  IsReleasable(const DataObjectNode & node) const
+  {
+    // The references of the source and of the consumer.
+    constexpr int numberOfPipelineReferences = 2;
+    return node.m_Source != nullptr && !node.m_IsSinkOutput && node.m_NumberOfConsumers == 1 &&
+           node.m_DataObject->GetReferenceCount() <= numberOfPipelineReferences;
+  }
+
+  static bool
+  RunsInPlace(const ExecutionStep & step)
+  {
+    return step.m_PrimaryInput != NoDataObject && step.m_Filter->SupportsInPlaceExecution() &&
+           step.m_Filter->GetInPlaceExecution();
+  }
+
+  // Replays the execution of the filters with their current flags.
+  SizeValueType
+  ProjectPeakNumberOfBytes() const
+  {
+    std::vector<bool> isLive(m_Nodes.size());
+    SizeValueType     liveNumberOfBytes = 0;
+    for (size_t i = 0; i < m_Nodes.size(); ++i)
+    {
+      if (m_Nodes[i].m_Source == nullptr)
+      {
+        isLive[i] = true;
+        liveNumberOfBytes += m_Nodes[i].m_NumberOfBytes;
+      }
+    }
+    SizeValueType peakNumberOfBytes = liveNumberOfBytes;
+
+    for (const ExecutionStep & step : m_Steps)
+    {
+      // The primary input is grafted to the primary output.
+      if (RunsInPlace(step) && isLive[step.m_PrimaryInput])
+      {
+        isLive[step.m_PrimaryInput] = false;
+        liveNumberOfBytes -= m_Nodes[step.m_PrimaryInput].m_NumberOfBytes;
+      }
+      for (const size_t output : step.m_Outputs)
+      {
+        if (!isLive[output])
+        {
+          isLive[output] = true;
+          liveNumberOfBytes += m_Nodes[output].m_NumberOfBytes;
+        }
+      }
+      peakNumberOfBytes = std::max(peakNumberOfBytes, liveNumberOfBytes);
+
+      for (const size_t input : step.m_Inputs)
+      {
+        if (isLive[input] && m_Nodes[input].m_DataObject->ShouldIReleaseData())
+        {
+          isLive[input] = false;
+          liveNumberOfBytes -= m_Nodes[input].m_NumberOfBytes;
+        }
+      }
+    }
+    return peakNumberOfBytes;
+  }
+
+private:
+  std::unordered_set<const ProcessObject *>      m_Sinks{};
+  std::unordered_set<const ProcessObject *>      m_VisitedFilters{};
+  std::unordered_map<const DataObject *, size_t> m_NodeIndices{};
+
+  size_t
+  AddDataObject(DataObject * dataObject)
+  {
+    const auto [it, inserted] = m_NodeIndices.emplace(dataObject, m_Nodes.size());
+    if (inserted)
+    {
+      ProcessObject * source = dataObject->GetSource().GetPointer();
+      m_Nodes.push_back({ dataObject, source });
+      m_Nodes.back().m_IsSinkOutput = m_Sinks.count(source) > 0;
+    }
+    return it->second;
+  }
+
+  // Appends the filter after the filters it depends on, like
+  // ProcessObject::UpdateOutputData() executes them.
+  void
+  Visit(ProcessObject * filter)
+  {
+    if (!m_VisitedFilters.insert(filter).second)
+    {
+      return;
+    }
+    ExecutionStep step{ filter };
+
+    const DataObject * primaryInput = nullptr;
+    {
+      const ProcessObject::DataObjectPointerArray indexedInputs = filter->GetIndexedInputs();
+      if (!indexedInputs.empty())
+      {
+        primaryInput = indexedInputs.front().GetPointer();
+      }
+    }
+    std::vector<DataObject *> inputs;
+    for (const auto & input : filter->GetInputs())
+    {
+      if (input)
+      {
+        inputs.push_back(input.GetPointer());
+      }
+    }
+
+    for (DataObject * input : inputs)
+    {
+      if (ProcessObject * source = input->GetSource().GetPointer())
+      {
+        this->Visit(source);
+      }
+      const size_t index = this->AddDataObject(input);
+      ++m_Nodes[index].m_NumberOfConsumers;
+      if (std::find(step.m_Inputs.cbegin(), step.m_Inputs.cend(), index) == step.m_Inputs.cend())
+      {
+        step.m_Inputs.push_back(index);
+      }
+      if (input == primaryInput)
+      {
+        step.m_PrimaryInput = index;
+      }
+    }
+
+    for (const auto & output : filter->GetOutputs())
+    {
+      if (output)
+      {
+        step.m_Outputs.push_back(this->AddDataObject(output.GetPointer()));
+      }
+    }
+    m_Steps.push_back(std::move(step));
+  }
+};
+} // namespace
+
+void
+PipelinePlanner::AddSink(ProcessObject * sink)
+{
+  itkAssertOrThrowMacro(sink != nullptr, "The sink must not be null");
+  m_Sinks.emplace_back(sink);
+  this->Modified();
+}
+
+void
+PipelinePlanner::ClearSinks()
+{
+  m_Sinks.clear();
+  m_DataObjectPlans.clear();
+  m_ProjectedPeakNumberOfBytes = 0;
+  m_ProjectedPeakNumberOfBytesBeforePlanning = 0;
+  this->Modified();
+}
+
+void
+PipelinePlanner::Plan()
+{
+  if (m_Sinks.empty())
+  {
+    itkExceptionMacro("No sink to plan for");
+  }
+  for (const auto & sink : m_Sinks)
+  {
+    sink->UpdateOutputInformation();
+  }
+
+  const PipelineGraph graph(m_Sinks);
+  m_ProjectedPeakNumberOfBytesBeforePlanning = graph.ProjectPeakNumberOfBytes();
+
+  std::vector<bool> isReleasable(graph.m_Nodes.size());
+  for (size_t i = 0; i < graph.m_Nodes.size(); ++i)
+  {
+    isReleasable[i] = graph.IsReleasable(graph.m_Nodes[i]);
+    if (isReleasable[i])
+    {
+      graph.m_Nodes[i].m_DataObject->ReleaseDataFlagOn();
+    }
+  }
+  std::vector<bool> isConsumedInPlace(graph.m_Nodes.size());
+  for (const ExecutionStep & step : graph.m_Steps)
+  {
+    if (step.m_Filter->SupportsInPlaceExecution())
+    {
+      const bool inPlace = step.m_PrimaryInput != NoDataObject && isReleasable[step.m_PrimaryInput];
+      step.m_Filter->SetInPlaceExecution(inPlace);
+      if (inPlace)
+      {
+        isConsumedInPlace[step.m_PrimaryInput] = true;
+      }
+    }
+  }
+  m_ProjectedPeakNumberOfBytes = graph.ProjectPeakNumberOfBytes();
+
+  m_DataObjectPlans.clear();
+  for (size_t i = 0; i < graph.m_Nodes.size(); ++i)
+  {
+    const DataObjectNode & node = graph.m_Nodes[i];
+    DataObjectPlan         plan;
+    if (node.m_Source != nullptr)
+    {
+      plan.Name = GetName(node.m_Source) + ": " + node.m_DataObject->GetSourceOutputName();
+    }
+    else
+    {
+      plan.Name = GetName(node.m_DataObject);
+    }
+    plan.NumberOfConsumers = node.m_NumberOfConsumers;
+    plan.NumberOfBytes = node.m_NumberOfBytes;
+    plan.ReleaseData = node.m_DataObject->ShouldIReleaseData();
+    plan.ConsumedInPlace = isConsumedInPlace[i];
+    m_DataObjectPlans.push_back(std::move(plan));
+  }
+}
+
+void
+PipelinePlanner::Update()
+{
+  this->Plan();
+  for (const auto & sink : m_Sinks)
+  {
+    sink->Update();
+  }
+}
+
+void
+PipelinePlanner::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfSinks: " << m_Sinks.size() << std::endl;
+  os << indent << "ProjectedPeakNumberOfBytes: " << m_ProjectedPeakNumberOfBytes << std::endl;
+  os << indent << "ProjectedPeakNumberOfBytesBeforePlanning: " << m_ProjectedPeakNumberOfBytesBeforePlanning
+     << std::endl;
+  os << indent << "DataObjectPlans: " << std::endl;
+  for (const DataObjectPlan & plan : m_DataObjectPlans)
+  {
+    os << indent.GetNextIndent() << plan.Name << ": Consumers: " << plan.NumberOfConsumers
+       << ", Bytes: " << plan.NumberOfBytes << ", ReleaseData: " << (plan.ReleaseData ? "On" : "Off")
+       << ", ConsumedInPlace: " << (plan.ConsumedInPlace ? "On" : "Off") << std::endl;
+  }
+}
+} // end namespace itk
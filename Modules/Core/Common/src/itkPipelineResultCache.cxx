@@ -0,0 +1,847 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPipelineResultCache.h"
+#include "itkGlobalState.h"
+#include "itkImageBase.h"
+#include "itkProcessObject.h"
+#include "itksys/SystemTools.hxx"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace itk
+{
+namespace
+{
+// 128-bit hash of a byte stream, processed in 64-bit words.
+class Hasher
+{
+public:
+  void
+  Append(const void * data, size_t numberOfBytes)
+  {
+    const auto * bytes = static_cast<const unsigned char *>(data);
+    for (; numberOfBytes >= sizeof(uint64_t); numberOfBytes -= sizeof(uint64_t), bytes += sizeof(uint64_t))
+    {
+      uint64_t word;
+      std::memcpy(&word, bytes, sizeof(word));
+      this->AppendWord(word);
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, bytes, numberOfBytes);
+    this->AppendWord(tail ^ (uint64_t{ numberOfBytes } << 56));
+  }
+
+  void
+  Append(const std::string & value)
+  {
+    this->AppendValue(value.size());
+    this->Append(value.data(), value.size());
+  }
+
+  template <typename T>
+  void
+  AppendValue(const T & value)
+  {
+    this->Append(&value, sizeof(value));
+  }
+
+  template <typename T>
+  void
+  AppendValues(const std::vector<T> & values)
+  {
+    this->AppendValue(values.size());
+    this->Append(values.data(), values.size() * sizeof(T));
+  }
+
+  std::string
+  GetDigest() const
+  {
+    std::ostringstream digest;
+    digest << std::hex << std::setfill('0') << std::setw(16) << m_FirstHash << std::setw(16) << m_SecondHash;
+    return digest.str();
+  }
+
+private:
+  uint64_t m_FirstHash{ 0xcbf29ce484222325 };
+  uint64_t m_SecondHash{ 0x9e3779b97f4a7c15 };
+
+  void
+  AppendWord(uint64_t word)
+  {
+    m_FirstHash = (m_FirstHash ^ word) * 0x100000001b3;
+    m_SecondHash ^= word * 0xc2b2ae3d27d4eb4f;
+    m_SecondHash = ((m_SecondHash << 31) | (m_SecondHash >> 33)) * 0x9e3779b97f4a7c15;
+  }
+};
+
+// The information of an image, without its pixels.
+struct ImageMetaData
+{
+  std::string                 m_TypeName;
+  unsigned int                m_Dimension{};
+  std::vector<IndexValueType> m_Indices{};
+  // Largest possible, buffered and requested regions.
+  std::vector<SizeValueType> m_Sizes{};
+  std::vector<double>        m_Origin{};
+  std::vector<double>        m_Spacing{};
+  std::vector<double>        m_Direction{};
+  unsigned int               m_NumberOfComponentsPerPixel{};
+  SizeValueType              m_NumberOfBytesPerPixel{};
+  SizeValueType              m_NumberOfBytes{};
+
+  void
+  AppendTo(Hasher & hasher) const
+  {
+    hasher.Append(m_TypeName);
+    hasher.AppendValue(m_Dimension);
+    hasher.AppendValues(m_Indices);
+    hasher.AppendValues(m_Sizes);
+    hasher.AppendValues(m_Origin);
+    hasher.AppendValues(m_Spacing);
+    hasher.AppendValues(m_Direction);
+    hasher.AppendValue(m_NumberOfComponentsPerPixel);
+    hasher.AppendValue(m_NumberOfBytesPerPixel);
+    hasher.AppendValue(m_NumberOfBytes);
+  }
+};
+
+struct CachedImage
+{
+  ImageMetaData           m_MetaData;
+  std::unique_ptr<char[]> m_Pixels;
+};
+
+using CacheEntry = std::vector<CachedImage>;
+
+template <unsigned int VDimension>
+void
+AppendRegion(const ImageRegion<VDimension> & region, ImageMetaData & metaData)
+{
+  for (unsigned int d = 0; d < VDimension; ++d)
+  {
+    metaData.m_Indices.push_back(region.GetIndex(d));
+    metaData.m_Sizes.push_back(region.GetSize(d));
+  }
+}
+
+// Describes the image, and gets its pixels, when it is an ImageBase<VDimension>.
+template <unsigned int VDimension>
+bool
+DescribeImage(const DataObject * object, ImageMetaData & metaData, const void *& pixels)
+{
+  const auto * image = dynamic_cast<const ImageBase<VDimension> *>(object);
+  if (image == nullptr)
+  {
+    return false;
+  }
+  metaData.m_TypeName = typeid(*image).name();
+  metaData.m_Dimension = VDimension;
+  AppendRegion(image->GetLargestPossibleRegion(), metaData);
+  AppendRegion(image->GetBufferedRegion(), metaData);
+  AppendRegion(image->GetRequestedRegion(), metaData);
+  for (unsigned int i = 0; i < VDimension; ++i)
+  {
+    metaData.m_Origin.push_back(image->GetOrigin()[i]);
+    metaData.m_Spacing.push_back(image->GetSpacing()[i]);
+    for (unsigned int j = 0; j < VDimension; ++j)
+    {
+      metaData.m_Direction.push_back(image->GetDirection()[i][j]);
+    }
+  }
+  metaData.m_NumberOfComponentsPerPixel = image->GetNumberOfComponentsPerPixel();
+  metaData.m_NumberOfBytesPerPixel = image->GetNumberOfBytesPerPixel();
+  metaData.m_NumberOfBytes = image->GetBufferedRegion().GetNumberOfPixels() * metaData.m_NumberOfBytesPerPixel;
+  pixels = image->GetBufferBytes();
+  return true;
+}
+
+// Returns false when the object is not an image whose pixels can be copied.
+bool
+DescribeImage(const DataObject * object, ImageMetaData & metaData, const void *& pixels)
+{
+  pixels = nullptr;
+  const bool isImage = DescribeImage<1>(object, metaData, pixels) || DescribeImage<2>(object, metaData, pixels) ||
+                       DescribeImage<3>(object, metaData, pixels) || DescribeImage<4>(object, metaData, pixels);
+  return isImage && (pixels != nullptr || metaData.m_NumberOfBytes == 0);
+}
+
+// Whether the number of bytes of the image is the one of its buffered region.
+bool
+HasConsistentNumberOfBytes(const ImageMetaData & metaData)
+{
+  SizeValueType numberOfBytes = metaData.m_NumberOfBytesPerPixel;
+  for (unsigned int d = 0; d < metaData.m_Dimension; ++d)
+  {
+    const SizeValueType size = metaData.m_Sizes[metaData.m_Dimension + d];
+    if (size != 0 && numberOfBytes > std::numeric_limits<SizeValueType>::max() / size)
+    {
+      return false;
+    }
+    numberOfBytes *= size;
+  }
+  return numberOfBytes == metaData.m_NumberOfBytes;
+}
+
+// Whether the cached image can be copied to the output: the type, the pixel
+// size and the requested region of the output must be the cached ones, and
+// the cached pixels must fill the buffered region.
+bool
+MatchesOutput(const CachedImage & cachedImage, const DataObject * output)
+{
+  const ImageMetaData & metaData = cachedImage.m_MetaData;
+  ImageMetaData         outputMetaData;
+  const void *          pixels;
+  DescribeImage(output, outputMetaData, pixels);
+  if (metaData.m_TypeName != outputMetaData.m_TypeName || metaData.m_Dimension != outputMetaData.m_Dimension ||
+      metaData.m_NumberOfComponentsPerPixel != outputMetaData.m_NumberOfComponentsPerPixel ||
+      metaData.m_NumberOfBytesPerPixel != outputMetaData.m_NumberOfBytesPerPixel)
+  {
+    return false;
+  }
+  const size_t requestedRegionStart = 2 * metaData.m_Dimension;
+  return std::equal(metaData.m_Indices.cbegin() + requestedRegionStart,
+                    metaData.m_Indices.cend(),
+                    outputMetaData.m_Indices.cbegin() + requestedRegionStart) &&
+         std::equal(metaData.m_Sizes.cbegin() + requestedRegionStart,
+                    metaData.m_Sizes.cend(),
+                    outputMetaData.m_Sizes.cbegin() + requestedRegionStart) &&
+         HasConsistentNumberOfBytes(metaData);
+}
+
+template <unsigned int VDimension>
+ImageRegion<VDimension>
+GetRegion(const ImageMetaData & metaData, unsigned int regionNumber)
+{
+  ImageRegion<VDimension> region;
+  for (unsigned int d = 0; d < VDimension; ++d)
+  {
+    region.SetIndex(d, metaData.m_Indices[regionNumber * VDimension + d]);
+    region.SetSize(d, metaData.m_Sizes[regionNumber * VDimension + d]);
+  }
+  return region;
+}
+
+// Copies the cached image to the output, when it is an ImageBase<VDimension>.
+template <unsigned int VDimension>
+bool
+RestoreImage(const CachedImage & cachedImage, DataObject * output)
+{
+  auto * image = dynamic_cast<ImageBase<VDimension> *>(output);
+  if (image == nullptr)
+  {
+    return false;
+  }
+  const ImageMetaData & metaData = cachedImage.m_MetaData;
+  typename ImageBase<VDimension>::PointType     origin;
+  typename ImageBase<VDimension>::SpacingType   spacing;
+  typename ImageBase<VDimension>::DirectionType direction;
+  for (unsigned int i = 0; i < VDimension; ++i)
+  {
+    origin[i] = metaData.m_Origin[i];
+    spacing[i] = metaData.m_Spacing[i];
+    for (unsigned int j = 0; j < VDimension; ++j)
+    {
+      direction[i][j] = metaData.m_Direction[i * VDimension + j];
+    }
+  }
+  image->SetOrigin(origin);
+  image->SetSpacing(spacing);
+  image->SetDirection(direction);
+  image->SetNumberOfComponentsPerPixel(metaData.m_NumberOfComponentsPerPixel);
+  image->SetLargestPossibleRegion(GetRegion<VDimension>(metaData, 0));
+  image->SetBufferedRegion(GetRegion<VDimension>(metaData, 1));
+  image->SetRequestedRegion(GetRegion<VDimension>(metaData, 2));
+  image->Allocate();
+  if (metaData.m_NumberOfBytes > 0)
+  {
+    std::memcpy(image->GetBufferBytes(), cachedImage.m_Pixels.get(), metaData.m_NumberOfBytes);
+  }
+  return true;
+}
+
+// The lines printed by the Print() of a data object which describe the state
+// of the pipeline, rather than its content. Their nested lines are skipped
+// too.
+const std::unordered_set<std::string> &
+GetPipelineStateLabels()
+{
+  static const std::unordered_set<std::string> labels{ // LightObject and Object
+                                                        "RTTI typeinfo",
+                                                        "Reference Count",
+                                                        "Modified Time",
+                                                        "Debug",
+                                                        "Object Name",
+                                                        "Observers",
+                                                        // DataObject
+                                                        "Source",
+                                                        "Source output name",
+                                                        "Release Data",
+                                                        "Data Released",
+                                                        "Global Release Data",
+                                                        "PipelineMTime",
+                                                        "UpdateMTime",
+                                                        "RealTimeStamp"
+  };
+  return labels;
+}
+
+// The content of the decorator, printed at full precision, without the
+// state of the pipeline and without the addresses of the objects.
+std::string
+PrintContent(const DataObject * object)
+{
+  std::ostringstream printed;
+  printed << std::setprecision(std::numeric_limits<double>::max_digits10);
+  object->Print(printed);
+
+  const auto &       labels = GetPipelineStateLabels();
+  std::istringstream lines(printed.str());
+  std::string        parameters;
+  std::string        line;
+  size_t             skippedIndentation = std::string::npos;
+  while (std::getline(lines, line))
+  {
+    const size_t indentation = line.find_first_not_of(' ');
+    if (indentation == std::string::npos)
+    {
+      continue;
+    }
+    if (skippedIndentation != std::string::npos)
+    {
+      if (indentation > skippedIndentation)
+      {
+        continue;
+      }
+      skippedIndentation = std::string::npos;
+    }
+    const size_t colon = line.find(':', indentation);
+    if (labels.count(line.substr(indentation, colon == std::string::npos ? std::string::npos : colon - indentation)))
+    {
+      skippedIndentation = indentation;
+      continue;
+    }
+    // The header of an object, "ClassName (address)".
+    const size_t addressStart = line.rfind(" (");
+    if (colon == std::string::npos && addressStart != std::string::npos && line.back() == ')')
+    {
+      line.erase(addressStart);
+    }
+    parameters += line;
+    parameters += '\n';
+  }
+  return parameters;
+}
+
+bool
+IsDecorator(const DataObject * object)
+{
+  const std::string className = object->GetNameOfClass();
+  return className == "DataObjectDecorator" || className == "SimpleDataObjectDecorator";
+}
+
+// Binary serialization of the entries in the directory.
+constexpr char FileSignature[] = "ITKPipelineResultCache1";
+
+template <typename T>
+void
+WriteValue(std::ostream & file, const T & value)
+{
+  file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T>
+void
+WriteValues(std::ostream & file, const std::vector<T> & values)
+{
+  WriteValue(file, static_cast<uint64_t>(values.size()));
+  file.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+bool
+ReadValue(std::istream & file, T & value)
+{
+  return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(value)));
+}
+
+template <typename T>
+bool
+ReadValues(std::istream & file, std::vector<T> & values)
+{
+  uint64_t size = 0;
+  if (!ReadValue(file, size) || size > (uint64_t{ 1 } << 20))
+  {
+    return false;
+  }
+  values.resize(size);
+  return static_cast<bool>(file.read(reinterpret_cast<char *>(values.data()), size * sizeof(T)));
+}
+
+bool
+WriteEntry(const std::string & fileName, const CacheEntry & entry)
+{
+  // Written to a temporary file first, so that other processes never read
+  // a partial entry.
+  const std::string temporaryFileName = fileName + ".tmp" + std::to_string(reinterpret_cast<uintptr_t>(&entry));
+  {
+    std::ofstream file(temporaryFileName, std::ios::binary);
+    file.write(FileSignature, sizeof(FileSignature));
+    WriteValue(file, static_cast<uint64_t>(entry.size()));
+    for (const CachedImage & image : entry)
+    {
+      const ImageMetaData & metaData = image.m_MetaData;
+      WriteValues(file, std::vector<char>(metaData.m_TypeName.cbegin(), metaData.m_TypeName.cend()));
+      WriteValue(file, metaData.m_Dimension);
+      WriteValues(file, metaData.m_Indices);
+      WriteValues(file, metaData.m_Sizes);
+      WriteValues(file, metaData.m_Origin);
+      WriteValues(file, metaData.m_Spacing);
+      WriteValues(file, metaData.m_Direction);
+      WriteValue(file, metaData.m_NumberOfComponentsPerPixel);
+      WriteValue(file, metaData.m_NumberOfBytesPerPixel);
+      WriteValue(file, metaData.m_NumberOfBytes);
+      file.write(image.m_Pixels.get(), metaData.m_NumberOfBytes);
+    }
+    file.close();
+    if (!file)
+    {
+      itksys::SystemTools::RemoveFile(temporaryFileName);
+      return false;
+    }
+  }
+  if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0)
+  {
+    itksys::SystemTools::RemoveFile(temporaryFileName);
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<const CacheEntry>
+ReadEntry(std::istream & file, const uint64_t fileSize)
+{
+  char signature[sizeof(FileSignature)];
+  if (!file.read(signature, sizeof(signature)) || std::memcmp(signature, FileSignature, sizeof(signature)) != 0)
+  {
+    return nullptr;
+  }
+  uint64_t numberOfImages = 0;
+  if (!ReadValue(file, numberOfImages) || numberOfImages > 1024)
+  {
+    return nullptr;
+  }
+  auto entry = std::make_shared<CacheEntry>(numberOfImages);
+  for (CachedImage & image : *entry)
+  {
+    ImageMetaData &   metaData = image.m_MetaData;
+    std::vector<char> typeName;
+    if (!ReadValues(file, typeName) || !ReadValue(file, metaData.m_Dimension) ||
+        !ReadValues(file, metaData.m_Indices) || !ReadValues(file, metaData.m_Sizes) ||
+        !ReadValues(file, metaData.m_Origin) || !ReadValues(file, metaData.m_Spacing) ||
+        !ReadValues(file, metaData.m_Direction) || !ReadValue(file, metaData.m_NumberOfComponentsPerPixel) ||
+        !ReadValue(file, metaData.m_NumberOfBytesPerPixel) || !ReadValue(file, metaData.m_NumberOfBytes))
+    {
+      return nullptr;
+    }
+    metaData.m_TypeName.assign(typeName.cbegin(), typeName.cend());
+    const size_t dimension = metaData.m_Dimension;
+    if (dimension == 0 || dimension > 4 || metaData.m_Indices.size() != 3 * dimension ||
+        metaData.m_Sizes.size() != 3 * dimension || metaData.m_Origin.size() != dimension ||
+        metaData.m_Spacing.size() != dimension || metaData.m_Direction.size() != dimension * dimension ||
+        !HasConsistentNumberOfBytes(metaData) || metaData.m_NumberOfBytes > fileSize)
+    {
+      return nullptr;
+    }
+    image.m_Pixels.reset(new char[metaData.m_NumberOfBytes]);
+    if (!file.read(image.m_Pixels.get(), metaData.m_NumberOfBytes))
+    {
+      return nullptr;
+    }
+  }
+  return entry;
+}
+
+// Reads the entry of the directory. The entries which are truncated or
+// corrupt are removed, as they could never be read.
+std::shared_ptr<const CacheEntry>
+ReadEntry(const std::string & fileName)
+{
+  std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    return nullptr;
+  }
+  const auto fileSize = static_cast<uint64_t>(file.tellg());
+  file.seekg(0);
+  auto entry = ReadEntry(file, fileSize);
+  if (!entry)
+  {
+    file.close();
+    itksys::SystemTools::RemoveFile(fileName);
+  }
+  return entry;
+}
+
+struct PipelineResultCacheState
+{
+  PipelineResultCacheState()
+  {
+    std::string directory;
+    if (itksys::SystemTools::GetEnv("ITK_PIPELINE_RESULT_CACHE_DIRECTORY", directory))
+    {
+      m_Directory = directory;
+    }
+  }
+
+  std::mutex m_Mutex;
+  // Guarded by m_Mutex, like the entries.
+  SizeValueType                  m_MaximumNumberOfBytes{ SizeValueType{ 1 } << 30 };
+  std::string                    m_Directory;
+  PipelineResultCache::Statistics m_Statistics;
+
+  // From the least to the most recently used.
+  std::list<std::string> m_RecentlyUsedKeys;
+  struct Entry
+  {
+    std::shared_ptr<const CacheEntry>      m_Images;
+    SizeValueType                          m_NumberOfBytes;
+    std::list<std::string>::const_iterator m_RecentlyUsedKey;
+  };
+  std::unordered_map<std::string, Entry> m_Entries;
+
+  void
+  Insert(const std::string & key, std::shared_ptr<const CacheEntry> images, SizeValueType numberOfBytes)
+  {
+    if (numberOfBytes > m_MaximumNumberOfBytes || m_Entries.count(key) > 0)
+    {
+      return;
+    }
+    m_RecentlyUsedKeys.push_back(key);
+    m_Entries.emplace(key, Entry{ std::move(images), numberOfBytes, std::prev(m_RecentlyUsedKeys.cend()) });
+    ++m_Statistics.NumberOfEntries;
+    m_Statistics.NumberOfBytes += numberOfBytes;
+    this->Evict(m_MaximumNumberOfBytes);
+  }
+
+  void
+  Evict(SizeValueType maximumNumberOfBytes)
+  {
+    while (m_Statistics.NumberOfBytes > maximumNumberOfBytes)
+    {
+      ++m_Statistics.Evictions;
+      this->Erase(m_RecentlyUsedKeys.front());
+    }
+  }
+
+  void
+  Erase(const std::string & key)
+  {
+    const auto it = m_Entries.find(key);
+    if (it == m_Entries.end())
+    {
+      return;
+    }
+    m_Statistics.NumberOfBytes -= it->second.m_NumberOfBytes;
+    --m_Statistics.NumberOfEntries;
+    m_RecentlyUsedKeys.erase(it->second.m_RecentlyUsedKey);
+    m_Entries.erase(it);
+  }
+};
+
+PipelineResultCacheState &
+GetState()
+{
+  return GetNeverDestroyedInstance<PipelineResultCacheState>();
+}
+} // namespace
+
+void
+PipelineResultCache::SetMaximumNumberOfBytes(SizeValueType numberOfBytes)
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.m_MaximumNumberOfBytes = numberOfBytes;
+  state.Evict(numberOfBytes);
+}
+
+SizeValueType
+PipelineResultCache::GetMaximumNumberOfBytes()
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_MaximumNumberOfBytes;
+}
+
+void
+PipelineResultCache::SetDirectory(const std::string & directory)
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.m_Directory = directory;
+}
+
+std::string
+PipelineResultCache::GetDirectory()
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_Directory;
+}
+
+PipelineResultCache::Statistics
+PipelineResultCache::GetStatistics()
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_Statistics;
+}
+
+void
+PipelineResultCache::Clear()
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.m_Entries.clear();
+  state.m_RecentlyUsedKeys.clear();
+  state.m_Statistics = Statistics();
+}
+
+namespace
+{
+std::string
+CountUncacheable()
+{
+  PipelineResultCacheState &        state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  ++state.m_Statistics.Uncacheable;
+  return {};
+}
+} // namespace
+
+std::string
+PipelineResultCache::ComputeKey(ProcessObject * filter)
+{
+  if (!filter->CanUseResultCache())
+  {
+    return CountUncacheable();
+  }
+
+  std::ostringstream parameters;
+  parameters << std::setprecision(std::numeric_limits<double>::max_digits10);
+  filter->PrintResultCacheParameters(parameters);
+
+  Hasher hasher;
+  hasher.Append(std::string(typeid(*filter).name()));
+  hasher.Append(parameters.str());
+
+  const ProcessObject::NameArray              inputNames = filter->GetInputNames();
+  const ProcessObject::DataObjectPointerArray inputs = filter->GetInputs();
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    hasher.Append(inputNames[i]);
+    if (!inputs[i])
+    {
+      continue;
+    }
+    ImageMetaData metaData;
+    const void *  pixels;
+    if (DescribeImage(inputs[i], metaData, pixels))
+    {
+      metaData.AppendTo(hasher);
+      hasher.Append(pixels, metaData.m_NumberOfBytes);
+    }
+    else if (IsDecorator(inputs[i]))
+    {
+      hasher.Append(std::string(typeid(*inputs[i]).name()));
+      hasher.Append(PrintContent(inputs[i]));
+    }
+    else
+    {
+      return CountUncacheable();
+    }
+  }
+
+  const ProcessObject::NameArray              outputNames = filter->GetOutputNames();
+  const ProcessObject::DataObjectPointerArray outputs = filter->GetOutputs();
+  for (size_t i = 0; i < outputs.size(); ++i)
+  {
+    hasher.Append(outputNames[i]);
+    if (outputs[i])
+    {
+      ImageMetaData metaData;
+      const void *  pixels;
+      DescribeImage(outputs[i], metaData, pixels);
+      // Only images are restored, so the filters with other outputs, like
+      // decorated results, are not cached.
+      if (metaData.m_TypeName.empty())
+      {
+        return CountUncacheable();
+      }
+      hasher.Append(std::string(typeid(*outputs[i]).name()));
+      hasher.AppendValues(metaData.m_Indices);
+      hasher.AppendValues(metaData.m_Sizes);
+    }
+  }
+  return hasher.GetDigest();
+}
+
+bool
+PipelineResultCache::Restore(ProcessObject * filter, const std::string & key)
+{
+  PipelineResultCacheState &        state = GetState();
+  std::shared_ptr<const CacheEntry> entry;
+  std::string                       directory;
+  {
+    const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+    const auto                        it = state.m_Entries.find(key);
+    if (it != state.m_Entries.end())
+    {
+      entry = it->second.m_Images;
+      std::list<std::string> & recentlyUsedKeys = state.m_RecentlyUsedKeys;
+      recentlyUsedKeys.splice(recentlyUsedKeys.cend(), recentlyUsedKeys, it->second.m_RecentlyUsedKey);
+    }
+    directory = state.m_Directory;
+  }
+
+  bool              isFromDirectory = false;
+  const std::string fileName = directory + '/' + key + ".itkcache";
+  if (!entry && !directory.empty())
+  {
+    entry = ReadEntry(fileName);
+    isFromDirectory = (entry != nullptr);
+  }
+
+  // The outputs must match the cached images, which are checked before their
+  // pixels are copied, as the entries of the directory may come from another
+  // version of the filter, or be corrupt.
+  const ProcessObject::DataObjectPointerArray outputs = filter->GetOutputs();
+  size_t                                      numberOfOutputs = 0;
+  bool                                        matches = (entry != nullptr);
+  for (const auto & output : outputs)
+  {
+    if (output && matches)
+    {
+      matches = numberOfOutputs < entry->size() && MatchesOutput((*entry)[numberOfOutputs], output);
+      ++numberOfOutputs;
+    }
+  }
+  if (!matches || numberOfOutputs != entry->size())
+  {
+    // The entry which does not match is removed, to be replaced by Store().
+    if (isFromDirectory)
+    {
+      itksys::SystemTools::RemoveFile(fileName);
+    }
+    const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+    if (entry && !isFromDirectory)
+    {
+      state.Erase(key);
+    }
+    ++state.m_Statistics.Misses;
+    return false;
+  }
+
+  size_t        imageNumber = 0;
+  SizeValueType numberOfBytes = 0;
+  for (const auto & output : outputs)
+  {
+    if (output)
+    {
+      const CachedImage & image = (*entry)[imageNumber++];
+      RestoreImage<1>(image, output) || RestoreImage<2>(image, output) || RestoreImage<3>(image, output) ||
+        RestoreImage<4>(image, output);
+      numberOfBytes += image.m_MetaData.m_NumberOfBytes;
+    }
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  ++state.m_Statistics.Hits;
+  if (isFromDirectory)
+  {
+    ++state.m_Statistics.DirectoryHits;
+    state.Insert(key, std::move(entry), numberOfBytes);
+  }
+  return true;
+}
+
+void
+PipelineResultCache::Store(ProcessObject * filter, const std::string & key)
+{
+  auto          entry = std::make_shared<CacheEntry>();
+  SizeValueType numberOfBytes = 0;
+  for (const auto & output : filter->GetOutputs())
+  {
+    if (!output)
+    {
+      continue;
+    }
+    CachedImage  image;
+    const void * pixels;
+    if (!DescribeImage(output, image.m_MetaData, pixels))
+    {
+      return;
+    }
+    image.m_Pixels.reset(new char[image.m_MetaData.m_NumberOfBytes]);
+    if (image.m_MetaData.m_NumberOfBytes > 0)
+    {
+      std::memcpy(image.m_Pixels.get(), pixels, image.m_MetaData.m_NumberOfBytes);
+    }
+    numberOfBytes += image.m_MetaData.m_NumberOfBytes;
+    entry->push_back(std::move(image));
+  }
+
+  PipelineResultCacheState & state = GetState();
+  std::string                directory;
+  {
+    const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+    directory = state.m_Directory;
+  }
+  // A failure to write the entry only prevents its reuse by other processes.
+  if (!directory.empty() && itksys::SystemTools::MakeDirectory(directory))
+  {
+    WriteEntry(directory + '/' + key + ".itkcache", *entry);
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.Insert(key, std::move(entry), numberOfBytes);
+}
+
+std::ostream &
+operator<<(std::ostream & out, const PipelineResultCache::Statistics & statistics)
+{
+  return out << "Hits: " << statistics.Hits << ", DirectoryHits: " << statistics.DirectoryHits
+             << ", Misses: " << statistics.Misses << ", Uncacheable: " << statistics.Uncacheable
+             << ", Evictions: " << statistics.Evictions << ", NumberOfEntries: " << statistics.NumberOfEntries
+             << ", NumberOfBytes: " << statistics.NumberOfBytes;
+}
+
+} // end namespace itk
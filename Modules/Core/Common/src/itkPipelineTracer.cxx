@@ -0,0 +1,322 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPipelineTracer.h"
+#include "itkGlobalState.h"
+#include "itkImageBase.h"
+#include "itkProcessObject.h"
+#include "itksys/SystemTools.hxx"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+
+namespace itk
+{
+namespace
+{
+struct PipelineTracerState
+{
+  PipelineTracerState();
+
+  std::atomic<bool>                           m_Enabled{ false };
+  std::atomic<SizeValueType>                  m_MaximumNumberOfEvents{ 1000000 };
+  std::atomic<unsigned int>                   m_NumberOfThreads{ 0 };
+  const std::chrono::steady_clock::time_point m_Origin{ std::chrono::steady_clock::now() };
+
+  // The file written at exit, from the ITK_PIPELINE_TRACE environment variable.
+  std::string m_FileName;
+
+  std::mutex m_Mutex;
+  // Guarded by m_Mutex, like m_NumberOfDroppedEvents.
+  std::vector<PipelineTracer::Event> m_Events;
+  SizeValueType                      m_NumberOfDroppedEvents{};
+};
+
+PipelineTracerState &
+GetState()
+{
+  return GetNeverDestroyedInstance<PipelineTracerState>();
+}
+
+void
+WriteTraceAtExit()
+{
+  try
+  {
+    PipelineTracer::WriteChromeTrace(GetState().m_FileName);
+  }
+  catch (const std::exception & e)
+  {
+    std::cerr << "Could not write the pipeline trace: " << e.what() << std::endl;
+  }
+}
+
+PipelineTracerState::PipelineTracerState()
+{
+  std::string fileName;
+  if (itksys::SystemTools::GetEnv("ITK_PIPELINE_TRACE", fileName) && !fileName.empty())
+  {
+    m_FileName = fileName;
+    m_Enabled = true;
+    std::atexit(WriteTraceAtExit);
+  }
+}
+
+// Bytes of image buffers allocated by the thread while the tracer is enabled.
+thread_local SizeValueType numberOfBytesAllocatedByThread = 0;
+thread_local unsigned int  traceThreadId = 0;
+
+unsigned int
+GetTraceThreadId()
+{
+  if (traceThreadId == 0)
+  {
+    traceThreadId = ++GetState().m_NumberOfThreads;
+  }
+  return traceThreadId;
+}
+
+double
+GetTimeStamp()
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - GetState().m_Origin).count();
+}
+
+template <unsigned int VDimension>
+bool
+DescribeRequestedRegion(const DataObject * output, std::string & region)
+{
+  const auto * image = dynamic_cast<const ImageBase<VDimension> *>(output);
+  if (image == nullptr)
+  {
+    return false;
+  }
+  const ImageRegion<VDimension> & requestedRegion = image->GetRequestedRegion();
+  region =
+    PipelineTracer::RegionToString(VDimension, requestedRegion.GetIndex().data(), requestedRegion.GetSize().data());
+  return true;
+}
+
+void
+WriteJSONString(std::ostream & os, const std::string & value)
+{
+  os << '"';
+  for (const char c : value)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+      os << escaped;
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+} // namespace
+
+PipelineTracer::Scope::Scope(const ProcessObject * filter, const char * category)
+  : m_Active(GetState().m_Enabled)
+{
+  if (m_Active)
+  {
+    if (filter)
+    {
+      m_Event.Name = filter->GetNameOfClass();
+      if (!filter->GetObjectName().empty())
+      {
+        m_Event.Name += ' ' + filter->GetObjectName();
+      }
+    }
+    else
+    {
+      m_Event.Name = category;
+    }
+    m_Event.Category = category;
+    m_Event.ThreadId = GetTraceThreadId();
+    m_NumberOfBytesAllocatedAtStart = numberOfBytesAllocatedByThread;
+    m_Event.StartTime = GetTimeStamp();
+  }
+}
+
+PipelineTracer::Scope::~Scope()
+{
+  if (!m_Active)
+  {
+    return;
+  }
+  m_Event.Duration = GetTimeStamp() - m_Event.StartTime;
+  m_Event.NumberOfBytesAllocated = numberOfBytesAllocatedByThread - m_NumberOfBytesAllocatedAtStart;
+
+  PipelineTracerState &             state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  try
+  {
+    if (state.m_Events.size() < state.m_MaximumNumberOfEvents)
+    {
+      state.m_Events.push_back(std::move(m_Event));
+      return;
+    }
+  }
+  catch (const std::bad_alloc &)
+  {
+    // Dropped, like the events beyond the maximum.
+  }
+  ++state.m_NumberOfDroppedEvents;
+}
+
+void
+PipelineTracer::Scope::SetRequestedRegion(const DataObject * output)
+{
+  if (m_Active)
+  {
+    DescribeRequestedRegion<1>(output, m_Event.Region) || DescribeRequestedRegion<2>(output, m_Event.Region) ||
+      DescribeRequestedRegion<3>(output, m_Event.Region) || DescribeRequestedRegion<4>(output, m_Event.Region);
+  }
+}
+
+void
+PipelineTracer::SetEnabled(bool enabled)
+{
+  GetState().m_Enabled = enabled;
+}
+
+bool
+PipelineTracer::GetEnabled()
+{
+  return GetState().m_Enabled;
+}
+
+void
+PipelineTracer::SetMaximumNumberOfEvents(SizeValueType numberOfEvents)
+{
+  GetState().m_MaximumNumberOfEvents = numberOfEvents;
+}
+
+SizeValueType
+PipelineTracer::GetMaximumNumberOfEvents()
+{
+  return GetState().m_MaximumNumberOfEvents;
+}
+
+std::vector<PipelineTracer::Event>
+PipelineTracer::GetEvents()
+{
+  PipelineTracerState &             state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_Events;
+}
+
+SizeValueType
+PipelineTracer::GetNumberOfDroppedEvents()
+{
+  PipelineTracerState &             state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  return state.m_NumberOfDroppedEvents;
+}
+
+void
+PipelineTracer::Clear()
+{
+  PipelineTracerState &             state = GetState();
+  const std::lock_guard<std::mutex> lockGuard(state.m_Mutex);
+  state.m_Events.clear();
+  state.m_NumberOfDroppedEvents = 0;
+}
+
+void
+PipelineTracer::WriteChromeTrace(std::ostream & os)
+{
+  const std::vector<Event> events = GetEvents();
+
+  // Complete events ("X"), with times in microseconds.
+  std::ostringstream trace;
+  trace << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  const char * separator = "\n";
+  for (const Event & event : events)
+  {
+    trace << separator << "{\"name\":";
+    WriteJSONString(trace, event.Name);
+    trace << ",\"cat\":";
+    WriteJSONString(trace, event.Category);
+    trace << ",\"ph\":\"X\",\"ts\":" << event.StartTime << ",\"dur\":" << event.Duration
+          << ",\"pid\":1,\"tid\":" << event.ThreadId << ",\"args\":{\"region\":";
+    WriteJSONString(trace, event.Region);
+    trace << ",\"bytesAllocated\":" << event.NumberOfBytesAllocated << "}}";
+    separator = ",\n";
+  }
+  trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os << trace.str();
+}
+
+void
+PipelineTracer::WriteChromeTrace(const std::string & fileName)
+{
+  std::ofstream file(fileName);
+  if (!file)
+  {
+    itkGenericExceptionMacro("Cannot open the trace file " << fileName);
+  }
+  WriteChromeTrace(file);
+  file.close();
+  if (!file)
+  {
+    itkGenericExceptionMacro("Cannot write the trace file " << fileName);
+  }
+}
+
+void
+PipelineTracer::AddNumberOfBytesAllocated(SizeValueType numberOfBytes)
+{
+  if (GetState().m_Enabled)
+  {
+    numberOfBytesAllocatedByThread += numberOfBytes;
+  }
+}
+
+std::string
+PipelineTracer::RegionToString(unsigned int dimension, const IndexValueType index[], const SizeValueType size[])
+{
+  std::ostringstream region;
+  region << '[';
+  for (unsigned int d = 0; d < dimension; ++d)
+  {
+    region << (d > 0 ? ", " : "") << index[d];
+  }
+  region << "] [";
+  for (unsigned int d = 0; d < dimension; ++d)
+  {
+    region << (d > 0 ? ", " : "") << size[d];
+  }
+  region << ']';
+  return region.str();
+}
+} // end namespace itk
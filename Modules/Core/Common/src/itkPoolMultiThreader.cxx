@@ -30,6 +30,7 @@
 #include "itkProcessObject.h"
 #include "itkImageSourceCommon.h"
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <iostream>
 #include <string>
@@ -39,6 +40,7 @@ namespace itk
 namespace
 {
 std::chrono::milliseconds threadCompletionPollingInterval = std::chrono::milliseconds(10);
+std::chrono::milliseconds nestedThreadCompletionPollingInterval = std::chrono::milliseconds(1);
 
 class ExceptionHandler
 {
@@ -147,7 +149,8 @@ PoolMultiThreader::SingleMethodExecute()
   // so now it waits for each of the other work units to finish
   for (threadLoop = 1; threadLoop < m_NumberOfWorkUnits; ++threadLoop)
   {
-    exceptionHandler.TryAndCatch([this, threadLoop] { m_ThreadInfoArray[threadLoop].Future.get(); });
+    exceptionHandler.TryAndCatch(
+      [this, threadLoop] { this->WaitForWorkUnit(m_ThreadInfoArray[threadLoop].Future, nullptr); });
   }
 
   exceptionHandler.RethrowFirstCaughtException();
@@ -200,16 +203,8 @@ PoolMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
     // now wait for the other computations to finish
     for (SizeValueType i = 1; i < workUnit; ++i)
     {
-      exceptionHandler.TryAndCatch([this, i, &reporter, &filter] {
-        std::future_status status;
-        do
-        {
-          status = m_ThreadInfoArray[i].Future.wait_for(threadCompletionPollingInterval);
-          if (filter && status == std::future_status::timeout)
-          {
-            filter->IncrementProgress(0);
-          }
-        } while (status != std::future_status::ready);
+      exceptionHandler.TryAndCatch([this, i, &reporter, filter] {
+        this->WaitForWorkUnit(m_ThreadInfoArray[i].Future, filter);
         reporter.CompletedPixel();
       });
     }
@@ -255,11 +250,15 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
     }
     else
     {
-      const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
+      const ImageRegionSplitterBase * splitter = this->GetImageRegionSplitterOrDefault();
       ThreadIdType                    splitCount = splitter->GetNumberOfSplits(region, m_NumberOfWorkUnits);
-      ProgressReporter                reporter(filter, 0, splitCount);
-      itkAssertOrThrowMacro(splitCount <= m_NumberOfWorkUnits, "Split count is greater than number of work units!");
-      ImageIORegion iRegion;
+      if (splitCount > m_NumberOfWorkUnits)
+      {
+        this->ParallelizeImageRegionPieces(region, splitCount, funcP, filter);
+        return;
+      }
+      ProgressReporter reporter(filter, 0, splitCount);
+      ImageIORegion    iRegion;
       ThreadIdType  total;
       for (ThreadIdType i = 1; i < splitCount; ++i)
       {
@@ -292,17 +291,8 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
       // now wait for the other computations to finish
       for (ThreadIdType i = 1; i < splitCount; ++i)
       {
-        exceptionHandler.TryAndCatch([this, i, &reporter, &filter] {
-          std::future_status status;
-          do
-          {
-            status = m_ThreadInfoArray[i].Future.wait_for(threadCompletionPollingInterval);
-            if (filter && status == std::future_status::timeout)
-            {
-              filter->IncrementProgress(0);
-            }
-          } while (status != std::future_status::ready);
-          m_ThreadInfoArray[i].Future.get();
+        exceptionHandler.TryAndCatch([this, i, &reporter, filter] {
+          this->WaitForWorkUnit(m_ThreadInfoArray[i].Future, filter);
           reporter.CompletedPixel();
         });
       }
@@ -312,6 +302,86 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
   }
 }
 
+void
+PoolMultiThreader::ParallelizeImageRegionPieces(const ImageIORegion & region,
+                                                ThreadIdType          splitCount,
+                                                ThreadingFunctorType  funcP,
+                                                ProcessObject *       filter)
+{
+  // The pieces are taken in order by the work units as they become free, so
+  // that the load is balanced when the pieces take different times. The
+  // progress is reported by this thread only, as each work unit completes.
+  const ImageRegionSplitterBase * splitter = this->GetImageRegionSplitterOrDefault();
+  std::atomic<ThreadIdType>       nextPiece{ 0 };
+  ProgressReporter                reporter(filter, 0, m_NumberOfWorkUnits);
+
+  const auto processPieces = [splitter, &region, splitCount, &funcP, &nextPiece] {
+    for (ThreadIdType i = nextPiece++; i < splitCount; i = nextPiece++)
+    {
+      ImageIORegion iRegion = region;
+      splitter->GetSplit(i, splitCount, iRegion);
+      funcP(&iRegion.GetIndex()[0], &iRegion.GetSize()[0]);
+    }
+  };
+
+  for (ThreadIdType i = 1; i < m_NumberOfWorkUnits; ++i)
+  {
+    m_ThreadInfoArray[i].Future = m_ThreadPool->AddWork([processPieces]() {
+      processPieces();
+      // make this lambda have the same signature as m_SingleMethod
+      return ITK_THREAD_RETURN_DEFAULT_VALUE;
+    });
+  }
+
+  // execute this thread's share
+  ExceptionHandler exceptionHandler;
+  exceptionHandler.TryAndCatch([&processPieces, &reporter] {
+    processPieces();
+    reporter.CompletedPixel();
+  });
+
+  // now wait for the other computations to finish
+  for (ThreadIdType i = 1; i < m_NumberOfWorkUnits; ++i)
+  {
+    exceptionHandler.TryAndCatch([this, i, &reporter, filter] {
+      this->WaitForWorkUnit(m_ThreadInfoArray[i].Future, filter);
+      reporter.CompletedPixel();
+    });
+  }
+
+  exceptionHandler.RethrowFirstCaughtException();
+}
+
+void
+PoolMultiThreader::WaitForWorkUnit(std::future<ITK_THREAD_RETURN_TYPE> & future, ProcessObject * filter)
+{
+  // A pool thread must not block: the work unit might still be queued, waiting
+  // for a free thread, e.g. when all threads are waiting for nested work units.
+  const bool                      helpWhileWaiting = ThreadPool::IsWorkerThread();
+  const std::chrono::milliseconds pollingInterval =
+    helpWhileWaiting ? nestedThreadCompletionPollingInterval : threadCompletionPollingInterval;
+
+  while (true)
+  {
+    if (helpWhileWaiting)
+    {
+      while (future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready &&
+             m_ThreadPool->TryExecutePendingTask())
+      {
+      }
+    }
+    if (future.wait_for(pollingInterval) == std::future_status::ready)
+    {
+      break;
+    }
+    if (filter)
+    {
+      filter->IncrementProgress(0);
+    }
+  }
+  future.get(); // rethrows the exception of the work unit, if any
+}
+
 void
 PoolMultiThreader::PrintSelf(std::ostream & os, Indent indent) const
 {
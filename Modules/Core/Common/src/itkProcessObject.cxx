@@ -32,6 +32,9 @@
 #include <sstream>
 #include <algorithm>
 #include "itkMultiThreaderBase.h"
+#include "itkPipelineMemoryAccounting.h"
+#include "itkPipelineResultCache.h"
+#include "itkPipelineTracer.h"
 
 namespace itk
 {
@@ -123,6 +126,8 @@ ProcessObject::~ProcessObject()
       output.second = nullptr;
     }
   }
+
+  PipelineMemoryAccounting::ForgetProcessObject(this);
 }
 
 
@@ -1198,6 +1203,37 @@ ProcessObject::SetReleaseDataFlag(bool val)
 }
 
 
+bool
+ProcessObject::CanUseResultCache() const
+{
+  return false;
+}
+
+
+void
+ProcessObject::PrintResultCacheParameters(std::ostream &) const
+{}
+
+
+bool
+ProcessObject::SupportsInPlaceExecution() const
+{
+  return false;
+}
+
+
+void
+ProcessObject::SetInPlaceExecution(bool)
+{}
+
+
+bool
+ProcessObject::GetInPlaceExecution() const
+{
+  return false;
+}
+
+
 void
 ProcessObject::PrintSelf(std::ostream & os, Indent indent) const
 {
@@ -1271,6 +1307,7 @@ ProcessObject::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "Number Of Work Units: " << m_NumberOfWorkUnits << std::endl;
   os << indent << "ReleaseDataFlag: " << (this->GetReleaseDataFlag() ? "On" : "Off") << std::endl;
   os << indent << "ReleaseDataBeforeUpdateFlag: " << (m_ReleaseDataBeforeUpdateFlag ? "On" : "Off") << std::endl;
+  os << indent << "UseResultCache: " << (m_UseResultCache ? "On" : "Off") << std::endl;
   os << indent << "AbortGenerateData: " << (m_AbortGenerateData ? "On" : "Off") << std::endl;
   os << indent << "Progress: " << progressFixedToFloat(m_Progress) << std::endl;
   os << indent << "Multithreader: " << std::endl;
@@ -1691,7 +1728,26 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
 
   try
   {
-    this->GenerateData();
+    PipelineTracer::Scope traceScope(this, "Filter");
+    traceScope.SetRequestedRegion(this->GetPrimaryOutput());
+    const PipelineMemoryAccounting::OwnerScope memoryOwnerScope(this);
+    std::string                                resultCacheKey;
+    if (m_UseResultCache)
+    {
+      resultCacheKey = PipelineResultCache::ComputeKey(this);
+    }
+    if (resultCacheKey.empty() || !PipelineResultCache::Restore(this, resultCacheKey))
+    {
+      this->GenerateData();
+      if (!resultCacheKey.empty() && !m_AbortGenerateData)
+      {
+        PipelineResultCache::Store(this, resultCacheKey);
+      }
+    }
+    else
+    {
+      this->UpdateProgress(1.0f);
+    }
   }
   catch (const ProcessAborted &)
   {
@@ -0,0 +1,95 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkRedundantInitializationChecker.h"
+#include "itkMacro.h"
+#include "itkGlobalState.h"
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+
+namespace itk
+{
+namespace
+{
+struct RedundantInitializationCheckerState
+{
+  std::atomic<bool> m_Enabled{ GetBooleanEnvironmentVariable("ITK_CHECK_REDUNDANT_INITIALIZATION") };
+
+  std::mutex                                     m_Mutex;
+  RedundantInitializationChecker::RecordMapType m_Records;
+};
+
+RedundantInitializationCheckerState &
+GetState()
+{
+  static RedundantInitializationCheckerState state;
+  return state;
+}
+} // namespace
+
+void
+RedundantInitializationChecker::SetEnabled(bool enabled)
+{
+  GetState().m_Enabled = enabled;
+}
+
+bool
+RedundantInitializationChecker::GetEnabled()
+{
+  return GetState().m_Enabled;
+}
+
+void
+RedundantInitializationChecker::Report(const std::string & sourceName, SizeValueType numberOfBytes)
+{
+  RedundantInitializationCheckerState & state = GetState();
+  bool                                  firstReport = false;
+  {
+    const std::lock_guard<std::mutex> lock(state.m_Mutex);
+    Record &                          record = state.m_Records[sourceName];
+    firstReport = (record.NumberOfBuffers == 0);
+    ++record.NumberOfBuffers;
+    record.NumberOfBytes += numberOfBytes;
+  }
+  if (firstReport)
+  {
+    std::ostringstream message;
+    message << "WARNING: " << sourceName << " zero-initialized a buffer of " << numberOfBytes
+            << " bytes, and then overwrote every pixel. Allocate() would be sufficient.\n";
+    OutputWindowDisplayWarningText(message.str().c_str());
+  }
+}
+
+RedundantInitializationChecker::RecordMapType
+RedundantInitializationChecker::GetRecords()
+{
+  RedundantInitializationCheckerState & state = GetState();
+  const std::lock_guard<std::mutex>     lock(state.m_Mutex);
+  return state.m_Records;
+}
+
+void
+RedundantInitializationChecker::Clear()
+{
+  RedundantInitializationCheckerState & state = GetState();
+  const std::lock_guard<std::mutex>     lock(state.m_Mutex);
+  state.m_Records.clear();
+}
+
+} // end namespace itk
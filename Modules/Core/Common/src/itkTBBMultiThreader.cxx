@@ -272,6 +272,24 @@ TBBMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
       tbb::global_control::max_allowed_parallelism,
       std::min<int>(tbb_utility::get_default_num_threads(), m_MaximumNumberOfThreads));
 
+    if (const ImageRegionSplitterBase * splitter = this->GetImageRegionSplitter())
+    {
+      // The pieces of the splitter set for this multi-threader are scheduled
+      // by TBB, instead of the recursive splitting of the region.
+      const unsigned int splitCount = splitter->GetNumberOfSplits(region, m_NumberOfWorkUnits);
+      tbb::parallel_for(0u, splitCount, [&](unsigned int i) {
+        TotalProgressReporter progress(filter, totalCount, 100);
+        progress.CheckAbortGenerateData();
+
+        ImageIORegion regionToProcess = region;
+        splitter->GetSplit(i, splitCount, regionToProcess);
+        funcP(&regionToProcess.GetIndex()[0], &regionToProcess.GetSize()[0]);
+
+        progress.Completed(regionToProcess.GetNumberOfPixels());
+      });
+      return;
+    }
+
     tbb::parallel_for(regionSplitter, [&](TBBImageRegionSplitter regionToProcess) {
       TotalProgressReporter progress(filter, totalCount, 100);
       progress.CheckAbortGenerateData();
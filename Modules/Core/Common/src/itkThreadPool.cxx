@@ -18,34 +18,185 @@
 
 
 #include "itkThreadPool.h"
-#include "itksys/SystemTools.hxx"
+#include "itkGlobalState.h"
 #include "itkThreadSupport.h"
 #include "itkNumericTraits.h"
 #include "itkMultiThreaderBase.h"
 #include "itkSingleton.h"
+#include "itkNUMAPolicy.h"
 
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <random>
+#include <vector>
 
 
 namespace itk
 {
+namespace
+{
+using TaskType = std::function<void()>;
 
-struct ThreadPoolGlobals
+/** Lock-free work-stealing deque, as described by Chase and Lev, "Dynamic
+ * Circular Work-Stealing Deque" (SPAA 2005), using the C++11 memory model
+ * formulation of Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+ * Only the owner thread may call Push and Pop, any thread may call Steal. */
+class WorkStealingDeque
+{
+public:
+  WorkStealingDeque()
+  {
+    m_Buffers.emplace_back(std::make_unique<Buffer>(64));
+    m_Buffer.store(m_Buffers.back().get(), std::memory_order_relaxed);
+  }
+
+  ~WorkStealingDeque()
+  {
+    while (TaskType * task = this->Pop())
+    {
+      delete task;
+    }
+  }
+
+  void
+  Push(TaskType * task)
+  {
+    const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+    const int64_t top = m_Top.load(std::memory_order_acquire);
+    Buffer *      buffer = m_Buffer.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->m_Capacity - 1)
+    {
+      buffer = this->Grow(buffer, top, bottom);
+    }
+    buffer->Put(bottom, task);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  TaskType *
+  Pop()
+  {
+    const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+    Buffer *      buffer = m_Buffer.load(std::memory_order_relaxed);
+    m_Bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t    top = m_Top.load(std::memory_order_relaxed);
+    TaskType * task = nullptr;
+    if (top <= bottom)
+    {
+      task = buffer->Get(bottom);
+      if (top == bottom)
+      {
+        // Last element: race against thieves.
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+          task = nullptr;
+        }
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+      }
+    }
+    else
+    {
+      m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  TaskType *
+  Steal()
+  {
+    int64_t top = m_Top.load(std::memory_order_acquire);
+    while (true)
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+      if (top >= bottom)
+      {
+        return nullptr;
+      }
+      TaskType * task = m_Buffer.load(std::memory_order_acquire)->Get(top);
+      if (m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      {
+        return task;
+      }
+      // Lost the race against another thief or the owner, top has been reloaded: retry.
+    }
+  }
+
+private:
+  struct Buffer
+  {
+    explicit Buffer(int64_t capacity)
+      : m_Capacity(capacity)
+      , m_Slots(std::make_unique<std::atomic<TaskType *>[]>(static_cast<size_t>(capacity)))
+    {}
+
+    TaskType *
+    Get(int64_t i) const
+    {
+      return m_Slots[i & (m_Capacity - 1)].load(std::memory_order_relaxed);
+    }
+
+    void
+    Put(int64_t i, TaskType * task)
+    {
+      m_Slots[i & (m_Capacity - 1)].store(task, std::memory_order_relaxed);
+    }
+
+    const int64_t                               m_Capacity; // always a power of two
+    std::unique_ptr<std::atomic<TaskType *>[]> m_Slots;
+  };
+
+  Buffer *
+  Grow(const Buffer * buffer, int64_t top, int64_t bottom)
+  {
+    auto grown = std::make_unique<Buffer>(2 * buffer->m_Capacity);
+    for (int64_t i = top; i < bottom; ++i)
+    {
+      grown->Put(i, buffer->Get(i));
+    }
+    // Thieves may still read from the old buffer, so it is retired, not deleted.
+    m_Buffers.push_back(std::move(grown));
+    m_Buffer.store(m_Buffers.back().get(), std::memory_order_release);
+    return m_Buffers.back().get();
+  }
+
+  alignas(64) std::atomic<int64_t> m_Top{ 0 };
+  alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+  std::atomic<Buffer *>                m_Buffer{ nullptr };
+  std::vector<std::unique_ptr<Buffer>> m_Buffers; // owner only
+};
+
+/** The identifier of the worker thread the calling thread is,
+ * or NotAWorker for threads which do not belong to the pool. */
+constexpr ThreadIdType        NotAWorker = std::numeric_limits<ThreadIdType>::max();
+thread_local ThreadIdType     tl_WorkerIndex = NotAWorker;
+thread_local std::minstd_rand tl_VictimGenerator;
+} // namespace
+
+/** Queues owned by a single worker thread in work-stealing mode. */
+struct ThreadPoolWorkerQueues
 {
-  ThreadPoolGlobals() = default;
+  // Jobs submitted by the owner thread itself (nested parallelism).
+  WorkStealingDeque m_Deque;
+
+  // Jobs submitted by threads which are not pool workers.
+  std::mutex           m_InboxMutex;
+  std::deque<TaskType> m_Inbox; // guarded by m_InboxMutex
+};
 
+struct ThreadPoolGlobals
+{
   // To lock on the various internal variables.
   std::mutex m_Mutex;
 
   // To allow singleton creation of ThreadPool.
   std::once_flag m_ThreadPoolOnceFlag;
 
-  // The singleton instance of ThreadPool.
-  ThreadPool::Pointer m_ThreadPoolInstance;
-
 #if defined(_WIN32) && defined(ITKCommon_EXPORTS)
   // ThreadPool's destructor is called during DllMain's DLL_PROCESS_DETACH.
   // Because ITKCommon-5.X.dll is usually being detached due to process termination,
@@ -57,6 +208,33 @@ struct ThreadPoolGlobals
 #else // In a static library, we have to wait.
   std::atomic<bool> m_WaitForThreads{ true };
 #endif
+
+  // Whether new jobs go to the work-stealing deques or to the shared queue.
+  // The environment only provides the initial value, SetWorkStealing overrides it.
+  std::atomic<bool> m_WorkStealing{ GetBooleanEnvironmentVariable("ITK_THREAD_POOL_WORK_STEALING") };
+
+  // Work-stealing queues, one per worker thread. Entries are created before
+  // the corresponding thread is started, and are never destroyed while the
+  // process is running, so they can be accessed without holding m_Mutex.
+  std::unique_ptr<ThreadPoolWorkerQueues> m_WorkerQueues[ITK_MAX_THREADS];
+  std::atomic<ThreadIdType>               m_NumberOfWorkerQueues{ 0 };
+
+  // Round-robin counter distributing jobs submitted by non-worker threads.
+  std::atomic<ThreadIdType> m_NextInbox{ 0 };
+
+  // Number of jobs currently held in the work-stealing queues.
+  std::atomic<int64_t> m_NumberOfStealableTasks{ 0 };
+
+  // Incremented after each job is pushed in work-stealing mode, so that
+  // workers can detect jobs submitted while they were preparing to park.
+  std::atomic<uint64_t> m_WorkEpoch{ 0 };
+
+  // Number of workers which are parked on ThreadPool::m_Condition.
+  std::atomic<int> m_NumberOfParkedThreads{ 0 };
+
+  // The singleton instance of ThreadPool. Declared last, so that its threads
+  // are joined before the members they access are destroyed.
+  ThreadPool::Pointer m_ThreadPoolInstance;
 };
 
 itkGetGlobalSimpleMacro(ThreadPool, ThreadPoolGlobals, PimplGlobals);
@@ -104,6 +282,26 @@ ThreadPool::SetDoNotWaitForThreads(bool doNotWaitForThreads)
   m_PimplGlobals->m_WaitForThreads = !doNotWaitForThreads;
 }
 
+bool
+ThreadPool::GetWorkStealing()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_WorkStealing;
+}
+
+void
+ThreadPool::SetWorkStealing(bool workStealing)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_WorkStealing = workStealing;
+}
+
+bool
+ThreadPool::IsWorkerThread()
+{
+  return tl_WorkerIndex != NotAWorker;
+}
+
 ThreadPool::ThreadPool()
 {
   // m_PimplGlobals->m_Mutex not needed to be acquired here because construction only occurs via GetInstance which is
@@ -111,12 +309,7 @@ ThreadPool::ThreadPool()
 
   m_PimplGlobals->m_ThreadPoolInstance = this;        // threads need this
   m_PimplGlobals->m_ThreadPoolInstance->UnRegister(); // Remove extra reference
-  ThreadIdType threadCount = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
-  m_Threads.reserve(threadCount);
-  for (ThreadIdType i = 0; i < threadCount; ++i)
-  {
-    m_Threads.emplace_back(&ThreadPool::ThreadExecute);
-  }
+  this->AddThreads(MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
 }
 
 void
@@ -126,7 +319,13 @@ ThreadPool::AddThreads(ThreadIdType count)
   m_Threads.reserve(m_Threads.size() + count);
   for (ThreadIdType i = 0; i < count; ++i)
   {
-    m_Threads.emplace_back(&ThreadPool::ThreadExecute);
+    const auto workerIndex = static_cast<ThreadIdType>(m_Threads.size());
+    if (workerIndex < ITK_MAX_THREADS && m_PimplGlobals->m_WorkerQueues[workerIndex] == nullptr)
+    {
+      m_PimplGlobals->m_WorkerQueues[workerIndex] = std::make_unique<ThreadPoolWorkerQueues>();
+      m_PimplGlobals->m_NumberOfWorkerQueues = workerIndex + 1;
+    }
+    m_Threads.emplace_back(&ThreadPool::ThreadExecute, workerIndex);
   }
 }
 
@@ -136,9 +335,54 @@ ThreadPool::GetMutex() const
   return m_PimplGlobals->m_Mutex;
 }
 
+void
+ThreadPool::SubmitTask(std::function<void()> && task)
+{
+  const ThreadIdType numberOfWorkerQueues = m_PimplGlobals->m_NumberOfWorkerQueues;
+  if (!m_PimplGlobals->m_WorkStealing || numberOfWorkerQueues == 0)
+  {
+    {
+      const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+      m_WorkQueue.emplace_back(std::move(task));
+    }
+    m_Condition.notify_one();
+    return;
+  }
+
+  if (tl_WorkerIndex < numberOfWorkerQueues)
+  {
+    // Nested submission: the owner pushes onto its own deque, others will steal.
+    m_PimplGlobals->m_WorkerQueues[tl_WorkerIndex]->m_Deque.Push(new TaskType(std::move(task)));
+  }
+  else
+  {
+    ThreadPoolWorkerQueues & queues =
+      *m_PimplGlobals->m_WorkerQueues[m_PimplGlobals->m_NextInbox.fetch_add(1) % numberOfWorkerQueues];
+    const std::lock_guard<std::mutex> lockGuard(queues.m_InboxMutex);
+    queues.m_Inbox.emplace_back(std::move(task));
+  }
+  ++m_PimplGlobals->m_NumberOfStealableTasks;
+
+  // Only wake up a thread if one is parked, which avoids taking the global mutex
+  // while all workers are busy. The epoch increment must precede the check of the
+  // number of parked threads, see the corresponding code in ThreadExecute.
+  ++m_PimplGlobals->m_WorkEpoch;
+  if (m_PimplGlobals->m_NumberOfParkedThreads > 0)
+  {
+    {
+      const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+    }
+    m_Condition.notify_one();
+  }
+}
+
 int
 ThreadPool::GetNumberOfCurrentlyIdleThreads() const
 {
+  if (m_PimplGlobals->m_WorkStealing)
+  {
+    return m_PimplGlobals->m_NumberOfParkedThreads;
+  }
   const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
   return static_cast<int>(m_Threads.size()) - static_cast<int>(m_WorkQueue.size()); // lousy approximation
 }
@@ -186,28 +430,133 @@ ThreadPool::ResumeFromFork()
   instance->AddThreads(threadCount);
 }
 
+namespace
+{
+/** Takes a job from the work-stealing queues: first from the own deque (LIFO)
+ * and inbox, then from the deques (FIFO) and inboxes of randomly chosen victims. */
+bool
+TryTakeStealableTask(ThreadPoolGlobals & globals, ThreadIdType workerIndex, TaskType & task)
+{
+  const ThreadIdType numberOfWorkerQueues = globals.m_NumberOfWorkerQueues;
+  if (globals.m_NumberOfStealableTasks <= 0 || numberOfWorkerQueues == 0)
+  {
+    return false;
+  }
+
+  const auto takeFrom = [&task, &globals](ThreadPoolWorkerQueues & queues, bool isOwner) {
+    if (const std::unique_ptr<TaskType> taken{ isOwner ? queues.m_Deque.Pop() : queues.m_Deque.Steal() })
+    {
+      task = std::move(*taken);
+    }
+    else
+    {
+      const std::lock_guard<std::mutex> lockGuard(queues.m_InboxMutex);
+      if (queues.m_Inbox.empty())
+      {
+        return false;
+      }
+      task = std::move(queues.m_Inbox.front());
+      queues.m_Inbox.pop_front();
+    }
+    --globals.m_NumberOfStealableTasks;
+    return true;
+  };
+
+  if (workerIndex < numberOfWorkerQueues && takeFrom(*globals.m_WorkerQueues[workerIndex], true))
+  {
+    return true;
+  }
+
+  const ThreadIdType firstVictim = tl_VictimGenerator() % numberOfWorkerQueues;
+  for (ThreadIdType i = 0; i < numberOfWorkerQueues; ++i)
+  {
+    const ThreadIdType victimIndex = (firstVictim + i) % numberOfWorkerQueues;
+    if (victimIndex != workerIndex && takeFrom(*globals.m_WorkerQueues[victimIndex], false))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+bool
+ThreadPool::TryExecutePendingTask()
+{
+  std::function<void()> task;
+  if (!TryTakeStealableTask(*m_PimplGlobals, tl_WorkerIndex, task))
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+    if (m_WorkQueue.empty())
+    {
+      return false;
+    }
+    task = std::move(m_WorkQueue.front());
+    m_WorkQueue.pop_front();
+  }
+
+  task(); // execute the task
+  return true;
+}
+
 void
-ThreadPool::ThreadExecute()
+ThreadPool::ThreadExecute(ThreadIdType workerIndex)
 {
   // plain pointer does not increase reference count
   ThreadPool * threadPool = m_PimplGlobals->m_ThreadPoolInstance.GetPointer();
 
+  tl_WorkerIndex = workerIndex;
+  tl_VictimGenerator.seed(workerIndex + 1);
+  bool threadPinning = false;
+
   while (true)
   {
     std::function<void()> task;
 
+    // Read the epoch before looking for work: a job submitted after an
+    // unsuccessful search changes the epoch, which prevents parking.
+    const uint64_t epoch = m_PimplGlobals->m_WorkEpoch;
+    if (!TryTakeStealableTask(*m_PimplGlobals, workerIndex, task))
     {
       std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
-      threadPool->m_Condition.wait(mutexHolder,
-                                   [threadPool] { return threadPool->m_Stopping || !threadPool->m_WorkQueue.empty(); });
-      if (threadPool->m_Stopping && threadPool->m_WorkQueue.empty())
+      if (threadPool->m_WorkQueue.empty())
       {
-        return;
+        if (threadPool->m_Stopping)
+        {
+          if (epoch == m_PimplGlobals->m_WorkEpoch)
+          {
+            return;
+          }
+          continue; // jobs were added to the work-stealing queues meanwhile
+        }
+        ++m_PimplGlobals->m_NumberOfParkedThreads;
+        threadPool->m_Condition.wait(mutexHolder, [threadPool, epoch] {
+          return threadPool->m_Stopping || !threadPool->m_WorkQueue.empty() || epoch != m_PimplGlobals->m_WorkEpoch;
+        });
+        --m_PimplGlobals->m_NumberOfParkedThreads;
+        continue;
       }
       task = std::move(threadPool->m_WorkQueue.front());
       threadPool->m_WorkQueue.pop_front();
     }
 
+    // Apply changes of the NUMA thread pinning setting. Consecutive workers
+    // are pinned to different nodes, to spread the pool over all of them.
+    // This is only done once a job is obtained: when the pool is stopped at
+    // program exit, the NUMAPolicy globals may already be destroyed.
+    if (NUMAPolicy::GetGlobalDefaultThreadPinning() != threadPinning)
+    {
+      threadPinning = !threadPinning;
+      if (threadPinning)
+      {
+        NUMAPolicy::PinCurrentThreadToNode(workerIndex % NUMAPolicy::GetNumberOfNodes());
+      }
+      else
+      {
+        NUMAPolicy::UnpinCurrentThread();
+      }
+    }
+
     task(); // execute the task
   }
 }
@@ -0,0 +1,125 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkConstInteriorNeighborhoodIterator.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkNeighborhoodAlgorithm.h"
+#include "itkNeighborhoodInnerProduct.h"
+#include <gtest/gtest.h>
+#include <numeric>
+
+namespace
+{
+using ImageType = itk::Image<int, 3>;
+
+ImageType::Pointer
+CreateImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType({ { -2, 1, 4 } }, { { 9, 7, 6 } }));
+  image->Allocate();
+  std::iota(image->GetBufferPointer(), image->GetBufferPointer() + image->GetBufferedRegion().GetNumberOfPixels(), 0);
+  return image;
+}
+} // namespace
+
+
+TEST(ConstInteriorNeighborhoodIterator, ReadsTheNeighborsOfConstNeighborhoodIterator)
+{
+  const ImageType::Pointer    image = CreateImage();
+  const ImageType::SizeType   radius{ { 2, 1, 1 } };
+  const ImageType::RegionType nonBoundaryRegion =
+    itk::NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<ImageType>::Compute(
+      *image, image->GetBufferedRegion(), radius)
+      .GetNonBoundaryRegion();
+  ASSERT_EQ(nonBoundaryRegion, ImageType::RegionType({ { 0, 2, 5 } }, { { 5, 5, 4 } }));
+
+  itk::ConstInteriorNeighborhoodIterator<ImageType> interiorIt(radius, image, nonBoundaryRegion);
+  itk::ConstNeighborhoodIterator<ImageType>         it(radius, image, nonBoundaryRegion);
+  ASSERT_EQ(interiorIt.Size(), it.Size());
+  for (unsigned int d = 0; d < 3; ++d)
+  {
+    EXPECT_EQ(interiorIt.GetStride(d), it.GetStride(d));
+  }
+  for (itk::SizeValueType i = 0; i < it.Size(); ++i)
+  {
+    EXPECT_EQ(interiorIt.GetOffset(i), it.GetOffset(i));
+  }
+
+  itk::SizeValueType numberOfPixels = 0;
+  for (; !it.IsAtEnd(); ++it, ++interiorIt, ++numberOfPixels)
+  {
+    ASSERT_FALSE(interiorIt.IsAtEnd());
+    ASSERT_EQ(interiorIt.GetIndex(), it.GetIndex());
+    EXPECT_EQ(interiorIt.GetCenterPixel(), it.GetCenterPixel());
+    for (itk::SizeValueType i = 0; i < it.Size(); ++i)
+    {
+      EXPECT_EQ(interiorIt.GetPixel(i), it.GetPixel(i));
+    }
+  }
+  EXPECT_TRUE(interiorIt.IsAtEnd());
+  EXPECT_EQ(numberOfPixels, nonBoundaryRegion.GetNumberOfPixels());
+
+  interiorIt.GoToBegin();
+  EXPECT_EQ(interiorIt.GetIndex(), nonBoundaryRegion.GetIndex());
+}
+
+
+TEST(ConstInteriorNeighborhoodIterator, ComputesTheInnerProductsOfConstNeighborhoodIterator)
+{
+  const ImageType::Pointer    image = CreateImage();
+  const ImageType::RegionType region({ { 1, 3, 6 } }, { { 3, 2, 2 } });
+
+  itk::Neighborhood<double, 3> op;
+  op.SetRadius(1);
+  for (itk::SizeValueType i = 0; i < op.Size(); ++i)
+  {
+    op[i] = 0.5 * i - 3.0;
+  }
+  // A derivative along the second axis, as the GradientImageFilter computes it.
+  itk::Neighborhood<double, 3> derivative;
+  derivative.SetRadius({ { 1, 0, 0 } });
+  derivative[0] = -0.5;
+  derivative[2] = 0.5;
+  const std::slice slice(13 - 3, 3, 3);
+
+  const itk::NeighborhoodInnerProduct<ImageType, double, double> innerProduct;
+  itk::ConstInteriorNeighborhoodIterator<ImageType>              interiorIt(op.GetRadius(), image, region);
+  for (itk::ConstNeighborhoodIterator<ImageType> it(op.GetRadius(), image, region); !it.IsAtEnd(); ++it, ++interiorIt)
+  {
+    EXPECT_EQ(innerProduct(interiorIt, op), innerProduct(it, op));
+    EXPECT_EQ(innerProduct(slice, interiorIt, derivative), innerProduct(slice, it, derivative));
+  }
+}
+
+
+TEST(ConstInteriorNeighborhoodIterator, RejectsNeighborhoodsOutsideTheBuffer)
+{
+  const ImageType::Pointer image = CreateImage();
+
+  EXPECT_THROW(itk::ConstInteriorNeighborhoodIterator<ImageType>(
+                 ImageType::SizeType::Filled(1), image, ImageType::RegionType({ { -2, 2, 5 } }, { { 2, 2, 2 } })),
+               itk::ExceptionObject);
+
+  // An empty region has no neighborhood.
+  const itk::ConstInteriorNeighborhoodIterator<ImageType> emptyIt(
+    ImageType::SizeType::Filled(1), image, ImageType::RegionType({ { -2, 2, 5 } }, { { 0, 2, 2 } }));
+  EXPECT_TRUE(emptyIt.IsAtEnd());
+  EXPECT_TRUE(itk::ConstInteriorNeighborhoodIterator<ImageType>().IsAtEnd());
+}
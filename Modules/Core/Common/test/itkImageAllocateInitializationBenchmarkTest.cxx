@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkRedundantInitializationChecker.h"
+#include "itkTimeProbe.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+#include <numeric>
+
+// Measures the cost of zero-initializing an image buffer which is then fully
+// overwritten, as done by a filter calling AllocateInitialized() instead of
+// Allocate() for an output whose every pixel it computes, and checks that the
+// RedundantInitializationChecker reports the former only.
+//
+// Usage: itkImageAllocateInitializationBenchmarkTest imageSize [numberOfIterations]
+// The images are cubes of imageSize^3 float pixels.
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+ImageType::Pointer
+AllocateAndOverwrite(itk::SizeValueType imageSize, bool initializePixels, itk::TimeProbe & probe)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(imageSize));
+
+  probe.Start();
+  image->Allocate(initializePixels);
+  const itk::ImageBufferRange<ImageType> range(*image);
+  std::iota(range.begin(), range.end(), 1.0f);
+  probe.Stop();
+
+  image->DataHasBeenGenerated();
+  return image;
+}
+} // namespace
+
+int
+itkImageAllocateInitializationBenchmarkTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " imageSize [numberOfIterations]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto         imageSize = static_cast<itk::SizeValueType>(std::stoul(argv[1]));
+  const unsigned int numberOfIterations = (argc > 2) ? std::stoul(argv[2]) : 5;
+  const double       numberOfBytes = static_cast<double>(imageSize * imageSize * imageSize * sizeof(float));
+
+  const bool checkerEnabled = itk::RedundantInitializationChecker::GetEnabled();
+  itk::RedundantInitializationChecker::SetEnabled(true);
+  itk::RedundantInitializationChecker::Clear();
+
+  itk::TimeProbe initializedProbe;
+  itk::TimeProbe uninitializedProbe;
+  bool           success = true;
+
+  for (unsigned int i = 0; i < numberOfIterations; ++i)
+  {
+    const ImageType::Pointer initialized = AllocateAndOverwrite(imageSize, true, initializedProbe);
+    const ImageType::Pointer uninitialized = AllocateAndOverwrite(imageSize, false, uninitializedProbe);
+
+    const itk::ImageBufferRange<const ImageType> initializedRange(*initialized);
+    const itk::ImageBufferRange<const ImageType> uninitializedRange(*uninitialized);
+    if (!std::equal(
+          initializedRange.cbegin(), initializedRange.cend(), uninitializedRange.cbegin(), uninitializedRange.cend()))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "The images differ with and without initialization." << std::endl;
+      success = false;
+    }
+  }
+
+  const auto records = itk::RedundantInitializationChecker::GetRecords();
+  itk::RedundantInitializationChecker::SetEnabled(checkerEnabled);
+  itk::RedundantInitializationChecker::Clear();
+
+  ITK_TEST_EXPECT_EQUAL(records.size(), 1u);
+  ITK_TEST_EXPECT_EQUAL(records.count("Image"), 1u);
+  if (records.count("Image") == 1 && records.at("Image").NumberOfBuffers != numberOfIterations)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Expected " << numberOfIterations << " reports, got " << records.at("Image").NumberOfBuffers
+              << std::endl;
+    success = false;
+  }
+
+  const double initializedTime = initializedProbe.GetMean();
+  const double uninitializedTime = uninitializedProbe.GetMean();
+  std::cout << "Buffer size: " << numberOfBytes / (1 << 20) << " MiB" << std::endl;
+  std::cout << "Allocate(true) and overwrite: " << initializedTime << ' ' << initializedProbe.GetUnit() << std::endl;
+  std::cout << "Allocate() and overwrite: " << uninitializedTime << ' ' << uninitializedProbe.GetUnit() << std::endl;
+  if (initializedTime > 0.0)
+  {
+    std::cout << "Time saved: " << 100.0 * (initializedTime - uninitializedTime) / initializedTime << '%' << std::endl;
+  }
+  if (initializedTime > uninitializedTime)
+  {
+    std::cout << "Bandwidth of the initialization: "
+              << numberOfBytes / (initializedTime - uninitializedTime) / (1 << 30) << " GiB/s" << std::endl;
+  }
+
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
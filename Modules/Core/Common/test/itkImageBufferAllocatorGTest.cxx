@@ -0,0 +1,217 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkImageBufferAllocator.h"
+#include "itkImage.h"
+#include "itkImportImageContainer.h"
+#include "itkVectorImage.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+namespace
+{
+using PolicyEnum = itk::ImageBufferAllocationPolicyEnum;
+
+constexpr PolicyEnum nonDefaultPolicies[] = { PolicyEnum::Aligned, PolicyEnum::HugePage, PolicyEnum::MemoryMapped };
+
+// Restores the global default policy at the end of a test.
+class GlobalDefaultPolicyGuard
+{
+public:
+  GlobalDefaultPolicyGuard() = default;
+  ~GlobalDefaultPolicyGuard() { itk::ImageBufferAllocator::SetGlobalDefaultPolicy(m_Policy); }
+
+private:
+  const PolicyEnum m_Policy{ itk::ImageBufferAllocator::GetGlobalDefaultPolicy() };
+};
+
+
+template <typename TElement>
+typename itk::ImportImageContainer<itk::SizeValueType, TElement>::Pointer
+CreateContainer()
+{
+  return itk::ImportImageContainer<itk::SizeValueType, TElement>::New();
+}
+} // namespace
+
+
+TEST(ImageBufferAllocator, PolicyFromString)
+{
+  EXPECT_EQ(itk::ImageBufferAllocator::PolicyFromString("Default"), PolicyEnum::Default);
+  EXPECT_EQ(itk::ImageBufferAllocator::PolicyFromString("ALIGNED"), PolicyEnum::Aligned);
+  EXPECT_EQ(itk::ImageBufferAllocator::PolicyFromString("hugepage"), PolicyEnum::HugePage);
+  EXPECT_EQ(itk::ImageBufferAllocator::PolicyFromString("MemoryMapped"), PolicyEnum::MemoryMapped);
+  EXPECT_EQ(itk::ImageBufferAllocator::PolicyFromString("Pool"), PolicyEnum::Unknown);
+
+  std::ostringstream stream;
+  stream << PolicyEnum::HugePage;
+  EXPECT_EQ(stream.str(), "itk::ImageBufferAllocatorEnums::Policy::HugePage");
+}
+
+
+TEST(ImageBufferAllocator, GetPointerAlignment)
+{
+  EXPECT_EQ(itk::ImageBufferAllocator::GetPointerAlignment(nullptr), 0u);
+  EXPECT_EQ(itk::ImageBufferAllocator::GetPointerAlignment(reinterpret_cast<const void *>(uintptr_t{ 0x1040 })), 64u);
+  EXPECT_EQ(itk::ImageBufferAllocator::GetPointerAlignment(reinterpret_cast<const void *>(uintptr_t{ 0x1003 })), 1u);
+}
+
+
+// Checks that each policy provides the promised alignment, and that the memory is usable.
+TEST(ImageBufferAllocator, AllocateIsAligned)
+{
+  for (const PolicyEnum policy : nonDefaultPolicies)
+  {
+    for (const size_t numberOfBytes : { size_t{ 0 }, size_t{ 100 }, size_t{ 3 } << 20 })
+    {
+      void * const pointer = itk::ImageBufferAllocator::Allocate(numberOfBytes, policy);
+      ASSERT_NE(pointer, nullptr);
+      EXPECT_GE(itk::ImageBufferAllocator::GetPointerAlignment(pointer),
+                itk::ImageBufferAllocator::GetAlignment(policy, numberOfBytes))
+        << policy << ' ' << numberOfBytes;
+      std::fill_n(static_cast<char *>(pointer), numberOfBytes, 'x');
+      itk::ImageBufferAllocator::Deallocate(pointer, numberOfBytes, policy);
+    }
+  }
+  EXPECT_THROW(itk::ImageBufferAllocator::Allocate(100, PolicyEnum::Default), itk::ExceptionObject);
+}
+
+
+TEST(ImageBufferAllocator, ContainerReserveAndSqueeze)
+{
+  const GlobalDefaultPolicyGuard guard;
+
+  for (const PolicyEnum policy : nonDefaultPolicies)
+  {
+    itk::ImageBufferAllocator::SetGlobalDefaultPolicy(policy);
+
+    const auto container = CreateContainer<double>();
+    container->Reserve(1000, true);
+    EXPECT_EQ(container->GetBufferAllocationPolicy(), policy);
+    EXPECT_GE(container->GetBufferAlignment(), itk::ImageBufferAllocator::CacheLineAlignment);
+    double * buffer = container->GetBufferPointer();
+    EXPECT_TRUE(std::all_of(buffer, buffer + 1000, [](const double value) { return value == 0.0; }));
+    std::iota(buffer, buffer + 1000, 0.0);
+
+    // Growing keeps the values.
+    container->Reserve(5000);
+    buffer = container->GetBufferPointer();
+    EXPECT_EQ(container->Capacity(), 5000u);
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+      EXPECT_EQ(buffer[i], i);
+    }
+
+    container->Reserve(10);
+    container->Squeeze();
+    EXPECT_EQ(container->Capacity(), 10u);
+    EXPECT_EQ(container->GetBufferAllocationPolicy(), policy);
+    EXPECT_EQ(container->GetBufferPointer()[9], 9.0);
+
+    container->Initialize();
+    EXPECT_EQ(container->GetBufferPointer(), nullptr);
+    EXPECT_EQ(container->GetBufferAlignment(), 0u);
+  }
+}
+
+
+// Elements which are not trivially constructible must be constructed and destroyed.
+TEST(ImageBufferAllocator, ContainerOfStrings)
+{
+  using ContainerType = itk::ImportImageContainer<itk::SizeValueType, std::string>;
+  ContainerType::SetDefaultAllocationPolicy(PolicyEnum::Aligned);
+
+  const auto container = ContainerType::New();
+  container->Reserve(10, true);
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    EXPECT_TRUE(container->GetBufferPointer()[i].empty());
+    container->GetBufferPointer()[i] = std::string(100, static_cast<char>('a' + i));
+  }
+  container->Reserve(20);
+  EXPECT_EQ(container->GetBufferPointer()[9], std::string(100, 'j'));
+  EXPECT_TRUE(container->GetBufferPointer()[19].empty());
+
+  ContainerType::ResetDefaultAllocationPolicy();
+}
+
+
+TEST(ImageBufferAllocator, PolicyPerElementType)
+{
+  const GlobalDefaultPolicyGuard guard;
+  itk::ImageBufferAllocator::SetGlobalDefaultPolicy(PolicyEnum::Default);
+
+  using FloatContainerType = itk::ImportImageContainer<itk::SizeValueType, float>;
+  using ShortContainerType = itk::ImportImageContainer<itk::SizeValueType, short>;
+
+  FloatContainerType::SetDefaultAllocationPolicy(PolicyEnum::MemoryMapped);
+  EXPECT_EQ(FloatContainerType::GetDefaultAllocationPolicy(), PolicyEnum::MemoryMapped);
+  EXPECT_EQ(ShortContainerType::GetDefaultAllocationPolicy(), PolicyEnum::Default);
+
+  using ImageType = itk::Image<float, 2>;
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 100, 100 } });
+  image->AllocateInitialized();
+  EXPECT_EQ(image->GetPixelContainer()->GetBufferAllocationPolicy(), PolicyEnum::MemoryMapped);
+  EXPECT_GE(image->GetBufferAlignment(), 4096u);
+  const float * const buffer = image->GetBufferPointer();
+  EXPECT_TRUE(std::all_of(buffer, buffer + 10000, [](const float value) { return value == 0.0f; }));
+
+  // The global default applies again after a reset.
+  FloatContainerType::ResetDefaultAllocationPolicy();
+  itk::ImageBufferAllocator::SetGlobalDefaultPolicy(PolicyEnum::Aligned);
+  EXPECT_EQ(FloatContainerType::GetDefaultAllocationPolicy(), PolicyEnum::Aligned);
+  EXPECT_EQ(ShortContainerType::GetDefaultAllocationPolicy(), PolicyEnum::Aligned);
+
+  EXPECT_THROW(FloatContainerType::SetDefaultAllocationPolicy(PolicyEnum::Unknown), itk::ExceptionObject);
+  EXPECT_THROW(itk::ImageBufferAllocator::SetGlobalDefaultPolicy(PolicyEnum::Unknown), itk::ExceptionObject);
+}
+
+
+TEST(ImageBufferAllocator, HugePageImage)
+{
+  const GlobalDefaultPolicyGuard guard;
+  itk::ImageBufferAllocator::SetGlobalDefaultPolicy(PolicyEnum::HugePage);
+
+  using ImageType = itk::VectorImage<float, 3>;
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 64, 64 } });
+  image->SetNumberOfComponentsPerPixel(3);
+  image->Allocate();
+  EXPECT_GE(image->GetBufferAlignment(), itk::ImageBufferAllocator::HugePageSize);
+  EXPECT_EQ(image->GetPixelContainer()->GetBufferAllocationPolicy(), PolicyEnum::HugePage);
+}
+
+
+// An imported buffer is never released with the allocation policy.
+TEST(ImageBufferAllocator, SetImportPointerResetsPolicy)
+{
+  const GlobalDefaultPolicyGuard guard;
+  itk::ImageBufferAllocator::SetGlobalDefaultPolicy(PolicyEnum::Aligned);
+
+  const auto container = CreateContainer<int>();
+  container->Reserve(100);
+  EXPECT_EQ(container->GetBufferAllocationPolicy(), PolicyEnum::Aligned);
+
+  container->SetImportPointer(new int[50], 50, true);
+  EXPECT_EQ(container->GetBufferAllocationPolicy(), PolicyEnum::Default);
+}
@@ -0,0 +1,202 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkImageBufferPool.h"
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkMultiThreaderBase.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+
+namespace
+{
+using PolicyEnum = itk::ImageBufferAllocationPolicyEnum;
+using ImageType = itk::Image<float, 3>;
+
+// Enables the pool for the duration of a test, and restores its settings afterwards.
+class EnabledPoolGuard
+{
+public:
+  EnabledPoolGuard()
+  {
+    itk::ImageBufferPool::Clear();
+    itk::ImageBufferPool::ResetStatistics();
+    itk::ImageBufferPool::SetEnabled(true);
+  }
+  ~EnabledPoolGuard()
+  {
+    itk::ImageBufferPool::SetEnabled(m_Enabled);
+    itk::ImageBufferPool::SetMaximumNumberOfBytes(m_MaximumNumberOfBytes);
+    itk::ImageBufferPool::SetMinimumNumberOfBytes(m_MinimumNumberOfBytes);
+  }
+
+private:
+  const bool               m_Enabled{ itk::ImageBufferPool::GetEnabled() };
+  const itk::SizeValueType m_MaximumNumberOfBytes{ itk::ImageBufferPool::GetMaximumNumberOfBytes() };
+  const itk::SizeValueType m_MinimumNumberOfBytes{ itk::ImageBufferPool::GetMinimumNumberOfBytes() };
+};
+
+
+ImageType::Pointer
+CreateAllocatedImage(itk::SizeValueType size, bool initializePixels = false)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(size));
+  image->Allocate(initializePixels);
+  return image;
+}
+} // namespace
+
+
+TEST(ImageBufferPool, GetSizeClass)
+{
+  EXPECT_EQ(itk::ImageBufferPool::GetSizeClass(0), 64u);
+  EXPECT_EQ(itk::ImageBufferPool::GetSizeClass(1), 64u);
+  EXPECT_EQ(itk::ImageBufferPool::GetSizeClass(1024), 1024u);
+  EXPECT_EQ(itk::ImageBufferPool::GetSizeClass(1025), 1152u);
+
+  size_t previous = 0;
+  for (size_t numberOfBytes = 1; numberOfBytes < (size_t{ 1 } << 30); numberOfBytes = numberOfBytes * 3 / 2 + 7)
+  {
+    const size_t sizeClass = itk::ImageBufferPool::GetSizeClass(numberOfBytes);
+    EXPECT_GE(sizeClass, numberOfBytes);
+    EXPECT_LE(sizeClass, numberOfBytes + numberOfBytes / 8 + 64);
+    EXPECT_GE(sizeClass, previous);
+    EXPECT_EQ(sizeClass % 64, 0u);
+    previous = sizeClass;
+  }
+}
+
+
+// A buffer released by an image is handed out again to the next image of the same size class.
+TEST(ImageBufferPool, ReusesReleasedBuffers)
+{
+  const EnabledPoolGuard guard;
+
+  auto                image = CreateAllocatedImage(64);
+  const float * const buffer = image->GetBufferPointer();
+  EXPECT_EQ(image->GetPixelContainer()->GetBufferAllocationPolicy(), PolicyEnum::Aligned);
+
+  // As done by the pipeline, with ReleaseDataBeforeUpdateFlag or ReleaseDataFlag.
+  image->PrepareForNewData();
+  EXPECT_EQ(itk::ImageBufferPool::GetStatistics().NumberOfBuffers, 1u);
+
+  // A slightly smaller image uses the same size class.
+  image->SetRegions(ImageType::SizeType{ { 64, 64, 63 } });
+  image->Allocate();
+  EXPECT_EQ(image->GetBufferPointer(), buffer);
+
+  const itk::ImageBufferPool::Statistics statistics = itk::ImageBufferPool::GetStatistics();
+  EXPECT_EQ(statistics.NumberOfHits, 1u);
+  EXPECT_EQ(statistics.NumberOfMisses, 1u);
+  EXPECT_EQ(statistics.NumberOfBuffers, 0u);
+  EXPECT_EQ(statistics.NumberOfBytes, 0u);
+  EXPECT_EQ(statistics.PeakNumberOfBytes, itk::ImageBufferPool::GetSizeClass(64 * 64 * 64 * sizeof(float)));
+
+  std::ostringstream stream;
+  stream << statistics;
+  EXPECT_NE(stream.str().find("Hits: 1"), std::string::npos);
+}
+
+
+// Recycled buffers are not zero-filled by the operating system, the allocator has to do it.
+TEST(ImageBufferPool, RecycledBuffersAreInitialized)
+{
+  const EnabledPoolGuard guard;
+
+  using ContainerType = ImageType::PixelContainer;
+  for (const PolicyEnum policy : { PolicyEnum::Aligned, PolicyEnum::MemoryMapped })
+  {
+    ContainerType::SetDefaultAllocationPolicy(policy);
+    {
+      auto image = CreateAllocatedImage(40);
+      image->FillBuffer(7.0f);
+    }
+    const auto                             image = CreateAllocatedImage(40, true);
+    const itk::ImageBufferRange<ImageType> range(*image);
+    EXPECT_TRUE(std::all_of(range.cbegin(), range.cend(), [](const float pixel) { return pixel == 0.0f; }));
+  }
+  ContainerType::ResetDefaultAllocationPolicy();
+  EXPECT_EQ(itk::ImageBufferPool::GetStatistics().NumberOfHits, 2u);
+}
+
+
+TEST(ImageBufferPool, RespectsLimits)
+{
+  const EnabledPoolGuard guard;
+  const size_t           sizeClass = itk::ImageBufferPool::GetSizeClass(32 * 32 * 32 * sizeof(float));
+  itk::ImageBufferPool::SetMaximumNumberOfBytes(2 * sizeClass);
+
+  {
+    const auto image1 = CreateAllocatedImage(32);
+    const auto image2 = CreateAllocatedImage(32);
+    const auto image3 = CreateAllocatedImage(32);
+  }
+  itk::ImageBufferPool::Statistics statistics = itk::ImageBufferPool::GetStatistics();
+  EXPECT_EQ(statistics.NumberOfBuffers, 2u);
+  EXPECT_EQ(statistics.NumberOfBytes, 2 * sizeClass);
+  EXPECT_EQ(statistics.NumberOfEvictions, 1u);
+
+  itk::ImageBufferPool::SetMaximumNumberOfBytes(sizeClass);
+  EXPECT_EQ(itk::ImageBufferPool::GetStatistics().NumberOfBuffers, 1u);
+
+  // Small buffers are left to the heap.
+  {
+    const auto smallImage = CreateAllocatedImage(4);
+  }
+  EXPECT_EQ(itk::ImageBufferPool::GetStatistics().NumberOfBuffers, 1u);
+
+  itk::ImageBufferPool::Clear();
+  statistics = itk::ImageBufferPool::GetStatistics();
+  EXPECT_EQ(statistics.NumberOfBuffers, 0u);
+  EXPECT_EQ(statistics.NumberOfBytes, 0u);
+
+  // Disabling the pool does not affect the buffers allocated while it was enabled.
+  const auto image = CreateAllocatedImage(32);
+  itk::ImageBufferPool::SetEnabled(false);
+  image->Initialize();
+  EXPECT_EQ(itk::ImageBufferPool::GetStatistics().NumberOfBuffers, 0u);
+}
+
+
+TEST(ImageBufferPool, IsThreadSafe)
+{
+  const EnabledPoolGuard guard;
+  itk::ImageBufferPool::SetMinimumNumberOfBytes(0);
+
+  itk::MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    200,
+    [](itk::SizeValueType i) {
+      const auto image = CreateAllocatedImage(8 + i % 5, true);
+      const itk::ImageBufferRange<ImageType> range(*image);
+      if (!std::all_of(range.cbegin(), range.cend(), [](const float pixel) { return pixel == 0.0f; }))
+      {
+        throw std::runtime_error("Buffer not initialized");
+      }
+      image->FillBuffer(static_cast<float>(i));
+    },
+    nullptr);
+
+  const itk::ImageBufferPool::Statistics statistics = itk::ImageBufferPool::GetStatistics();
+  EXPECT_EQ(statistics.NumberOfHits + statistics.NumberOfMisses, 200u);
+  EXPECT_GE(statistics.NumberOfBuffers, 1u);
+  EXPECT_LE(statistics.NumberOfBuffers, 200u);
+}
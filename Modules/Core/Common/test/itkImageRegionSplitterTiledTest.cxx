@@ -0,0 +1,163 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterTiled.h"
+#include "itkExtractImageFilter.h"
+#include "itkImageRegion.h"
+#include "itkMultiThreaderBase.h"
+#include "itkTestingMacros.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+namespace
+{
+// Checks that the splits cover the region, each pixel once.
+template <unsigned int VDimension>
+bool
+CoversRegion(const itk::ImageRegionSplitterBase * splitter,
+             const itk::ImageRegion<VDimension> & region,
+             unsigned int                         numberOfPieces)
+{
+  const itk::Index<VDimension> start = region.GetIndex();
+  const itk::Size<VDimension>  size = region.GetSize();
+  std::vector<unsigned int>    hits(region.GetNumberOfPixels(), 0);
+  for (unsigned int i = 0; i < numberOfPieces; ++i)
+  {
+    itk::ImageRegion<VDimension> split = region;
+    if (splitter->GetSplit(i, numberOfPieces, split) != numberOfPieces || !region.IsInside(split))
+    {
+      std::cerr << "Invalid split " << i << ": " << split << std::endl;
+      return false;
+    }
+    const itk::SizeValueType numberOfPixels = split.GetNumberOfPixels();
+    for (itk::SizeValueType p = 0; p < numberOfPixels; ++p)
+    {
+      itk::SizeValueType remainder = p;
+      itk::SizeValueType offset = 0;
+      itk::SizeValueType stride = 1;
+      for (unsigned int d = 0; d < VDimension; ++d)
+      {
+        const auto coordinate =
+          split.GetIndex(d) - start[d] + static_cast<itk::IndexValueType>(remainder % split.GetSize(d));
+        remainder /= split.GetSize(d);
+        offset += coordinate * stride;
+        stride *= size[d];
+      }
+      ++hits[offset];
+    }
+  }
+  return std::all_of(hits.cbegin(), hits.cend(), [](unsigned int count) { return count == 1; });
+}
+} // namespace
+
+int
+itkImageRegionSplitterTiledTest(int, char *[])
+{
+  auto splitter = itk::ImageRegionSplitterTiled::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(splitter, ImageRegionSplitterTiled, ImageRegionSplitterBase);
+
+  ITK_TEST_SET_GET_VALUE(32768, splitter->GetTileNumberOfPixels());
+  ITK_TEST_SET_GET_VALUE(4, splitter->GetNumberOfTilesPerWorkUnit());
+
+  // Bricks of about 32768 pixels, which extend over 64 pixels along the first dimension.
+  const itk::ImageRegion<3> volume(itk::Size<3>{ { 256, 256, 256 } });
+  ITK_TEST_EXPECT_EQUAL(splitter->GetNumberOfSplits(volume, 4), 4 * 12 * 12);
+  itk::ImageRegion<3> brick = volume;
+  splitter->GetSplit(0, 4 * 12 * 12, brick);
+  ITK_TEST_EXPECT_EQUAL(brick.GetSize(), (itk::Size<3>{ { 64, 23, 22 } }));
+  brick = volume;
+  splitter->GetSplit(4 * 12 * 12 - 1, 4 * 12 * 12, brick);
+  ITK_TEST_EXPECT_EQUAL(brick.GetIndex(), (itk::Index<3>{ { 192, 253, 242 } }));
+  ITK_TEST_EXPECT_EQUAL(brick.GetSize(), (itk::Size<3>{ { 64, 3, 14 } }));
+  ITK_TEST_EXPECT_TRUE(CoversRegion(splitter.GetPointer(), volume, 4 * 12 * 12));
+
+  // Small regions are divided into at least NumberOfTilesPerWorkUnit tiles per work unit.
+  const itk::ImageRegion<2> region(itk::Index<2>{ { 1, 10 } }, itk::Size<2>{ { 10, 11 } });
+  ITK_TEST_EXPECT_EQUAL(splitter->GetNumberOfSplits(region, 1), 4);
+  ITK_TEST_EXPECT_EQUAL(splitter->GetNumberOfSplits(region, 4), 16);
+  ITK_TEST_EXPECT_TRUE(CoversRegion(splitter.GetPointer(), region, 16));
+  ITK_TEST_EXPECT_EQUAL(splitter->GetNumberOfSplits(region, 1000), 110);
+  ITK_TEST_EXPECT_TRUE(CoversRegion(splitter.GetPointer(), region, 110));
+
+  splitter->SetNumberOfTilesPerWorkUnit(1);
+  ITK_TEST_EXPECT_EQUAL(splitter->GetNumberOfSplits(region, 1), 1);
+
+  // Fixed extents are kept.
+  splitter->SetTileSize({ 4, 0 });
+  ITK_TEST_EXPECT_EQUAL(splitter->GetTileSize().size(), 2);
+  ITK_TEST_EXPECT_EQUAL(splitter->GetNumberOfSplits(region, 4), 6);
+  itk::ImageRegion<2> tile = region;
+  splitter->GetSplit(0, 6, tile);
+  ITK_TEST_EXPECT_EQUAL(tile, (itk::ImageRegion<2>(itk::Index<2>{ { 1, 10 } }, itk::Size<2>{ { 4, 6 } })));
+  tile = region;
+  splitter->GetSplit(5, 6, tile);
+  ITK_TEST_EXPECT_EQUAL(tile, (itk::ImageRegion<2>(itk::Index<2>{ { 9, 16 } }, itk::Size<2>{ { 2, 5 } })));
+  ITK_TEST_EXPECT_TRUE(CoversRegion(splitter.GetPointer(), region, 6));
+
+  // ParallelizeImageRegion processes every tile, even with more tiles than work units.
+  splitter->SetTileSize({});
+  splitter->SetNumberOfTilesPerWorkUnit(4);
+  splitter->SetTileNumberOfPixels(100);
+  const itk::ImageRegion<3> block(itk::Index<3>{ { -3, 5, 7 } }, itk::Size<3>{ { 37, 21, 13 } });
+  const auto                defaultThreader = itk::MultiThreaderBase::GetGlobalDefaultThreader();
+  for (const auto threader : { itk::MultiThreaderBaseEnums::Threader::Platform,
+                               itk::MultiThreaderBaseEnums::Threader::Pool })
+  {
+    itk::MultiThreaderBase::SetGlobalDefaultThreader(threader);
+    auto multiThreader = itk::MultiThreaderBase::New();
+    multiThreader->SetNumberOfWorkUnits(3);
+    multiThreader->SetImageRegionSplitter(splitter);
+    ITK_TEST_EXPECT_EQUAL(multiThreader->GetImageRegionSplitter(), splitter.GetPointer());
+
+    std::atomic<itk::SizeValueType> numberOfPixels{ 0 };
+    std::atomic<unsigned int>       numberOfTiles{ 0 };
+    multiThreader->ParallelizeImageRegion<3>(
+      block,
+      [&numberOfPixels, &numberOfTiles, &block](const itk::ImageRegion<3> & tileRegion) {
+        if (block.IsInside(tileRegion))
+        {
+          numberOfPixels += tileRegion.GetNumberOfPixels();
+        }
+        ++numberOfTiles;
+      },
+      nullptr);
+    ITK_TEST_EXPECT_EQUAL(numberOfPixels, block.GetNumberOfPixels());
+    ITK_TEST_EXPECT_EQUAL(numberOfTiles, splitter->GetNumberOfSplits(block, 3));
+
+    // The progress of the filter is reported once, and completes with the last tile.
+    const auto filter = itk::ExtractImageFilter<itk::Image<float, 3>, itk::Image<float, 3>>::New();
+    std::atomic<bool> completedBeforeTile{ false };
+    multiThreader->ParallelizeImageRegion<3>(
+      block,
+      [&filter, &completedBeforeTile](const itk::ImageRegion<3> &) {
+        if (filter->GetProgress() >= 1.0f)
+        {
+          completedBeforeTile = true;
+        }
+      },
+      filter);
+    ITK_TEST_EXPECT_TRUE(!completedBeforeTile);
+    ITK_TEST_EXPECT_TRUE(filter->GetProgress() > 0.99f);
+  }
+  itk::MultiThreaderBase::SetGlobalDefaultThreader(defaultThreader);
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMultiThreaderBase.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkTestingMacros.h"
+
+#include <atomic>
+
+// Runs parallel sections nested inside the work units of another parallel
+// section, as happens when a filter running in a pool thread updates another
+// filter. With a pool of few threads, all of them end up waiting for nested
+// work units, which must nevertheless complete.
+int
+itkMultiThreaderNestedParallelismTest(int argc, char * argv[])
+{
+  constexpr unsigned int Dimension = 2;
+  using ImageType = itk::Image<unsigned int, Dimension>;
+
+  unsigned int numberOfOuterWorkUnits = 16;
+  if (argc > 1)
+  {
+    numberOfOuterWorkUnits = static_cast<unsigned int>(std::stoi(argv[1]));
+  }
+
+  auto outerThreader = itk::MultiThreaderBase::New();
+  outerThreader->SetNumberOfWorkUnits(numberOfOuterWorkUnits);
+  std::cout << "Threader: " << outerThreader->GetNameOfClass()
+            << ", global default number of threads: " << itk::MultiThreaderBase::GetGlobalDefaultNumberOfThreads()
+            << std::endl;
+
+  constexpr itk::SizeValueType numberOfImages = 32;
+  std::vector<ImageType::Pointer> images(numberOfImages);
+  ImageType::RegionType           region({ { 0, 0 } }, { { 64, 48 } });
+  for (auto & image : images)
+  {
+    image = ImageType::New();
+    image->SetRegions(region);
+    image->AllocateInitialized();
+  }
+
+  std::atomic<itk::SizeValueType> numberOfInnerCalls{ 0 };
+  outerThreader->ParallelizeArray(
+    0,
+    numberOfImages,
+    [&images, &numberOfInnerCalls](itk::SizeValueType i) {
+      // Each outer work unit uses its own threader, like a nested filter would.
+      auto innerThreader = itk::MultiThreaderBase::New();
+      innerThreader->ParallelizeImageRegion<Dimension>(
+        images[i]->GetBufferedRegion(),
+        [&images, i](const ImageType::RegionType & innerRegion) {
+          for (itk::ImageRegionIterator<ImageType> it(images[i], innerRegion); !it.IsAtEnd(); ++it)
+          {
+            it.Set(it.Get() + static_cast<unsigned int>(i) + 1);
+          }
+        },
+        nullptr);
+
+      // A nested ParallelizeArray, two levels deep.
+      innerThreader->ParallelizeArray(
+        0, 8, [&numberOfInnerCalls](itk::SizeValueType) { ++numberOfInnerCalls; }, nullptr);
+    },
+    nullptr);
+
+  bool success = true;
+  for (itk::SizeValueType i = 0; i < numberOfImages; ++i)
+  {
+    for (itk::ImageRegionIterator<ImageType> it(images[i], region); !it.IsAtEnd(); ++it)
+    {
+      if (it.Get() != i + 1)
+      {
+        std::cerr << "Image " << i << ": pixel " << it.GetIndex() << " is " << it.Get() << " instead of " << i + 1
+                  << std::endl;
+        success = false;
+        break;
+      }
+    }
+  }
+  ITK_TEST_EXPECT_EQUAL(numberOfInnerCalls, numberOfImages * 8);
+
+  // An exception thrown by a nested work unit propagates to the outermost caller.
+  ITK_TRY_EXPECT_EXCEPTION(outerThreader->ParallelizeArray(
+    0,
+    numberOfImages,
+    [](itk::SizeValueType) {
+      auto innerThreader = itk::MultiThreaderBase::New();
+      innerThreader->ParallelizeArray(
+        0,
+        8,
+        [](itk::SizeValueType j) {
+          if (j == 5)
+          {
+            itkGenericExceptionMacro("Exception thrown by a nested work unit");
+          }
+        },
+        nullptr);
+    },
+    nullptr));
+
+  if (!success)
+  {
+    std::cout << "Test FAILED!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test PASSED!" << std::endl;
+  return EXIT_SUCCESS;
+}
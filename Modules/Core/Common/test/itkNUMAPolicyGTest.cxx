@@ -0,0 +1,162 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkNUMAPolicy.h"
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkMultiThreaderBase.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace
+{
+// Restores the global NUMA settings at the end of a test.
+class NUMAPolicySettingsGuard
+{
+public:
+  NUMAPolicySettingsGuard() = default;
+  ~NUMAPolicySettingsGuard()
+  {
+    itk::NUMAPolicy::SetGlobalDefaultFirstTouch(m_FirstTouch);
+    itk::NUMAPolicy::SetGlobalDefaultFirstTouchMinimumNumberOfBytes(m_FirstTouchMinimumNumberOfBytes);
+    itk::NUMAPolicy::SetGlobalDefaultThreadPinning(m_ThreadPinning);
+  }
+
+private:
+  const bool               m_FirstTouch{ itk::NUMAPolicy::GetGlobalDefaultFirstTouch() };
+  const itk::SizeValueType m_FirstTouchMinimumNumberOfBytes{
+    itk::NUMAPolicy::GetGlobalDefaultFirstTouchMinimumNumberOfBytes()
+  };
+  const bool m_ThreadPinning{ itk::NUMAPolicy::GetGlobalDefaultThreadPinning() };
+};
+
+
+template <typename TImage>
+typename TImage::Pointer
+CreateImage(const typename TImage::SizeType & size)
+{
+  auto image = TImage::New();
+  image->SetRegions(typename TImage::RegionType({}, size));
+  return image;
+}
+} // namespace
+
+
+TEST(NUMAPolicy, SetAndGetSettings)
+{
+  const NUMAPolicySettingsGuard guard;
+
+  for (const bool value : { true, false })
+  {
+    itk::NUMAPolicy::SetGlobalDefaultFirstTouch(value);
+    EXPECT_EQ(itk::NUMAPolicy::GetGlobalDefaultFirstTouch(), value);
+    itk::NUMAPolicy::SetGlobalDefaultThreadPinning(value);
+    EXPECT_EQ(itk::NUMAPolicy::GetGlobalDefaultThreadPinning(), value);
+  }
+
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouchMinimumNumberOfBytes(1000);
+  EXPECT_EQ(itk::NUMAPolicy::GetGlobalDefaultFirstTouchMinimumNumberOfBytes(), 1000u);
+
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouch(true);
+  EXPECT_TRUE(itk::NUMAPolicy::UseFirstTouch(1000));
+  EXPECT_FALSE(itk::NUMAPolicy::UseFirstTouch(999));
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouch(false);
+  EXPECT_FALSE(itk::NUMAPolicy::UseFirstTouch(1000));
+
+  EXPECT_GE(itk::NUMAPolicy::GetNumberOfNodes(), 1u);
+}
+
+
+// Checks that a first touched buffer is allocated and initialized like a serially allocated one.
+TEST(NUMAPolicy, FirstTouchAllocateInitializesPixels)
+{
+  const NUMAPolicySettingsGuard guard;
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouch(true);
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouchMinimumNumberOfBytes(0);
+
+  using ImageType = itk::Image<float, 3>;
+  const auto image = CreateImage<ImageType>({ { 67, 45, 23 } });
+
+  image->Allocate();
+  const itk::ImageBufferRange<ImageType> range(*image);
+  std::fill(range.begin(), range.end(), 1.0f);
+
+  // Allocating again with the same size keeps the buffer.
+  image->AllocateInitialized();
+  EXPECT_TRUE(std::all_of(range.cbegin(), range.cend(), [](const float pixel) { return pixel == 1.0f; }));
+
+  // A new buffer is zero-initialized in parallel.
+  image->Initialize();
+  image->SetRegions(ImageType::SizeType{ { 67, 45, 23 } });
+  image->AllocateInitialized();
+  const itk::ImageBufferRange<ImageType> newRange(*image);
+  EXPECT_EQ(newRange.size(), 67u * 45u * 23u);
+  EXPECT_TRUE(std::all_of(newRange.cbegin(), newRange.cend(), [](const float pixel) { return pixel == 0.0f; }));
+
+  // Growing the buffer replaces it by a zero-initialized one.
+  std::fill(newRange.begin(), newRange.end(), 1.0f);
+  image->SetRegions(ImageType::SizeType{ { 67, 45, 31 } });
+  image->AllocateInitialized();
+  const itk::ImageBufferRange<ImageType> grownRange(*image);
+  EXPECT_EQ(grownRange.size(), 67u * 45u * 31u);
+  EXPECT_TRUE(std::all_of(grownRange.cbegin(), grownRange.cend(), [](const float pixel) { return pixel == 0.0f; }));
+}
+
+
+TEST(NUMAPolicy, FirstTouchAllocateWithNonZeroIndex)
+{
+  const NUMAPolicySettingsGuard guard;
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouch(true);
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouchMinimumNumberOfBytes(0);
+
+  using ImageType = itk::Image<short, 2>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType({ { -5, 12 } }, { { 1001, 7 } }));
+  image->AllocateInitialized();
+
+  const itk::ImageBufferRange<ImageType> range(*image);
+  EXPECT_TRUE(std::all_of(range.cbegin(), range.cend(), [](const short pixel) { return pixel == 0; }));
+
+  // Uninitialized allocation only touches the pages, the pixels remain writable.
+  image->Initialize();
+  image->SetRegions(ImageType::RegionType({ { -5, 12 } }, { { 1001, 7 } }));
+  image->Allocate();
+  image->FillBuffer(3);
+  const itk::ImageBufferRange<ImageType> newRange(*image);
+  EXPECT_TRUE(std::all_of(newRange.cbegin(), newRange.cend(), [](const short pixel) { return pixel == 3; }));
+}
+
+
+// The pool threads apply the pinning setting before their next job, which must not affect the results.
+TEST(NUMAPolicy, ThreadPinningDoesNotAffectResults)
+{
+  const NUMAPolicySettingsGuard guard;
+
+  for (const bool pinning : { true, false })
+  {
+    itk::NUMAPolicy::SetGlobalDefaultThreadPinning(pinning);
+    std::vector<int> values(1000);
+    itk::MultiThreaderBase::New()->ParallelizeArray(
+      0, values.size(), [&values](itk::SizeValueType i) { values[i] = static_cast<int>(i); }, nullptr);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      EXPECT_EQ(values[i], static_cast<int>(i));
+    }
+  }
+}
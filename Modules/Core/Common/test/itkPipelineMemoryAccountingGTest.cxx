@@ -0,0 +1,185 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkPipelineMemoryAccounting.h"
+#include "itkImage.h"
+#include "itkImageAlgorithm.h"
+#include "itkImageToImageFilter.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+constexpr itk::SizeValueType ImageNumberOfBytes = 64 * 32 * sizeof(float);
+
+class CopyFilter : public itk::ImageToImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CopyFilter);
+
+  using Self = CopyFilter;
+  using Superclass = itk::ImageToImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(CopyFilter);
+
+protected:
+  CopyFilter() = default;
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    itk::ImageAlgorithm::Copy(this->GetInput(), this->GetOutput(), region, region);
+  }
+};
+
+// Enables the accounting for the duration of a test, and restores it afterwards.
+class EnabledAccountingGuard
+{
+public:
+  EnabledAccountingGuard()
+  {
+    itk::PipelineMemoryAccounting::Reset();
+    itk::PipelineMemoryAccounting::SetEnabled(true);
+  }
+  ~EnabledAccountingGuard()
+  {
+    itk::PipelineMemoryAccounting::SetEnabled(m_Enabled);
+    itk::PipelineMemoryAccounting::Reset();
+  }
+
+private:
+  const bool m_Enabled{ itk::PipelineMemoryAccounting::GetEnabled() };
+};
+
+ImageType::Pointer
+CreateImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+  image->AllocateInitialized();
+  return image;
+}
+
+// A chain of three copy filters, the output of the first one being released.
+struct Pipeline
+{
+  Pipeline()
+  {
+    first->SetInput(input);
+    first->SetObjectName("first");
+    first->ReleaseDataFlagOn();
+    second->SetInput(first->GetOutput());
+    second->SetObjectName("second");
+    third->SetInput(second->GetOutput());
+    third->SetObjectName("third");
+  }
+
+  ImageType::Pointer  input{ CreateImage() };
+  CopyFilter::Pointer first{ CopyFilter::New() };
+  CopyFilter::Pointer second{ CopyFilter::New() };
+  CopyFilter::Pointer third{ CopyFilter::New() };
+};
+} // namespace
+
+
+TEST(PipelineMemoryAccounting, AccountsNothingWhenDisabled)
+{
+  EnabledAccountingGuard guard;
+  itk::PipelineMemoryAccounting::SetEnabled(false);
+  Pipeline pipeline;
+  pipeline.third->Update();
+
+  const itk::PipelineMemoryAccounting::Report report = itk::PipelineMemoryAccounting::GetReport();
+  EXPECT_EQ(report.PeakNumberOfBytes, 0u);
+  EXPECT_TRUE(report.ProcessObjects.empty());
+}
+
+
+TEST(PipelineMemoryAccounting, AttributesBuffersToFilters)
+{
+  EnabledAccountingGuard guard;
+  Pipeline               pipeline;
+  pipeline.third->Update();
+
+  const itk::PipelineMemoryAccounting::Report report = itk::PipelineMemoryAccounting::GetReport();
+  ASSERT_EQ(report.ProcessObjects.size(), 3u);
+
+  // The input is allocated outside of a filter.
+  EXPECT_EQ(report.UnattributedLiveNumberOfBytes, ImageNumberOfBytes);
+  EXPECT_EQ(report.LiveNumberOfBytes, 3 * ImageNumberOfBytes);
+  EXPECT_EQ(report.PeakNumberOfBytes, 3 * ImageNumberOfBytes);
+
+  // The output of the first filter is released once the second one is executed.
+  const auto & first = report.ProcessObjects[0];
+  EXPECT_EQ(first.Name, "CopyFilter first");
+  EXPECT_TRUE(first.ReleaseDataFlag);
+  EXPECT_EQ(first.NumberOfExecutions, 1u);
+  EXPECT_EQ(first.LiveNumberOfBytes, 0u);
+  EXPECT_EQ(first.PeakNumberOfBytes, ImageNumberOfBytes);
+  EXPECT_EQ(first.AllocatedNumberOfBytes, ImageNumberOfBytes);
+  EXPECT_EQ(first.NumberOfBytesAtPipelinePeak, ImageNumberOfBytes);
+
+  const auto & second = report.ProcessObjects[1];
+  EXPECT_EQ(second.Name, "CopyFilter second");
+  EXPECT_FALSE(second.ReleaseDataFlag);
+  EXPECT_EQ(second.LiveNumberOfBytes, ImageNumberOfBytes);
+  EXPECT_EQ(second.NumberOfBytesAtPipelinePeak, ImageNumberOfBytes);
+
+  const auto & third = report.ProcessObjects[2];
+  EXPECT_EQ(third.LiveNumberOfBytes, ImageNumberOfBytes);
+  EXPECT_EQ(third.NumberOfBytesAtPipelinePeak, 0u);
+  EXPECT_FALSE(third.IsDestroyed);
+
+  std::ostringstream printed;
+  printed << report;
+  EXPECT_NE(printed.str().find("CopyFilter first: Bytes at peak: 8192"), std::string::npos);
+  EXPECT_NE(printed.str().find("ReleaseDataFlag: On, Outputs: released"), std::string::npos);
+  EXPECT_NE(printed.str().find("ReleaseDataFlag: Off, Outputs: retained"), std::string::npos);
+}
+
+
+TEST(PipelineMemoryAccounting, AccountsReleasesAfterDisabling)
+{
+  EnabledAccountingGuard guard;
+  {
+    Pipeline pipeline;
+    pipeline.third->Update();
+    itk::PipelineMemoryAccounting::SetEnabled(false);
+
+    pipeline.third->GetOutput()->ReleaseData();
+    EXPECT_EQ(itk::PipelineMemoryAccounting::GetReport().ProcessObjects[2].LiveNumberOfBytes, 0u);
+  }
+
+  // The destroyed filters keep their record.
+  const itk::PipelineMemoryAccounting::Report report = itk::PipelineMemoryAccounting::GetReport();
+  EXPECT_EQ(report.LiveNumberOfBytes, 0u);
+  EXPECT_EQ(report.PeakNumberOfBytes, 3 * ImageNumberOfBytes);
+  ASSERT_EQ(report.ProcessObjects.size(), 3u);
+  for (const auto & record : report.ProcessObjects)
+  {
+    EXPECT_TRUE(record.IsDestroyed);
+    EXPECT_EQ(record.LiveNumberOfBytes, 0u);
+  }
+
+  itk::PipelineMemoryAccounting::Reset();
+  EXPECT_TRUE(itk::PipelineMemoryAccounting::GetReport().ProcessObjects.empty());
+}
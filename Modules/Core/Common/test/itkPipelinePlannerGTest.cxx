@@ -0,0 +1,183 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkPipelinePlanner.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkInPlaceImageFilter.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+constexpr itk::SizeValueType ImageNumberOfBytes = 64 * 32 * sizeof(float);
+
+// Adds one to its input, in place when allowed.
+class AddOneFilter : public itk::InPlaceImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AddOneFilter);
+
+  using Self = AddOneFilter;
+  using Superclass = itk::InPlaceImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(AddOneFilter);
+
+protected:
+  AddOneFilter() { this->InPlaceOff(); }
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    itk::ImageRegionConstIterator<ImageType> inputIt(this->GetInput(), region);
+    itk::ImageRegionIterator<ImageType>      outputIt(this->GetOutput(), region);
+    for (; !outputIt.IsAtEnd(); ++inputIt, ++outputIt)
+    {
+      outputIt.Set(inputIt.Get() + 1);
+    }
+  }
+};
+
+ImageType::Pointer
+CreateImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+  image->AllocateInitialized();
+  return image;
+}
+
+AddOneFilter::Pointer
+CreateFilter(const ImageType * input, const char * name)
+{
+  auto filter = AddOneFilter::New();
+  filter->SetInput(input);
+  filter->SetObjectName(name);
+  return filter;
+}
+} // namespace
+
+
+TEST(PipelinePlanner, ReleasesAndOverwritesSingleConsumerOutputs)
+{
+  const ImageType::Pointer    input = CreateImage();
+  const AddOneFilter::Pointer first = CreateFilter(input, "first");
+  const AddOneFilter::Pointer second = CreateFilter(first->GetOutput(), "second");
+  const AddOneFilter::Pointer third = CreateFilter(second->GetOutput(), "third");
+
+  auto planner = itk::PipelinePlanner::New();
+  planner->AddSink(third);
+  planner->Update();
+
+  // The input of the pipeline is not overwritten.
+  EXPECT_FALSE(first->GetInPlace());
+  EXPECT_TRUE(second->GetInPlace());
+  EXPECT_TRUE(third->GetInPlace());
+  EXPECT_EQ(input->GetPixel({ { 0, 0 } }), 0.0f);
+  EXPECT_EQ(third->GetOutput()->GetPixel({ { 63, 31 } }), 3.0f);
+  EXPECT_TRUE(first->GetOutput()->GetDataReleased());
+  EXPECT_TRUE(second->GetOutput()->GetDataReleased());
+  EXPECT_FALSE(third->GetOutput()->GetDataReleased());
+
+  const std::vector<itk::PipelinePlanner::DataObjectPlan> & plans = planner->GetDataObjectPlans();
+  ASSERT_EQ(plans.size(), 4u);
+  EXPECT_EQ(plans[0].Name, "Image");
+  EXPECT_FALSE(plans[0].ReleaseData);
+  EXPECT_FALSE(plans[0].ConsumedInPlace);
+  EXPECT_EQ(plans[1].Name, "AddOneFilter first: Primary");
+  EXPECT_EQ(plans[1].NumberOfConsumers, 1u);
+  EXPECT_EQ(plans[1].NumberOfBytes, ImageNumberOfBytes);
+  EXPECT_TRUE(plans[1].ReleaseData);
+  EXPECT_TRUE(plans[1].ConsumedInPlace);
+  EXPECT_TRUE(plans[2].ConsumedInPlace);
+  EXPECT_EQ(plans[3].NumberOfConsumers, 0u);
+  EXPECT_FALSE(plans[3].ReleaseData);
+
+  EXPECT_EQ(planner->GetProjectedPeakNumberOfBytesBeforePlanning(), 4 * ImageNumberOfBytes);
+  EXPECT_EQ(planner->GetProjectedPeakNumberOfBytes(), 2 * ImageNumberOfBytes);
+}
+
+
+TEST(PipelinePlanner, KeepsSharedAndReferencedOutputs)
+{
+  const ImageType::Pointer    input = CreateImage();
+  const AddOneFilter::Pointer shared = CreateFilter(input, "shared");
+  const AddOneFilter::Pointer left = CreateFilter(shared->GetOutput(), "left");
+  const AddOneFilter::Pointer right = CreateFilter(shared->GetOutput(), "right");
+  const AddOneFilter::Pointer referenced = CreateFilter(right->GetOutput(), "referenced");
+  const AddOneFilter::Pointer last = CreateFilter(referenced->GetOutput(), "last");
+  const ImageType::Pointer    referencedOutput = referenced->GetOutput();
+  // Disabled by the planner, since the input of the filter is shared.
+  left->InPlaceOn();
+
+  auto planner = itk::PipelinePlanner::New();
+  planner->AddSink(left);
+  planner->AddSink(last);
+  planner->Plan();
+
+  const std::vector<itk::PipelinePlanner::DataObjectPlan> & plans = planner->GetDataObjectPlans();
+  ASSERT_EQ(plans.size(), 6u);
+  EXPECT_EQ(plans[1].Name, "AddOneFilter shared: Primary");
+  EXPECT_EQ(plans[1].NumberOfConsumers, 2u);
+  EXPECT_FALSE(plans[1].ReleaseData);
+  EXPECT_FALSE(left->GetInPlace());
+  EXPECT_FALSE(right->GetInPlace());
+
+  // The output of a sink is kept, even when it is consumed once.
+  EXPECT_EQ(plans[2].Name, "AddOneFilter left: Primary");
+  EXPECT_FALSE(plans[2].ReleaseData);
+
+  EXPECT_EQ(plans[3].Name, "AddOneFilter right: Primary");
+  EXPECT_TRUE(plans[3].ReleaseData);
+  EXPECT_TRUE(referenced->GetInPlace());
+  EXPECT_EQ(plans[4].Name, "AddOneFilter referenced: Primary");
+  EXPECT_FALSE(plans[4].ReleaseData);
+  EXPECT_FALSE(last->GetInPlace());
+
+  planner->Update();
+  EXPECT_EQ(left->GetOutput()->GetPixel({ { 0, 0 } }), 2.0f);
+  EXPECT_EQ(last->GetOutput()->GetPixel({ { 0, 0 } }), 4.0f);
+  EXPECT_EQ(referencedOutput->GetPixel({ { 0, 0 } }), 3.0f);
+  EXPECT_FALSE(shared->GetOutput()->GetDataReleased());
+}
+
+
+TEST(PipelinePlanner, RequiresSinks)
+{
+  auto planner = itk::PipelinePlanner::New();
+  EXPECT_THROW(planner->Plan(), itk::ExceptionObject);
+
+  const ImageType::Pointer    input = CreateImage();
+  const AddOneFilter::Pointer filter = CreateFilter(input, "filter");
+  planner->AddSink(filter);
+  planner->Plan();
+
+  std::ostringstream printed;
+  planner->Print(printed);
+  EXPECT_NE(printed.str().find("NumberOfSinks: 1"), std::string::npos);
+  EXPECT_NE(printed.str().find("AddOneFilter filter: Primary: Consumers: 0, Bytes: 8192, ReleaseData: Off"),
+            std::string::npos);
+
+  planner->ClearSinks();
+  EXPECT_TRUE(planner->GetDataObjectPlans().empty());
+  EXPECT_THROW(planner->Plan(), itk::ExceptionObject);
+}
@@ -0,0 +1,511 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkPipelineResultCache.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageToImageFilter.h"
+#include "itkSimpleDataObjectDecorator.h"
+#include "itksys/Directory.hxx"
+#include "itksys/SystemTools.hxx"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+constexpr itk::SizeValueType ImageNumberOfBytes = 16 * 8 * sizeof(float);
+
+// Adds its offset to its input, and counts its executions.
+class AddOffsetFilter : public itk::ImageToImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AddOffsetFilter);
+
+  using Self = AddOffsetFilter;
+  using Superclass = itk::ImageToImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(AddOffsetFilter);
+
+  itkSetMacro(Offset, float);
+
+  bool
+  CanUseResultCache() const override
+  {
+    return true;
+  }
+
+  void
+  PrintResultCacheParameters(std::ostream & os) const override
+  {
+    Superclass::PrintResultCacheParameters(os);
+    os << "Offset: " << m_Offset << std::endl;
+  }
+
+  unsigned int m_NumberOfExecutions{};
+
+protected:
+  AddOffsetFilter() = default;
+
+  void
+  GenerateData() override
+  {
+    ++m_NumberOfExecutions;
+    Superclass::GenerateData();
+  }
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    itk::ImageRegionConstIterator<ImageType> inputIt(this->GetInput(), region);
+    itk::ImageRegionIterator<ImageType>      outputIt(this->GetOutput(), region);
+    for (; !outputIt.IsAtEnd(); ++inputIt, ++outputIt)
+    {
+      outputIt.Set(inputIt.Get() + m_Offset);
+    }
+  }
+
+  void
+  PrintSelf(std::ostream & os, itk::Indent indent) const override
+  {
+    Superclass::PrintSelf(os, indent);
+    os << indent << "Offset: " << m_Offset << std::endl;
+  }
+
+private:
+  float m_Offset{ 1.0f };
+};
+
+// Like AddOffsetFilter, but also computes the sum of its output pixels,
+// which is not one of its outputs, so that it does not opt in the cache.
+class SumAndAddOffsetFilter : public AddOffsetFilter
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SumAndAddOffsetFilter);
+
+  using Self = SumAndAddOffsetFilter;
+  using Superclass = AddOffsetFilter;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(SumAndAddOffsetFilter);
+
+  itkGetConstMacro(Sum, double);
+
+  bool
+  CanUseResultCache() const override
+  {
+    return false;
+  }
+
+protected:
+  SumAndAddOffsetFilter() = default;
+
+  void
+  GenerateData() override
+  {
+    Superclass::GenerateData();
+    m_Sum = 0.0;
+    for (itk::ImageRegionConstIterator<ImageType> it(this->GetOutput(), this->GetOutput()->GetBufferedRegion());
+         !it.IsAtEnd();
+         ++it)
+    {
+      m_Sum += it.Get();
+    }
+  }
+
+  void
+  PrintSelf(std::ostream & os, itk::Indent indent) const override
+  {
+    Superclass::PrintSelf(os, indent);
+    os << indent << "Sum: " << m_Sum << std::endl;
+  }
+
+private:
+  double m_Sum{};
+};
+
+// Computes the maximum of its input, as a decorated output.
+class MaximumFilter : public itk::ProcessObject
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MaximumFilter);
+
+  using Self = MaximumFilter;
+  using Superclass = itk::ProcessObject;
+  using Pointer = itk::SmartPointer<Self>;
+  using DecoratorType = itk::SimpleDataObjectDecorator<float>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(MaximumFilter);
+
+  void
+  SetInput(const ImageType * input)
+  {
+    this->SetNthInput(0, const_cast<ImageType *>(input));
+  }
+
+  const DecoratorType *
+  GetOutput() const
+  {
+    return static_cast<const DecoratorType *>(this->ProcessObject::GetOutput(0));
+  }
+
+  using Superclass::MakeOutput;
+  DataObjectPointer
+  MakeOutput(DataObjectPointerArraySizeType) override
+  {
+    return DecoratorType::New().GetPointer();
+  }
+
+  bool
+  CanUseResultCache() const override
+  {
+    return true;
+  }
+
+  unsigned int m_NumberOfExecutions{};
+
+protected:
+  MaximumFilter()
+  {
+    this->SetNumberOfRequiredInputs(1);
+    this->SetNthOutput(0, this->MakeOutput(0));
+  }
+
+  void
+  GenerateData() override
+  {
+    ++m_NumberOfExecutions;
+    const auto * input = static_cast<const ImageType *>(this->ProcessObject::GetInput(0));
+    float        maximum = itk::NumericTraits<float>::NonpositiveMin();
+    for (itk::ImageRegionConstIterator<ImageType> it(input, input->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      maximum = std::max(maximum, it.Get());
+    }
+    static_cast<DecoratorType *>(this->ProcessObject::GetOutput(0))->Set(maximum);
+  }
+};
+
+// Restores the settings of the cache, and clears it.
+class PipelineResultCacheGuard
+{
+public:
+  PipelineResultCacheGuard()
+    : m_MaximumNumberOfBytes(itk::PipelineResultCache::GetMaximumNumberOfBytes())
+    , m_Directory(itk::PipelineResultCache::GetDirectory())
+  {
+    itk::PipelineResultCache::SetDirectory("");
+    itk::PipelineResultCache::Clear();
+  }
+
+  ~PipelineResultCacheGuard()
+  {
+    itk::PipelineResultCache::SetMaximumNumberOfBytes(m_MaximumNumberOfBytes);
+    itk::PipelineResultCache::SetDirectory(m_Directory);
+    itk::PipelineResultCache::Clear();
+  }
+
+private:
+  const itk::SizeValueType m_MaximumNumberOfBytes;
+  const std::string        m_Directory;
+};
+
+ImageType::Pointer
+CreateImage(float value)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 16, 8 } });
+  image->Allocate();
+  image->FillBuffer(value);
+  return image;
+}
+
+AddOffsetFilter::Pointer
+CreateFilter(const ImageType * input, float offset = 1.0f)
+{
+  auto filter = AddOffsetFilter::New();
+  filter->SetInput(input);
+  filter->SetOffset(offset);
+  filter->UseResultCacheOn();
+  return filter;
+}
+
+// The full names of the entries written to the directory.
+std::vector<std::string>
+GetEntryFileNames(const std::string & directory)
+{
+  std::vector<std::string> fileNames;
+  itksys::Directory        entries;
+  entries.Load(directory);
+  for (unsigned long i = 0; i < entries.GetNumberOfFiles(); ++i)
+  {
+    const std::string fileName = entries.GetFile(i);
+    if (itksys::SystemTools::GetFilenameLastExtension(fileName) == ".itkcache")
+    {
+      fileNames.push_back(directory + '/' + fileName);
+    }
+  }
+  std::sort(fileNames.begin(), fileNames.end());
+  return fileNames;
+}
+
+std::string
+ReadFile(const std::string & fileName)
+{
+  std::ifstream      file(fileName, std::ios::binary);
+  std::ostringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+void
+WriteFile(const std::string & fileName, const std::string & content)
+{
+  std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+  file << content;
+}
+} // namespace
+
+
+TEST(PipelineResultCache, IsDisabledByDefault)
+{
+  const PipelineResultCacheGuard guard;
+
+  const ImageType::Pointer input = CreateImage(2.0f);
+  for (int i = 0; i < 2; ++i)
+  {
+    auto filter = AddOffsetFilter::New();
+    EXPECT_FALSE(filter->GetUseResultCache());
+    filter->SetInput(input);
+    filter->Update();
+    EXPECT_EQ(filter->m_NumberOfExecutions, 1u);
+  }
+  const itk::PipelineResultCache::Statistics statistics = itk::PipelineResultCache::GetStatistics();
+  EXPECT_EQ(statistics.Hits, 0u);
+  EXPECT_EQ(statistics.Misses, 0u);
+  EXPECT_EQ(statistics.NumberOfEntries, 0u);
+}
+
+
+TEST(PipelineResultCache, RestoresOutputsOfEqualInputsAndParameters)
+{
+  const PipelineResultCacheGuard guard;
+
+  const AddOffsetFilter::Pointer first = CreateFilter(CreateImage(2.0f));
+  first->Update();
+  EXPECT_EQ(first->m_NumberOfExecutions, 1u);
+
+  // Another filter, on another image with the same content.
+  const AddOffsetFilter::Pointer second = CreateFilter(CreateImage(2.0f));
+  second->Update();
+  EXPECT_EQ(second->m_NumberOfExecutions, 0u);
+  EXPECT_EQ(second->GetOutput()->GetPixel({ { 15, 7 } }), 3.0f);
+  EXPECT_EQ(second->GetOutput()->GetBufferedRegion(), first->GetOutput()->GetBufferedRegion());
+  EXPECT_NE(second->GetOutput()->GetBufferPointer(), first->GetOutput()->GetBufferPointer());
+  EXPECT_EQ(second->GetProgress(), 1.0f);
+
+  // A change of parameter, or of pixel, is a miss.
+  const AddOffsetFilter::Pointer otherOffset = CreateFilter(CreateImage(2.0f), 5.0f);
+  otherOffset->Update();
+  EXPECT_EQ(otherOffset->m_NumberOfExecutions, 1u);
+  EXPECT_EQ(otherOffset->GetOutput()->GetPixel({ { 0, 0 } }), 7.0f);
+
+  const ImageType::Pointer otherPixel = CreateImage(2.0f);
+  otherPixel->SetPixel({ { 3, 4 } }, 0.0f);
+  const AddOffsetFilter::Pointer otherInput = CreateFilter(otherPixel);
+  otherInput->Update();
+  EXPECT_EQ(otherInput->m_NumberOfExecutions, 1u);
+  EXPECT_EQ(otherInput->GetOutput()->GetPixel({ { 3, 4 } }), 1.0f);
+
+  const itk::PipelineResultCache::Statistics statistics = itk::PipelineResultCache::GetStatistics();
+  EXPECT_EQ(statistics.Hits, 1u);
+  EXPECT_EQ(statistics.DirectoryHits, 0u);
+  EXPECT_EQ(statistics.Misses, 3u);
+  EXPECT_EQ(statistics.NumberOfEntries, 3u);
+  EXPECT_EQ(statistics.NumberOfBytes, 3 * ImageNumberOfBytes);
+}
+
+
+TEST(PipelineResultCache, DistinguishesParametersBeyondPrintedPrecision)
+{
+  const PipelineResultCacheGuard guard;
+
+  // Printed with 6 significant digits, both offsets are "1".
+  const float offset = std::nextafter(1.0f, 2.0f);
+  std::ostringstream printed;
+  printed << offset;
+  ASSERT_EQ(printed.str(), "1");
+
+  CreateFilter(CreateImage(2.0f), 1.0f)->Update();
+  const AddOffsetFilter::Pointer filter = CreateFilter(CreateImage(2.0f), offset);
+  filter->Update();
+  EXPECT_EQ(filter->m_NumberOfExecutions, 1u);
+  EXPECT_EQ(filter->GetOutput()->GetPixel({ { 0, 0 } }), 2.0f + offset);
+  EXPECT_EQ(itk::PipelineResultCache::GetStatistics().Hits, 0u);
+}
+
+
+TEST(PipelineResultCache, ExecutesFiltersWithOtherResultsThanImages)
+{
+  const PipelineResultCacheGuard guard;
+
+  // The sum is computed by each execution, so that it is never stale.
+  for (const float value : { 2.0f, 2.0f, 3.0f })
+  {
+    const auto filter = SumAndAddOffsetFilter::New();
+    filter->SetInput(CreateImage(value));
+    filter->UseResultCacheOn();
+    filter->Update();
+    EXPECT_EQ(filter->m_NumberOfExecutions, 1u);
+    EXPECT_EQ(filter->GetSum(), (value + 1.0) * 16 * 8);
+  }
+
+  // Decorated outputs cannot be restored.
+  for (int i = 0; i < 2; ++i)
+  {
+    const auto filter = MaximumFilter::New();
+    filter->SetInput(CreateImage(5.0f));
+    filter->UseResultCacheOn();
+    filter->Update();
+    EXPECT_EQ(filter->m_NumberOfExecutions, 1u);
+    EXPECT_EQ(filter->GetOutput()->Get(), 5.0f);
+  }
+
+  const itk::PipelineResultCache::Statistics statistics = itk::PipelineResultCache::GetStatistics();
+  EXPECT_EQ(statistics.Hits, 0u);
+  EXPECT_EQ(statistics.Misses, 0u);
+  EXPECT_EQ(statistics.Uncacheable, 5u);
+  EXPECT_EQ(statistics.NumberOfEntries, 0u);
+}
+
+
+TEST(PipelineResultCache, EvictsLeastRecentlyUsedOutputs)
+{
+  const PipelineResultCacheGuard guard;
+  itk::PipelineResultCache::SetMaximumNumberOfBytes(2 * ImageNumberOfBytes);
+
+  CreateFilter(CreateImage(1.0f))->Update();
+  CreateFilter(CreateImage(2.0f))->Update();
+  // Makes the first entry the most recently used one.
+  CreateFilter(CreateImage(1.0f))->Update();
+  CreateFilter(CreateImage(3.0f))->Update();
+
+  EXPECT_EQ(itk::PipelineResultCache::GetStatistics().Evictions, 1u);
+  const AddOffsetFilter::Pointer kept = CreateFilter(CreateImage(1.0f));
+  kept->Update();
+  EXPECT_EQ(kept->m_NumberOfExecutions, 0u);
+  const AddOffsetFilter::Pointer evicted = CreateFilter(CreateImage(2.0f));
+  evicted->Update();
+  EXPECT_EQ(evicted->m_NumberOfExecutions, 1u);
+
+  itk::PipelineResultCache::SetMaximumNumberOfBytes(0);
+  const itk::PipelineResultCache::Statistics statistics = itk::PipelineResultCache::GetStatistics();
+  EXPECT_EQ(statistics.NumberOfEntries, 0u);
+  EXPECT_EQ(statistics.NumberOfBytes, 0u);
+}
+
+
+TEST(PipelineResultCache, RestoresOutputsFromDirectory)
+{
+  const PipelineResultCacheGuard guard;
+  const std::string directory = testing::TempDir() + "itkPipelineResultCacheGTest";
+  itksys::SystemTools::RemoveADirectory(directory);
+  itk::PipelineResultCache::SetDirectory(directory);
+
+  const AddOffsetFilter::Pointer first = CreateFilter(CreateImage(4.0f), 0.5f);
+  first->Update();
+  EXPECT_EQ(first->m_NumberOfExecutions, 1u);
+
+  // Like another process, which starts with an empty memory.
+  itk::PipelineResultCache::Clear();
+  const AddOffsetFilter::Pointer second = CreateFilter(CreateImage(4.0f), 0.5f);
+  second->Update();
+  EXPECT_EQ(second->m_NumberOfExecutions, 0u);
+  EXPECT_EQ(second->GetOutput()->GetPixel({ { 5, 5 } }), 4.5f);
+
+  const itk::PipelineResultCache::Statistics statistics = itk::PipelineResultCache::GetStatistics();
+  EXPECT_EQ(statistics.Hits, 1u);
+  EXPECT_EQ(statistics.DirectoryHits, 1u);
+  EXPECT_EQ(statistics.NumberOfEntries, 1u);
+
+  std::ostringstream printed;
+  printed << statistics;
+  EXPECT_EQ(printed.str(),
+            "Hits: 1, DirectoryHits: 1, Misses: 0, Uncacheable: 0, Evictions: 0, NumberOfEntries: 1, NumberOfBytes: " +
+              std::to_string(ImageNumberOfBytes));
+}
+
+
+TEST(PipelineResultCache, RemovesInvalidEntriesFromDirectory)
+{
+  const PipelineResultCacheGuard guard;
+  const std::string directory = testing::TempDir() + "itkPipelineResultCacheGTestInvalid";
+  itksys::SystemTools::RemoveADirectory(directory);
+  itk::PipelineResultCache::SetDirectory(directory);
+
+  CreateFilter(CreateImage(4.0f))->Update();
+  const std::vector<std::string> fileNames = GetEntryFileNames(directory);
+  ASSERT_EQ(fileNames.size(), 1u);
+  const std::string fileName = fileNames.front();
+  const std::string content = ReadFile(fileName);
+  ASSERT_GT(content.size(), ImageNumberOfBytes + sizeof(itk::SizeValueType));
+
+  // The number of bytes is written before the pixels. The entry claims twice
+  // as many bytes as its buffered region, and has them.
+  std::string inconsistent = content + std::string(ImageNumberOfBytes, '\0');
+  const itk::SizeValueType twiceNumberOfBytes = 2 * ImageNumberOfBytes;
+  inconsistent.replace(content.size() - ImageNumberOfBytes - sizeof(twiceNumberOfBytes),
+                       sizeof(twiceNumberOfBytes),
+                       reinterpret_cast<const char *>(&twiceNumberOfBytes),
+                       sizeof(twiceNumberOfBytes));
+  const std::string truncated = content.substr(0, content.size() - 1);
+
+  // The entry of a larger image, written at the key of the 16x8 image.
+  const auto largerImage = ImageType::New();
+  largerImage->SetRegions(ImageType::SizeType{ { 32, 8 } });
+  largerImage->Allocate();
+  largerImage->FillBuffer(4.0f);
+  itk::PipelineResultCache::Clear();
+  itksys::SystemTools::RemoveFile(fileName);
+  CreateFilter(largerImage)->Update();
+  ASSERT_EQ(GetEntryFileNames(directory).size(), 1u);
+  const std::string otherImage = ReadFile(GetEntryFileNames(directory).front());
+
+  for (const std::string & invalid : { inconsistent, truncated, otherImage })
+  {
+    itk::PipelineResultCache::Clear();
+    WriteFile(fileName, invalid);
+    const AddOffsetFilter::Pointer filter = CreateFilter(CreateImage(4.0f));
+    filter->Update();
+    EXPECT_EQ(filter->m_NumberOfExecutions, 1u);
+    EXPECT_EQ(filter->GetOutput()->GetBufferedRegion().GetNumberOfPixels(), 16u * 8u);
+    EXPECT_EQ(filter->GetOutput()->GetPixel({ { 15, 7 } }), 5.0f);
+    EXPECT_EQ(itk::PipelineResultCache::GetStatistics().Misses, 1u);
+    // The invalid entry is replaced by the one of this execution.
+    EXPECT_EQ(ReadFile(fileName), content);
+  }
+  itksys::SystemTools::RemoveADirectory(directory);
+}
@@ -0,0 +1,196 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkPipelineTracer.h"
+#include "itkImage.h"
+#include "itkImageAlgorithm.h"
+#include "itkImageToImageFilter.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+
+// Copies its input, with DynamicThreadedGenerateData() or with the classic
+// ThreadedGenerateData().
+class CopyFilter : public itk::ImageToImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CopyFilter);
+
+  using Self = CopyFilter;
+  using Superclass = itk::ImageToImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(CopyFilter);
+
+  using Superclass::DynamicMultiThreadingOff;
+
+protected:
+  CopyFilter() = default;
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    itk::ImageAlgorithm::Copy(this->GetInput(), this->GetOutput(), region, region);
+  }
+
+  void
+  ThreadedGenerateData(const OutputImageRegionType & region, itk::ThreadIdType) override
+  {
+    this->DynamicThreadedGenerateData(region);
+  }
+};
+
+// Enables the tracer for the duration of a test, and restores its settings afterwards.
+class EnabledTracerGuard
+{
+public:
+  EnabledTracerGuard()
+  {
+    itk::PipelineTracer::Clear();
+    itk::PipelineTracer::SetEnabled(true);
+  }
+  ~EnabledTracerGuard()
+  {
+    itk::PipelineTracer::SetEnabled(m_Enabled);
+    itk::PipelineTracer::SetMaximumNumberOfEvents(m_MaximumNumberOfEvents);
+    itk::PipelineTracer::Clear();
+  }
+
+private:
+  const bool               m_Enabled{ itk::PipelineTracer::GetEnabled() };
+  const itk::SizeValueType m_MaximumNumberOfEvents{ itk::PipelineTracer::GetMaximumNumberOfEvents() };
+};
+
+ImageType::Pointer
+CreateImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+  image->AllocateInitialized();
+  return image;
+}
+
+// Executes two copy filters, the second one with the classic multi-threading.
+CopyFilter::Pointer
+ExecutePipeline()
+{
+  auto first = CopyFilter::New();
+  first->SetInput(CreateImage());
+  first->SetNumberOfWorkUnits(3);
+  auto second = CopyFilter::New();
+  second->SetInput(first->GetOutput());
+  second->SetNumberOfWorkUnits(2);
+  second->DynamicMultiThreadingOff();
+  second->SetObjectName("second \"copy\"");
+  second->Update();
+  return second;
+}
+} // namespace
+
+
+TEST(PipelineTracer, RecordsNothingWhenDisabled)
+{
+  EnabledTracerGuard guard;
+  itk::PipelineTracer::SetEnabled(false);
+  ExecutePipeline();
+  EXPECT_TRUE(itk::PipelineTracer::GetEvents().empty());
+}
+
+
+TEST(PipelineTracer, RecordsFiltersAndWorkUnits)
+{
+  EnabledTracerGuard guard;
+  ExecutePipeline();
+
+  const std::vector<itk::PipelineTracer::Event> events = itk::PipelineTracer::GetEvents();
+  std::vector<itk::PipelineTracer::Event>       filterEvents;
+  std::copy_if(events.cbegin(), events.cend(), std::back_inserter(filterEvents), [](const auto & event) {
+    return event.Category == "Filter";
+  });
+  ASSERT_EQ(filterEvents.size(), 2u);
+  EXPECT_EQ(filterEvents[0].Name, "CopyFilter");
+  EXPECT_EQ(filterEvents[1].Name, "CopyFilter second \"copy\"");
+
+  for (const auto & filterEvent : filterEvents)
+  {
+    EXPECT_EQ(filterEvent.Region, "[0, 0] [64, 32]");
+    EXPECT_GE(filterEvent.NumberOfBytesAllocated, 64u * 32u * sizeof(float));
+    EXPECT_GT(filterEvent.ThreadId, 0u);
+
+    // The work units are executed during the execution of their filter, and
+    // cover its requested region.
+    itk::SizeValueType numberOfPixels = 0;
+    for (const auto & event : events)
+    {
+      if (event.Category == "WorkUnit" && event.Name == filterEvent.Name)
+      {
+        EXPECT_GE(event.StartTime, filterEvent.StartTime);
+        EXPECT_LE(event.StartTime + event.Duration, filterEvent.StartTime + filterEvent.Duration);
+        std::istringstream region(event.Region);
+        char               c;
+        long               index0, index1, size0, size1;
+        region >> c >> index0 >> c >> index1 >> c >> c >> size0 >> c >> size1;
+        numberOfPixels += static_cast<itk::SizeValueType>(size0 * size1);
+      }
+    }
+    EXPECT_EQ(numberOfPixels, 64u * 32u);
+  }
+}
+
+
+TEST(PipelineTracer, WritesChromeTrace)
+{
+  EnabledTracerGuard guard;
+  ExecutePipeline();
+
+  std::ostringstream trace;
+  itk::PipelineTracer::WriteChromeTrace(trace);
+  const std::string json = trace.str();
+  EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(json.find("\"name\":\"CopyFilter second \\\"copy\\\"\",\"cat\":\"Filter\",\"ph\":\"X\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"region\":\"[0, 0] [64, 32]\",\"bytesAllocated\":"), std::string::npos);
+  EXPECT_NE(json.find("\"cat\":\"WorkUnit\""), std::string::npos);
+  const std::string end = "\n],\"displayTimeUnit\":\"ms\"}\n";
+  EXPECT_EQ(json.substr(json.size() - end.size()), end);
+
+  EXPECT_THROW(itk::PipelineTracer::WriteChromeTrace(std::string("/nonexistent/directory/trace.json")),
+               itk::ExceptionObject);
+}
+
+
+TEST(PipelineTracer, DropsEventsBeyondMaximum)
+{
+  EnabledTracerGuard guard;
+  itk::PipelineTracer::SetMaximumNumberOfEvents(1);
+  EXPECT_EQ(itk::PipelineTracer::GetMaximumNumberOfEvents(), 1u);
+  ExecutePipeline();
+  EXPECT_EQ(itk::PipelineTracer::GetEvents().size(), 1u);
+  EXPECT_GT(itk::PipelineTracer::GetNumberOfDroppedEvents(), 0u);
+
+  itk::PipelineTracer::Clear();
+  EXPECT_TRUE(itk::PipelineTracer::GetEvents().empty());
+  EXPECT_EQ(itk::PipelineTracer::GetNumberOfDroppedEvents(), 0u);
+}
@@ -0,0 +1,120 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkPixelSpan.h"
+#include "itkImage.h"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+using ImageType = itk::Image<int, 3>;
+
+ImageType::Pointer
+CreateImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType({ { 1, 2, 3 } }, { { 5, 4, 3 } }));
+  image->Allocate();
+  std::iota(image->GetBufferPointer(), image->GetBufferPointer() + image->GetBufferedRegion().GetNumberOfPixels(), 0);
+  return image;
+}
+} // namespace
+
+
+TEST(PixelSpan, HasTheInterfaceOfSpan)
+{
+  int                        pixels[] = { 3, 1, 4 };
+  const itk::PixelSpan<int>  span(pixels, 3);
+  const itk::PixelSpan<int>  empty;
+  itk::PixelSpan<const int>  constSpan(pixels, 2);
+
+  EXPECT_EQ(span.data(), pixels);
+  EXPECT_EQ(span.size(), 3u);
+  EXPECT_FALSE(span.empty());
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(std::accumulate(span.begin(), span.end(), 0), 8);
+  span[1] = 5;
+  EXPECT_EQ(constSpan[1], 5);
+  EXPECT_EQ(constSpan.end(), pixels + 2);
+}
+
+
+TEST(PixelSpan, VisitsTheBufferedRegionAtOnce)
+{
+  const ImageType::Pointer input = CreateImage();
+  const ImageType::Pointer output = CreateImage();
+
+  std::vector<itk::SizeValueType> sizes;
+  itk::ForEachPixelSpan(
+    input->GetBufferedRegion(),
+    [&sizes](itk::PixelSpan<const int> in, itk::PixelSpan<int> out) {
+      sizes.push_back(out.size());
+      for (itk::SizeValueType i = 0; i < out.size(); ++i)
+      {
+        out[i] = 2 * in[i];
+      }
+    },
+    static_cast<const ImageType *>(input),
+    output.GetPointer());
+
+  EXPECT_EQ(sizes, std::vector<itk::SizeValueType>{ 60 });
+  EXPECT_EQ(output->GetPixel({ { 5, 5, 5 } }), 2 * input->GetPixel({ { 5, 5, 5 } }));
+
+  // A slice of the image is contiguous too.
+  sizes.clear();
+  itk::ForEachPixelSpan(
+    ImageType::RegionType({ { 1, 2, 4 } }, { { 5, 4, 1 } }),
+    [&sizes](itk::PixelSpan<int> out) {
+      sizes.push_back(out.size());
+      EXPECT_EQ(out[0], 2 * 20);
+    },
+    output.GetPointer());
+  EXPECT_EQ(sizes, std::vector<itk::SizeValueType>{ 20 });
+}
+
+
+TEST(PixelSpan, VisitsLinesOfOtherRegions)
+{
+  const ImageType::Pointer image = CreateImage();
+
+  const ImageType::RegionType region({ { 2, 3, 3 } }, { { 3, 2, 2 } });
+  std::vector<int>            visited;
+  itk::ForEachPixelSpan(
+    region,
+    [&visited](itk::PixelSpan<const int> pixels) {
+      EXPECT_EQ(pixels.size(), 3u);
+      visited.insert(visited.end(), pixels.begin(), pixels.end());
+    },
+    static_cast<const ImageType *>(image));
+
+  std::vector<int> expected;
+  for (const auto & index : itk::ImageRegionIndexRange<3>(region))
+  {
+    expected.push_back(image->GetPixel(index));
+  }
+  EXPECT_EQ(visited, expected);
+
+  // No call for an empty region.
+  itk::ForEachPixelSpan(
+    ImageType::RegionType({ { 2, 3, 3 } }, { { 0, 2, 2 } }),
+    [](itk::PixelSpan<const int>) { ADD_FAILURE(); },
+    static_cast<const ImageType *>(image));
+}
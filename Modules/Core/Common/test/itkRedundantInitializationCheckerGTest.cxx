@@ -0,0 +1,162 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkRedundantInitializationChecker.h"
+#include "itkImage.h"
+#include "itkImageSource.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// Enables the checker for the duration of a test, and restores its state afterwards.
+class EnabledCheckerGuard
+{
+public:
+  EnabledCheckerGuard()
+  {
+    itk::RedundantInitializationChecker::Clear();
+    itk::RedundantInitializationChecker::SetEnabled(true);
+  }
+  ~EnabledCheckerGuard()
+  {
+    itk::RedundantInitializationChecker::SetEnabled(m_Enabled);
+    itk::RedundantInitializationChecker::Clear();
+  }
+
+private:
+  const bool m_Enabled{ itk::RedundantInitializationChecker::GetEnabled() };
+};
+
+
+// Zero-initializes its output, and then sets the given number of pixels to one.
+class ZeroingImageSource : public itk::ImageSource<ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ZeroingImageSource);
+
+  using Self = ZeroingImageSource;
+  using Superclass = itk::ImageSource<ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(ZeroingImageSource);
+
+  itkSetMacro(NumberOfPixelsToSet, itk::SizeValueType);
+  itkSetMacro(InitializePixels, bool);
+
+protected:
+  ZeroingImageSource() = default;
+  ~ZeroingImageSource() override = default;
+
+  void
+  GenerateOutputInformation() override
+  {
+    this->GetOutput()->SetLargestPossibleRegion(ImageType::RegionType(ImageType::SizeType::Filled(8)));
+  }
+
+  void
+  GenerateData() override
+  {
+    ImageType * const output = this->GetOutput();
+    output->SetBufferedRegion(output->GetRequestedRegion());
+    output->Allocate(m_InitializePixels);
+    std::fill_n(output->GetBufferPointer(), m_NumberOfPixelsToSet, 1.0f);
+  }
+
+private:
+  itk::SizeValueType m_NumberOfPixelsToSet{};
+  bool               m_InitializePixels{ true };
+};
+
+
+itk::RedundantInitializationChecker::RecordMapType
+RunSource(itk::SizeValueType numberOfPixelsToSet, bool initializePixels = true)
+{
+  itk::RedundantInitializationChecker::Clear();
+  auto source = ZeroingImageSource::New();
+  source->SetNumberOfPixelsToSet(numberOfPixelsToSet);
+  source->SetInitializePixels(initializePixels);
+  source->Update();
+  return itk::RedundantInitializationChecker::GetRecords();
+}
+} // namespace
+
+
+TEST(RedundantInitializationChecker, ReportsFullyOverwrittenOutputs)
+{
+  const EnabledCheckerGuard guard;
+
+  const auto records = RunSource(512);
+  ASSERT_EQ(records.size(), 1u);
+  const auto record = records.find("ZeroingImageSource");
+  ASSERT_NE(record, records.cend());
+  EXPECT_EQ(record->second.NumberOfBuffers, 1u);
+  EXPECT_EQ(record->second.NumberOfBytes, 512 * sizeof(float));
+}
+
+
+TEST(RedundantInitializationChecker, IgnoresOutputsKeepingZeros)
+{
+  const EnabledCheckerGuard guard;
+
+  EXPECT_TRUE(RunSource(511).empty());
+  EXPECT_TRUE(RunSource(0).empty());
+}
+
+
+TEST(RedundantInitializationChecker, IgnoresUninitializedOutputs)
+{
+  const EnabledCheckerGuard guard;
+
+  EXPECT_TRUE(RunSource(512, false).empty());
+}
+
+
+TEST(RedundantInitializationChecker, IsInactiveWhenDisabled)
+{
+  const EnabledCheckerGuard guard;
+  itk::RedundantInitializationChecker::SetEnabled(false);
+
+  EXPECT_TRUE(RunSource(512).empty());
+}
+
+
+TEST(RedundantInitializationChecker, AccumulatesRecords)
+{
+  const EnabledCheckerGuard guard;
+
+  // An image without source is reported under its own class name, once per allocation.
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(4));
+  for (int i = 0; i < 3; ++i)
+  {
+    image->AllocateInitialized();
+    image->FillBuffer(2.0f);
+    image->DataHasBeenGenerated();
+    image->DataHasBeenGenerated();
+  }
+
+  const auto records = itk::RedundantInitializationChecker::GetRecords();
+  ASSERT_EQ(records.count("Image"), 1u);
+  EXPECT_EQ(records.at("Image").NumberOfBuffers, 3u);
+  EXPECT_EQ(records.at("Image").NumberOfBytes, 3 * 64 * sizeof(float));
+}
@@ -0,0 +1,79 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkSIMDPixelTransform.h"
+#include "itkImage.h"
+#include "itkRGBPixel.h"
+#include "itkVectorImage.h"
+#include <gtest/gtest.h>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+static_assert(itk::HasPixelArrayBuffer<itk::Image<float, 3>>);
+static_assert(itk::HasPixelArrayBuffer<itk::Image<itk::RGBPixel<unsigned char>, 2>>);
+static_assert(!itk::HasPixelArrayBuffer<itk::VectorImage<float, 3>>);
+static_assert(itk::HasVectorPixelArrayBuffer<itk::VectorImage<float, 3>>);
+static_assert(!itk::HasVectorPixelArrayBuffer<itk::Image<float, 3>>);
+static_assert(!itk::Functor::IsSIMDVectorizable<std::negate<float>>::value);
+
+
+TEST(SIMDPixelTransform, IsContiguousInBuffer)
+{
+  using RegionType = itk::ImageRegion<3>;
+  const RegionType bufferedRegion({ { 1, 2, 3 } }, { { 10, 20, 30 } });
+
+  EXPECT_TRUE(itk::IsContiguousInBuffer(bufferedRegion, bufferedRegion));
+  // Whole slices, whole lines, and a part of a line.
+  EXPECT_TRUE(itk::IsContiguousInBuffer(RegionType({ { 1, 2, 5 } }, { { 10, 20, 7 } }), bufferedRegion));
+  EXPECT_TRUE(itk::IsContiguousInBuffer(RegionType({ { 1, 4, 5 } }, { { 10, 3, 1 } }), bufferedRegion));
+  EXPECT_TRUE(itk::IsContiguousInBuffer(RegionType({ { 4, 4, 5 } }, { { 2, 1, 1 } }), bufferedRegion));
+
+  EXPECT_FALSE(itk::IsContiguousInBuffer(RegionType({ { 1, 4, 5 } }, { { 10, 3, 2 } }), bufferedRegion));
+  EXPECT_FALSE(itk::IsContiguousInBuffer(RegionType({ { 4, 4, 5 } }, { { 2, 2, 1 } }), bufferedRegion));
+}
+
+
+TEST(SIMDPixelTransform, TransformsAllPixels)
+{
+  // Not a multiple of the length of the blocks, to check the last pixels.
+  constexpr itk::SizeValueType numberOfPixels = 1000 + 13;
+
+  std::vector<unsigned short> input(numberOfPixels);
+  std::iota(input.begin(), input.end(), 0);
+  std::vector<float> output(numberOfPixels);
+  itk::SIMDTransformPixels([](unsigned short a) { return 0.5f * a; }, input.data(), output.data(), numberOfPixels);
+  for (itk::SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    EXPECT_EQ(output[i], 0.5f * i);
+  }
+
+  std::vector<float> sum(numberOfPixels);
+  itk::SIMDTransformPixels(
+    [](unsigned short a, float b) { return a + b; }, input.data(), output.data(), sum.data(), numberOfPixels);
+  for (itk::SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    EXPECT_EQ(sum[i], 1.5f * i);
+  }
+
+  // In place.
+  itk::SIMDTransformPixels([](float a) { return a - 1.0f; }, sum.data(), sum.data(), numberOfPixels);
+  EXPECT_EQ(sum.front(), -1.0f);
+  EXPECT_EQ(sum.back(), 1.5f * (numberOfPixels - 1) - 1.0f);
+}
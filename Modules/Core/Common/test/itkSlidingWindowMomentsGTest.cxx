@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkSlidingWindowMoments.h"
+#include "itkConstNeighborhoodIterator.h"
+#include <gtest/gtest.h>
+
+namespace
+{
+template <unsigned int VDimension>
+typename itk::Image<short, VDimension>::Pointer
+CreateImage(const itk::ImageRegion<VDimension> & bufferedRegion)
+{
+  using ImageType = itk::Image<short, VDimension>;
+  auto image = ImageType::New();
+  image->SetRegions(bufferedRegion);
+  image->Allocate();
+  short * const pixels = image->GetBufferPointer();
+  for (itk::SizeValueType i = 0; i < bufferedRegion.GetNumberOfPixels(); ++i)
+  {
+    pixels[i] = static_cast<short>((i * 7919) % 201 - 100);
+  }
+  return image;
+}
+
+// Compares the sums with the sums of the neighborhoods of a
+// ConstNeighborhoodIterator, with its zero flux Neumann boundary condition.
+template <unsigned int VDimension>
+void
+ExpectSumsOfNeighborhoods(const itk::Image<short, VDimension> &                                 image,
+                          const itk::ImageRegion<VDimension> &                                  region,
+                          const typename itk::Image<short, VDimension>::SizeType &              radius,
+                          const itk::SlidingWindowMoments<itk::Image<short, VDimension>> & moments)
+{
+  using ImageType = itk::Image<short, VDimension>;
+  ASSERT_EQ(moments.GetSums().size(), region.GetNumberOfPixels());
+  ASSERT_EQ(moments.GetSumsOfSquares().size(), region.GetNumberOfPixels());
+
+  itk::ConstNeighborhoodIterator<ImageType> it(radius, &image, region);
+  EXPECT_EQ(moments.GetNumberOfPixelsPerWindow(), it.Size());
+  for (itk::SizeValueType i = 0; !it.IsAtEnd(); ++it, ++i)
+  {
+    double sum = 0.0;
+    double sumOfSquares = 0.0;
+    for (itk::SizeValueType n = 0; n < it.Size(); ++n)
+    {
+      sum += it.GetPixel(n);
+      sumOfSquares += it.GetPixel(n) * it.GetPixel(n);
+    }
+    ASSERT_EQ(moments.GetSums()[i], sum) << " at " << it.GetIndex();
+    ASSERT_EQ(moments.GetSumsOfSquares()[i], sumOfSquares) << " at " << it.GetIndex();
+  }
+}
+} // namespace
+
+
+TEST(SlidingWindowMoments, ComputesTheSumsOfTheNeighborhoods)
+{
+  using ImageType = itk::Image<short, 3>;
+  const ImageType::RegionType bufferedRegion({ { -3, 2, 1 } }, { { 13, 9, 7 } });
+  const ImageType::Pointer    image = CreateImage(bufferedRegion);
+
+  itk::SlidingWindowMoments<ImageType> moments;
+
+  // The whole image, with boxes which overlap the boundary.
+  moments.Compute(*image, bufferedRegion, { { 2, 1, 3 } }, true);
+  ExpectSumsOfNeighborhoods(*image, bufferedRegion, { { 2, 1, 3 } }, moments);
+
+  // Boxes larger than the image.
+  moments.Compute(*image, bufferedRegion, { { 15, 0, 9 } }, true);
+  ExpectSumsOfNeighborhoods(*image, bufferedRegion, { { 15, 0, 9 } }, moments);
+
+  // A part of the image, whose boxes are partly inside the buffer.
+  const ImageType::RegionType region({ { 0, 3, 4 } }, { { 6, 5, 4 } });
+  moments.Compute(*image, region, { { 1, 2, 2 } }, true);
+  EXPECT_EQ(moments.GetRegion(), region);
+  ExpectSumsOfNeighborhoods(*image, region, { { 1, 2, 2 } }, moments);
+
+  // Without the sums of squares.
+  moments.Compute(*image, region, { { 1, 2, 2 } });
+  EXPECT_EQ(moments.GetSums().size(), region.GetNumberOfPixels());
+  EXPECT_TRUE(moments.GetSumsOfSquares().empty());
+}
+
+
+TEST(SlidingWindowMoments, ComputesTheMomentsIn2D)
+{
+  using ImageType = itk::Image<short, 2>;
+  const ImageType::RegionType bufferedRegion({ { 0, 0 } }, { { 17, 11 } });
+  const ImageType::Pointer    image = CreateImage(bufferedRegion);
+
+  itk::SlidingWindowMoments<ImageType> moments;
+  moments.Compute(*image, bufferedRegion, { { 3, 4 } }, true);
+  ExpectSumsOfNeighborhoods(*image, bufferedRegion, { { 3, 4 } }, moments);
+
+  const double num = 7 * 9;
+  const double sum = moments.GetSums()[20];
+  EXPECT_DOUBLE_EQ(moments.GetMean(20), sum / num);
+  EXPECT_DOUBLE_EQ(moments.GetVariance(20), (moments.GetSumsOfSquares()[20] - sum * sum / num) / (num - 1));
+}
+
+
+TEST(SlidingWindowMoments, RejectsRegionsOutsideTheBuffer)
+{
+  using ImageType = itk::Image<short, 2>;
+  const ImageType::Pointer image = CreateImage(ImageType::RegionType({ { 0, 0 } }, { { 4, 4 } }));
+
+  itk::SlidingWindowMoments<ImageType> moments;
+  EXPECT_THROW(moments.Compute(*image, ImageType::RegionType({ { 2, 2 } }, { { 3, 1 } }), { { 1, 1 } }),
+               itk::ExceptionObject);
+
+  moments.Compute(*image, ImageType::RegionType({ { 2, 2 } }, { { 0, 1 } }), { { 1, 1 } });
+  EXPECT_TRUE(moments.GetSums().empty());
+}
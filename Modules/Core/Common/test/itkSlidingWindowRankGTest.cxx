@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkSlidingWindowRank.h"
+#include "itkConstNeighborhoodIterator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace
+{
+template <typename TPixel, unsigned int VDimension>
+typename itk::Image<TPixel, VDimension>::Pointer
+CreateImage(const itk::ImageRegion<VDimension> & bufferedRegion, const int numberOfValues)
+{
+  using ImageType = itk::Image<TPixel, VDimension>;
+  auto image = ImageType::New();
+  image->SetRegions(bufferedRegion);
+  image->Allocate();
+  TPixel * const pixels = image->GetBufferPointer();
+  for (itk::SizeValueType i = 0; i < bufferedRegion.GetNumberOfPixels(); ++i)
+  {
+    pixels[i] = static_cast<TPixel>(static_cast<int>((i * 7919) % numberOfValues) - numberOfValues / 4);
+  }
+  return image;
+}
+
+// Compares the values with the k-th smallest pixels of the neighborhoods of a
+// ConstNeighborhoodIterator, whose pixels outside the buffer are either the
+// pixels of its zero flux Neumann boundary condition, or ignored.
+template <typename TImage>
+void
+ExpectRanksOfNeighborhoods(const TImage &                                image,
+                           const typename TImage::RegionType &           region,
+                           const typename TImage::SizeType &             radius,
+                           const float                                   rank,
+                           const bool                                    cropAtBoundary,
+                           const itk::SlidingWindowRank<TImage> &        slidingWindowRank)
+{
+  ASSERT_EQ(slidingWindowRank.GetValues().size(), region.GetNumberOfPixels());
+
+  itk::ConstNeighborhoodIterator<TImage>  it(radius, &image, region);
+  std::vector<typename TImage::PixelType> pixels;
+  for (itk::SizeValueType i = 0; !it.IsAtEnd(); ++it, ++i)
+  {
+    pixels.clear();
+    for (itk::SizeValueType n = 0; n < it.Size(); ++n)
+    {
+      if (!cropAtBoundary || image.GetBufferedRegion().IsInside(it.GetIndex(n)))
+      {
+        pixels.push_back(it.GetPixel(n));
+      }
+    }
+    const auto k = static_cast<itk::SizeValueType>(rank * static_cast<float>(pixels.size() - 1));
+    std::nth_element(pixels.begin(), pixels.begin() + k, pixels.end());
+    ASSERT_EQ(slidingWindowRank.GetValues()[i], pixels[k]) << " at " << it.GetIndex();
+  }
+}
+
+template <typename TPixel>
+void
+ExpectRanksOfNeighborhoodsIn3D(const int numberOfValues)
+{
+  using ImageType = itk::Image<TPixel, 3>;
+  const typename ImageType::RegionType bufferedRegion({ { -3, 2, 1 } }, { { 13, 9, 7 } });
+  const auto                           image = CreateImage<TPixel>(bufferedRegion, numberOfValues);
+  const typename ImageType::RegionType region({ { 0, 3, 4 } }, { { 6, 5, 4 } });
+
+  itk::SlidingWindowRank<ImageType> slidingWindowRank;
+  for (const bool cropAtBoundary : { false, true })
+  {
+    for (const float rank : { 0.5f, 0.0f, 1.0f, 0.3f })
+    {
+      slidingWindowRank.Compute(*image, bufferedRegion, { { 2, 1, 3 } }, rank, cropAtBoundary);
+      ExpectRanksOfNeighborhoods(*image, bufferedRegion, { { 2, 1, 3 } }, rank, cropAtBoundary, slidingWindowRank);
+
+      slidingWindowRank.Compute(*image, region, { { 1, 2, 9 } }, rank, cropAtBoundary);
+      EXPECT_EQ(slidingWindowRank.GetRegion(), region);
+      ExpectRanksOfNeighborhoods(*image, region, { { 1, 2, 9 } }, rank, cropAtBoundary, slidingWindowRank);
+    }
+  }
+}
+} // namespace
+
+
+TEST(SlidingWindowRank, ComputesTheRanksOfTheNeighborhoodsOfIntegers)
+{
+  static_assert(itk::SlidingWindowRank<itk::Image<short, 3>>::UsesPixelValueBins);
+  ExpectRanksOfNeighborhoodsIn3D<unsigned char>(200);
+  ExpectRanksOfNeighborhoodsIn3D<short>(9000);
+}
+
+
+TEST(SlidingWindowRank, ComputesTheRanksOfTheNeighborhoodsOfOtherPixels)
+{
+  static_assert(!itk::SlidingWindowRank<itk::Image<float, 3>>::UsesPixelValueBins);
+  ExpectRanksOfNeighborhoodsIn3D<float>(9000);
+  ExpectRanksOfNeighborhoodsIn3D<int>(100000);
+}
+
+
+TEST(SlidingWindowRank, ComputesTheMediansIn2D)
+{
+  using ImageType = itk::Image<double, 2>;
+  const ImageType::RegionType bufferedRegion({ { 0, 0 } }, { { 17, 11 } });
+  const auto                  image = CreateImage<double>(bufferedRegion, 50);
+
+  itk::SlidingWindowRank<ImageType> slidingWindowRank;
+  slidingWindowRank.Compute(*image, bufferedRegion, { { 3, 4 } }, 0.5f);
+  ExpectRanksOfNeighborhoods(*image, bufferedRegion, { { 3, 4 } }, 0.5f, false, slidingWindowRank);
+}
+
+
+TEST(SlidingWindowRank, RejectsRegionsOutsideTheBuffer)
+{
+  using ImageType = itk::Image<unsigned char, 2>;
+  const auto image = CreateImage<unsigned char>(ImageType::RegionType({ { 0, 0 } }, { { 4, 4 } }), 10);
+
+  itk::SlidingWindowRank<ImageType> slidingWindowRank;
+  EXPECT_THROW(slidingWindowRank.Compute(*image, ImageType::RegionType({ { 2, 2 } }, { { 3, 1 } }), { { 1, 1 } }, 0.5f),
+               itk::ExceptionObject);
+
+  slidingWindowRank.Compute(*image, ImageType::RegionType({ { 2, 2 } }, { { 0, 1 } }), { { 1, 1 } }, 0.5f);
+  EXPECT_TRUE(slidingWindowRank.GetValues().empty());
+}
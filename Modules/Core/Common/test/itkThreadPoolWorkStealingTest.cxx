@@ -0,0 +1,181 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkPoolMultiThreader.h"
+#include "itkThreadPool.h"
+#include "itkTimeProbesCollectorBase.h"
+#include "itkTestingMacros.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Checks that the work-stealing mode of the thread pool executes every job exactly
+// once, including jobs submitted from worker threads, and compares the scaling of
+// ParallelizeArray and of many tiny AddWork jobs between the two scheduling modes.
+//
+// Usage: itkThreadPoolWorkStealingTest [maximumNumberOfChunks]
+// The number of chunks goes from 1000 up to maximumNumberOfChunks (default 1000000).
+
+namespace
+{
+bool
+CheckAddWork(itk::ThreadPool * pool, itk::SizeValueType numberOfJobs)
+{
+  std::atomic<itk::SizeValueType> sum{ 0 };
+  std::vector<std::future<void>>  futures;
+  futures.reserve(numberOfJobs);
+  for (itk::SizeValueType i = 0; i < numberOfJobs; ++i)
+  {
+    futures.push_back(pool->AddWork([&sum, i]() { sum += i; }));
+  }
+  for (auto & future : futures)
+  {
+    future.get();
+  }
+  const itk::SizeValueType expected = numberOfJobs * (numberOfJobs - 1) / 2;
+  if (sum != expected)
+  {
+    std::cerr << "AddWork: expected sum " << expected << ", but got " << sum << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool
+CheckNestedAddWork(itk::ThreadPool * pool)
+{
+  // Parent jobs submit their children from the worker threads, so the children
+  // go to the deque of the submitting worker and have to be stolen by others.
+  // Parents do not wait for their children, to avoid exhausting the workers.
+  constexpr unsigned int numberOfParents = 16;
+  constexpr unsigned int numberOfChildren = 64;
+
+  std::atomic<unsigned int>      count{ 0 };
+  std::atomic<bool>              allFromWorkers{ true };
+  std::mutex                     futuresMutex;
+  std::vector<std::future<void>> childFutures;
+  std::vector<std::future<void>> parentFutures;
+  for (unsigned int p = 0; p < numberOfParents; ++p)
+  {
+    parentFutures.push_back(pool->AddWork([&]() {
+      allFromWorkers = allFromWorkers && itk::ThreadPool::IsWorkerThread();
+      for (unsigned int c = 0; c < numberOfChildren; ++c)
+      {
+        auto                              future = pool->AddWork([&count]() { ++count; });
+        const std::lock_guard<std::mutex> lockGuard(futuresMutex);
+        childFutures.push_back(std::move(future));
+      }
+    }));
+  }
+  for (auto & future : parentFutures)
+  {
+    future.get();
+  }
+  for (auto & future : childFutures)
+  {
+    future.get();
+  }
+  if (count != numberOfParents * numberOfChildren)
+  {
+    std::cerr << "Nested AddWork: expected " << numberOfParents * numberOfChildren << " jobs, but " << count
+              << " were executed" << std::endl;
+    return false;
+  }
+  if (!allFromWorkers || itk::ThreadPool::IsWorkerThread())
+  {
+    std::cerr << "IsWorkerThread() returned a wrong value" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool
+CheckParallelizeArray(itk::MultiThreaderBase * threader, itk::SizeValueType numberOfChunks)
+{
+  std::vector<unsigned char> touched(numberOfChunks, 0);
+  threader->ParallelizeArray(0, numberOfChunks, [&touched](itk::SizeValueType i) { ++touched[i]; }, nullptr);
+  for (itk::SizeValueType i = 0; i < numberOfChunks; ++i)
+  {
+    if (touched[i] != 1)
+    {
+      std::cerr << "ParallelizeArray: element " << i << " was processed " << int{ touched[i] } << " times"
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkThreadPoolWorkStealingTest(int argc, char * argv[])
+{
+  itk::SizeValueType maximumNumberOfChunks = 1000000;
+  if (argc > 1)
+  {
+    maximumNumberOfChunks = std::stoul(argv[1]);
+  }
+
+  itk::ThreadPool::Pointer pool = itk::ThreadPool::GetInstance();
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(pool, ThreadPool, Object);
+
+  auto threader = itk::PoolMultiThreader::New();
+  threader->SetNumberOfWorkUnits(itk::MultiThreaderBase::GetGlobalMaximumNumberOfThreads());
+
+  bool                            success = true;
+  itk::TimeProbesCollectorBase    timeProbes;
+  std::vector<itk::SizeValueType> sink(maximumNumberOfChunks);
+
+  for (const bool workStealing : { false, true })
+  {
+    itk::ThreadPool::SetWorkStealing(workStealing);
+    ITK_TEST_EXPECT_EQUAL(itk::ThreadPool::GetWorkStealing(), workStealing);
+    const std::string mode = workStealing ? "Stealing" : "Shared";
+    std::cout << "Testing " << mode << " mode with " << pool->GetMaximumNumberOfThreads() << " threads" << std::endl;
+
+    success &= CheckAddWork(pool, 1000);
+    success &= CheckNestedAddWork(pool);
+
+    for (itk::SizeValueType numberOfChunks = 1000; numberOfChunks <= maximumNumberOfChunks; numberOfChunks *= 10)
+    {
+      success &= CheckParallelizeArray(threader, numberOfChunks);
+
+      const std::string size = std::to_string(numberOfChunks);
+      timeProbes.Start((mode + " Array " + size).c_str());
+      threader->ParallelizeArray(
+        0, numberOfChunks, [&sink](itk::SizeValueType i) { sink[i] = i; }, nullptr);
+      timeProbes.Stop((mode + " Array " + size).c_str());
+
+      timeProbes.Start((mode + " AddWork " + size).c_str());
+      success &= CheckAddWork(pool, numberOfChunks);
+      timeProbes.Stop((mode + " AddWork " + size).c_str());
+    }
+  }
+  itk::ThreadPool::SetWorkStealing(false);
+
+  timeProbes.Report(std::cout);
+
+  if (!success)
+  {
+    std::cout << "Test FAILED!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test PASSED!" << std::endl;
+  return EXIT_SUCCESS;
+}
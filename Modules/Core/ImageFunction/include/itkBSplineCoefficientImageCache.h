@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBSplineCoefficientImageCache_h
+#define itkBSplineCoefficientImageCache_h
+
+#include "itkBSplineDecompositionImageFilter.h"
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+/** \class BSplineCoefficientImageCache
+ * \brief Shares the B-spline coefficient images of input images.
+ *
+ * GetCoefficientImage() returns the coefficients of an image computed by a
+ * BSplineDecompositionImageFilter, and keeps them for the next requests of
+ * the same image and spline order, as long as the image is neither modified
+ * nor deleted. The B-spline interpolators whose UseCoefficientImageCache
+ * flag is on, as used by ResampleImageFilter or ImageToImageMetricv4, thus
+ * share one coefficient image per input image, instead of decomposing the
+ * image for each interpolator. A BSplineResampleImageFunction may interpolate
+ * the coefficient image directly.
+ *
+ * An image is identified by its address, its modification time and its
+ * buffered region. As for the pipeline, changing its pixels through its
+ * buffer requires a call to its Modified() method.
+ *
+ * The coefficient images are kept until their input image is deleted, or
+ * until ReleaseCoefficientImages() is called. Each one takes a
+ * TCoefficientImage pixel, a double by default, per input pixel, in
+ * addition to the input image, for as long as the input image lives.
+ * Long-lived images which are no longer resampled should thus be released
+ * explicitly. Only the last coefficient image of each image and spline
+ * order is kept. The cache may be used from concurrent threads.
+ *
+ * \sa BSplineInterpolateImageFunction
+ * \sa BSplineDecompositionImageFilter
+ *
+ * \ingroup ImageFunctions
+ * \ingroup ITKImageFunction
+ */
+template <typename TInputImage, typename TCoefficientImage>
+class ITK_TEMPLATE_EXPORT BSplineCoefficientImageCache
+{
+public:
+  /** Standard class type aliases. */
+  using Self = BSplineCoefficientImageCache;
+
+  using InputImageType = TInputImage;
+  using CoefficientImageType = TCoefficientImage;
+  using CoefficientImageConstPointer = typename CoefficientImageType::ConstPointer;
+  using DecompositionFilterType = BSplineDecompositionImageFilter<InputImageType, CoefficientImageType>;
+
+  BSplineCoefficientImageCache() = delete;
+
+  /** Returns the coefficients of the image for the spline order, computed
+   * when the cache does not have them yet. */
+  static CoefficientImageConstPointer
+  GetCoefficientImage(const InputImageType * image, unsigned int splineOrder);
+
+  /** Returns the number of coefficient images kept by the cache. */
+  static SizeValueType
+  GetNumberOfCoefficientImages();
+
+  /** Releases the coefficient images kept by the cache. */
+  static void
+  ReleaseCoefficientImages();
+
+private:
+  using RegionType = typename InputImageType::RegionType;
+
+  struct CoefficientImageEntry
+  {
+    unsigned int                 SplineOrder;
+    ModifiedTimeType             ModifiedTime;
+    RegionType                   BufferedRegion;
+    CoefficientImageConstPointer CoefficientImage;
+  };
+
+  /** The coefficient images of each image, which an observer of the deletion
+   * of the image removes. */
+  struct Registry
+  {
+    std::mutex                                                           Mutex;
+    std::map<const InputImageType *, std::vector<CoefficientImageEntry>> Images;
+  };
+
+  static Registry &
+  GetRegistry();
+
+  static void
+  RemoveImage(const InputImageType * image);
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkBSplineCoefficientImageCache.hxx"
+#endif
+
+#endif
@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBSplineCoefficientImageCache_hxx
+#define itkBSplineCoefficientImageCache_hxx
+
+#include "itkEventObject.h"
+#include <algorithm>
+#include <iterator>
+
+namespace itk
+{
+template <typename TInputImage, typename TCoefficientImage>
+auto
+BSplineCoefficientImageCache<TInputImage, TCoefficientImage>::GetCoefficientImage(const InputImageType * image,
+                                                                                  const unsigned int     splineOrder)
+  -> CoefficientImageConstPointer
+{
+  if (image == nullptr)
+  {
+    return nullptr;
+  }
+
+  const auto matches = [image, splineOrder](const CoefficientImageEntry & entry) {
+    return entry.SplineOrder == splineOrder && entry.ModifiedTime == image->GetMTime() &&
+           entry.BufferedRegion == image->GetBufferedRegion();
+  };
+
+  Registry & registry = GetRegistry();
+  {
+    const std::lock_guard<std::mutex> lock(registry.Mutex);
+    const auto                        found = registry.Images.find(image);
+    if (found != registry.Images.end())
+    {
+      const auto entry = std::find_if(found->second.cbegin(), found->second.cend(), matches);
+      if (entry != found->second.cend())
+      {
+        return entry->CoefficientImage;
+      }
+    }
+  }
+
+  // The decomposition requests the largest possible region of the image, and
+  // may update it, so the entry is made after.
+  const auto filter = DecompositionFilterType::New();
+  filter->SetSplineOrder(splineOrder);
+  filter->SetInput(image);
+  filter->Update();
+  const typename CoefficientImageType::Pointer coefficientImage = filter->GetOutput();
+  coefficientImage->DisconnectPipeline();
+
+  // The coefficient images replaced by the new one are released after the
+  // lock.
+  std::vector<CoefficientImageEntry> replacedEntries;
+  {
+    const std::lock_guard<std::mutex> lock(registry.Mutex);
+    const auto                        inserted = registry.Images.try_emplace(image);
+    if (inserted.second)
+    {
+      image->AddObserver(DeleteEvent(), [image](const EventObject &) { RemoveImage(image); });
+    }
+    auto &     entries = inserted.first->second;
+    const auto replaced = std::stable_partition(entries.begin(), entries.end(), [splineOrder](const auto & entry) {
+      return entry.SplineOrder != splineOrder;
+    });
+    std::move(replaced, entries.end(), std::back_inserter(replacedEntries));
+    entries.erase(replaced, entries.end());
+    entries.push_back({ splineOrder, image->GetMTime(), image->GetBufferedRegion(), coefficientImage.GetPointer() });
+  }
+  return coefficientImage.GetPointer();
+}
+
+
+template <typename TInputImage, typename TCoefficientImage>
+SizeValueType
+BSplineCoefficientImageCache<TInputImage, TCoefficientImage>::GetNumberOfCoefficientImages()
+{
+  Registry &                        registry = GetRegistry();
+  const std::lock_guard<std::mutex> lock(registry.Mutex);
+  SizeValueType                     numberOfCoefficientImages = 0;
+  for (const auto & image : registry.Images)
+  {
+    numberOfCoefficientImages += image.second.size();
+  }
+  return numberOfCoefficientImages;
+}
+
+
+template <typename TInputImage, typename TCoefficientImage>
+void
+BSplineCoefficientImageCache<TInputImage, TCoefficientImage>::ReleaseCoefficientImages()
+{
+  // The observers of the images stay, and remove their empty entries when the
+  // images are deleted.
+  std::vector<CoefficientImageEntry> releasedEntries;
+  Registry &                         registry = GetRegistry();
+  const std::lock_guard<std::mutex>  lock(registry.Mutex);
+  for (auto & image : registry.Images)
+  {
+    std::move(image.second.begin(), image.second.end(), std::back_inserter(releasedEntries));
+    image.second.clear();
+  }
+}
+
+
+template <typename TInputImage, typename TCoefficientImage>
+auto
+BSplineCoefficientImageCache<TInputImage, TCoefficientImage>::GetRegistry() -> Registry &
+{
+  // Never destroyed, as images may be deleted during the destruction of
+  // static objects, after the registry would be.
+  static auto * const registry = new Registry;
+  return *registry;
+}
+
+
+template <typename TInputImage, typename TCoefficientImage>
+void
+BSplineCoefficientImageCache<TInputImage, TCoefficientImage>::RemoveImage(const InputImageType * image)
+{
+  std::vector<CoefficientImageEntry> removedEntries;
+  Registry &                         registry = GetRegistry();
+  const std::lock_guard<std::mutex>  lock(registry.Mutex);
+  const auto                         found = registry.Images.find(image);
+  if (found != registry.Images.end())
+  {
+    removedEntries.swap(found->second);
+    registry.Images.erase(found);
+  }
+}
+} // end namespace itk
+
+#endif
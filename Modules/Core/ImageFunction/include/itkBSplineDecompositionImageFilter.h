@@ -63,10 +63,13 @@ namespace itk
  *               Requires the same order of Spline for each dimension.
  *               Can only process LargestPossibleRegion
  *
+ * The image is filtered along one direction at a time. The lines along a
+ * direction are independent, and are distributed over the work units.
+ *
  * \sa BSplineResampleImageFunction
  *
  * \ingroup ImageFilters
- * \ingroup SingleThreaded
+ * \ingroup MultiThreaded
  * \ingroup CannotBeStreamed
  * \ingroup ITKImageFunction
  */
@@ -153,8 +156,8 @@ private:
   SetPoles();
 
   /** Converts a vector of data to a vector of Spline coefficients. */
-  virtual bool
-  DataToCoefficients1D();
+  bool
+  DataToCoefficients1D(CoefficientsVectorType & scratch) const;
 
   /** Converts an N-dimension image of data to an equivalent sized image
    *    of spline coefficients. */
@@ -162,13 +165,13 @@ private:
   DataToCoefficientsND();
 
   /** Determines the first coefficient for the causal filtering of the data. */
-  virtual void
-  SetInitialCausalCoefficient(double z);
+  void
+  SetInitialCausalCoefficient(double z, CoefficientsVectorType & scratch) const;
 
   /** Determines the first coefficient for the anti-causal filtering of the
     data. */
-  virtual void
-  SetInitialAntiCausalCoefficient(double z);
+  void
+  SetInitialAntiCausalCoefficient(double z, CoefficientsVectorType & scratch) const;
 
   /** Copy the input image into the output image.
    *  Used to initialize the Coefficients image before calculation. */
@@ -177,19 +180,16 @@ private:
 
   /** Copies a vector of data from the Coefficients image (one line of the
    *  output image) to the scratch. */
-  void
-  CopyCoefficientsToScratch(OutputLinearIterator &);
+  static void
+  CopyCoefficientsToScratch(OutputLinearIterator &, CoefficientsVectorType & scratch);
 
   /** Copies a vector of data from the scratch to the Coefficients image
    *  (one line of the output image). */
-  void
-  CopyScratchToCoefficients(OutputLinearIterator &);
+  static void
+  CopyScratchToCoefficients(OutputLinearIterator &, const CoefficientsVectorType & scratch);
 
   // Variables needed by the smoothing spline routine.
 
-  /** Temporary storage for processing of Coefficients. */
-  CoefficientsVectorType m_Scratch{};
-
   /** Image size. */
   typename TInputImage::SizeType m_DataLength{};
 
@@ -202,9 +202,6 @@ private:
 
   /** Tolerance used for determining initial causal coefficient. Default is 1e-10.*/
   double m_Tolerance{ 1e-10 };
-
-  /** Direction for iterator incrementing. Default is 0. */
-  unsigned int m_IteratorDirection{ 0 };
 };
 } // namespace itk
 
@@ -28,7 +28,7 @@
 #ifndef itkBSplineDecompositionImageFilter_hxx
 #define itkBSplineDecompositionImageFilter_hxx
 #include "itkImageAlgorithm.h"
-#include "itkProgressReporter.h"
+#include "itkTotalProgressReporter.h"
 #include "itkVector.h"
 #include "itkPrintHelper.h"
 
@@ -41,11 +41,6 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::BSplineDecomposition
 {
   this->SetSplineOrder(3);
 
-  for (unsigned int i = 0; i < m_Scratch.size(); ++i)
-  {
-    m_Scratch[i] = 0;
-  }
-
   m_DataLength.Fill(typename TInputImage::SizeType::SizeValueType{});
 }
 
@@ -57,25 +52,24 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostre
 
   Superclass::PrintSelf(os, indent);
 
-  os << indent << "Scratch: " << m_Scratch << std::endl;
   os << indent << "Data Length: " << m_DataLength << std::endl;
   os << indent << "Spline Order: " << m_SplineOrder << std::endl;
   os << indent << "SplinePoles: " << m_SplinePoles << std::endl;
   os << indent << "Number Of Poles: " << m_NumberOfPoles << std::endl;
   os << indent << "Tolerance: " << m_Tolerance << std::endl;
-  os << indent << "Iterator Direction: " << m_IteratorDirection << std::endl;
 }
 
 template <typename TInputImage, typename TOutputImage>
 bool
-BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficients1D()
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficients1D(CoefficientsVectorType & scratch) const
 {
   // See Unser, 1993, Part II, Equation 2.5,
   // or Unser, 1999, Box 2. for an explanation.
 
   double c0 = 1.0;
 
-  if (m_DataLength[m_IteratorDirection] == 1) // Required by mirror boundaries
+  const auto dataLength = static_cast<unsigned int>(scratch.size());
+  if (dataLength == 1) // Required by mirror boundaries
   {
     return false;
   }
@@ -88,28 +82,28 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficients1D
   }
 
   // Apply the gain
-  for (unsigned int n = 0; n < m_DataLength[m_IteratorDirection]; ++n)
+  for (unsigned int n = 0; n < dataLength; ++n)
   {
-    m_Scratch[n] *= c0;
+    scratch[n] *= c0;
   }
 
   // Loop over all poles
   for (unsigned int k = 0; k < m_NumberOfPoles; ++k)
   {
     // Causal initialization
-    this->SetInitialCausalCoefficient(m_SplinePoles[k]);
+    this->SetInitialCausalCoefficient(m_SplinePoles[k], scratch);
     // Causal recursion
-    for (unsigned int n = 1; n < m_DataLength[m_IteratorDirection]; ++n)
+    for (unsigned int n = 1; n < dataLength; ++n)
     {
-      m_Scratch[n] += m_SplinePoles[k] * m_Scratch[n - 1];
+      scratch[n] += m_SplinePoles[k] * scratch[n - 1];
     }
 
     // anticausal initialization
-    this->SetInitialAntiCausalCoefficient(m_SplinePoles[k]);
+    this->SetInitialAntiCausalCoefficient(m_SplinePoles[k], scratch);
     // anticausal recursion
-    for (int n = m_DataLength[m_IteratorDirection] - 2; 0 <= n; n--)
+    for (int n = dataLength - 2; 0 <= n; n--)
     {
-      m_Scratch[n] = m_SplinePoles[k] * (m_Scratch[n + 1] - m_Scratch[n]);
+      scratch[n] = m_SplinePoles[k] * (scratch[n + 1] - scratch[n]);
     }
   }
   return true;
@@ -175,58 +169,62 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetPoles()
 
 template <typename TInputImage, typename TOutputImage>
 void
-BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialCausalCoefficient(double z)
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialCausalCoefficient(
+  double                   z,
+  CoefficientsVectorType & scratch) const
 {
   // See Unser, 1999, Box 2 for explanation
   CoeffType                           sum;
   double                              zn, z2n, iz;
   typename TInputImage::SizeValueType horizon;
+  const auto                          dataLength = static_cast<typename TInputImage::SizeValueType>(scratch.size());
 
   // Yhis initialization corresponds to mirror boundaries
-  horizon = m_DataLength[m_IteratorDirection];
+  horizon = dataLength;
   zn = z;
   if (m_Tolerance > 0.0)
   {
     horizon = (typename TInputImage::SizeValueType)std::ceil(std::log(m_Tolerance) / std::log(itk::Math::abs(z)));
   }
-  if (horizon < m_DataLength[m_IteratorDirection])
+  if (horizon < dataLength)
   {
     // Accelerated loop
-    sum = m_Scratch[0]; // verify this
+    sum = scratch[0]; // verify this
     for (unsigned int n = 1; n < horizon; ++n)
     {
-      sum += zn * m_Scratch[n];
+      sum += zn * scratch[n];
       zn *= z;
     }
-    m_Scratch[0] = sum;
+    scratch[0] = sum;
   }
   else
   {
     // Full loop
     iz = 1.0 / z;
-    z2n = std::pow(z, static_cast<double>(m_DataLength[m_IteratorDirection] - 1L));
-    sum = m_Scratch[0] + z2n * m_Scratch[m_DataLength[m_IteratorDirection] - 1L];
+    z2n = std::pow(z, static_cast<double>(dataLength - 1L));
+    sum = scratch[0] + z2n * scratch[dataLength - 1L];
     z2n *= z2n * iz;
-    for (unsigned int n = 1; n <= (m_DataLength[m_IteratorDirection] - 2); ++n)
+    for (unsigned int n = 1; n <= (dataLength - 2); ++n)
     {
-      sum += (zn + z2n) * m_Scratch[n];
+      sum += (zn + z2n) * scratch[n];
       zn *= z;
       z2n *= iz;
     }
-    m_Scratch[0] = sum / (1.0 - zn * zn);
+    scratch[0] = sum / (1.0 - zn * zn);
   }
 }
 
 template <typename TInputImage, typename TOutputImage>
 void
-BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialAntiCausalCoefficient(double z)
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialAntiCausalCoefficient(
+  double                   z,
+  CoefficientsVectorType & scratch) const
 {
   // This initialization corresponds to mirror boundaries.
   // See Unser, 1999, Box 2 for explanation.
   // Also see erratum at http://bigwww.epfl.ch/publications/unser9902.html
-  m_Scratch[m_DataLength[m_IteratorDirection] - 1] =
-    (z / (z * z - 1.0)) *
-    (z * m_Scratch[m_DataLength[m_IteratorDirection] - 2] + m_Scratch[m_DataLength[m_IteratorDirection] - 1]);
+  const auto dataLength = scratch.size();
+  scratch[dataLength - 1] = (z / (z * z - 1.0)) * (z * scratch[dataLength - 2] + scratch[dataLength - 1]);
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -235,39 +233,51 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficientsND
 {
   OutputImagePointer output = this->GetOutput();
 
-  Size<ImageDimension> size = output->GetBufferedRegion().GetSize();
+  using OutputRegionType = typename TOutputImage::RegionType;
+  const OutputRegionType region = output->GetBufferedRegion();
 
-  unsigned int count = output->GetBufferedRegion().GetNumberOfPixels() / size[0] * ImageDimension;
-
-  ProgressReporter progress(this, 0, count, 10);
+  SizeValueType numberOfLines = 0;
+  for (unsigned int n = 0; n < ImageDimension; ++n)
+  {
+    numberOfLines += region.GetNumberOfPixels() / region.GetSize(n);
+  }
 
   // Initialize coefficient array
   this->CopyImageToImage(); // Coefficients are initialized to the input data
 
-  // Loop through each dimension
+  // Loop through each dimension. The lines along the dimension are
+  // independent, so each work unit processes whole lines with its own scratch.
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
   for (unsigned int n = 0; n < ImageDimension; ++n)
   {
-    m_IteratorDirection = n;
-
-    // Initialize iterators
-    OutputLinearIterator CIterator(output, output->GetBufferedRegion());
-    CIterator.SetDirection(m_IteratorDirection);
-    // For each data vector
-    while (!CIterator.IsAtEnd())
-    {
-      // Copy coefficients to scratch
-      this->CopyCoefficientsToScratch(CIterator);
-
-      // Perform 1D BSpline calculations
-      this->DataToCoefficients1D();
-
-      // Copy scratch back to coefficients.
-      // Brings us back to the end of the line we were working on.
-      CIterator.GoToBeginOfLine();
-      this->CopyScratchToCoefficients(CIterator); // m_Scratch = m_Image;
-      CIterator.NextLine();
-      progress.CompletedPixel();
-    }
+    this->GetMultiThreader()->template ParallelizeImageRegionRestrictDirection<ImageDimension>(
+      n,
+      region,
+      [this, n, &output, numberOfLines](const OutputRegionType & lineRegion) {
+        TotalProgressReporter  progress(this, numberOfLines);
+        CoefficientsVectorType scratch(lineRegion.GetSize(n));
+
+        // Initialize iterators
+        OutputLinearIterator CIterator(output, lineRegion);
+        CIterator.SetDirection(n);
+        // For each data vector
+        while (!CIterator.IsAtEnd())
+        {
+          // Copy coefficients to scratch
+          CopyCoefficientsToScratch(CIterator, scratch);
+
+          // Perform 1D BSpline calculations
+          this->DataToCoefficients1D(scratch);
+
+          // Copy scratch back to coefficients.
+          // Brings us back to the end of the line we were working on.
+          CIterator.GoToBeginOfLine();
+          CopyScratchToCoefficients(CIterator, scratch);
+          CIterator.NextLine();
+          progress.CompletedPixel();
+        }
+      },
+      nullptr);
   }
 }
 
@@ -282,13 +292,15 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyImageToImage()
 
 template <typename TInputImage, typename TOutputImage>
 void
-BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyScratchToCoefficients(OutputLinearIterator & Iter)
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyScratchToCoefficients(
+  OutputLinearIterator &         Iter,
+  const CoefficientsVectorType & scratch)
 {
   using OutputPixelType = typename TOutputImage::PixelType;
   typename TOutputImage::SizeValueType j = 0;
   while (!Iter.IsAtEndOfLine())
   {
-    Iter.Set(static_cast<OutputPixelType>(m_Scratch[j]));
+    Iter.Set(static_cast<OutputPixelType>(scratch[j]));
     ++Iter;
     ++j;
   }
@@ -298,13 +310,14 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyScratchToCoeffic
  */
 template <typename TInputImage, typename TOutputImage>
 void
-BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyCoefficientsToScratch(OutputLinearIterator & Iter)
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyCoefficientsToScratch(OutputLinearIterator &   Iter,
+                                                                                      CoefficientsVectorType & scratch)
 {
   typename TOutputImage::SizeValueType j = 0;
 
   while (!Iter.IsAtEndOfLine())
   {
-    m_Scratch[j] = static_cast<CoeffType>(Iter.Get());
+    scratch[j] = static_cast<CoeffType>(Iter.Get());
     ++Iter;
     ++j;
   }
@@ -341,21 +354,10 @@ template <typename TInputImage, typename TOutputImage>
 void
 BSplineDecompositionImageFilter<TInputImage, TOutputImage>::GenerateData()
 {
-  // Allocate scratch memory
   InputImageConstPointer inputPtr = this->GetInput();
 
   m_DataLength = inputPtr->GetBufferedRegion().GetSize();
 
-  typename TOutputImage::SizeValueType maxLength = 0;
-  for (unsigned int n = 0; n < ImageDimension; ++n)
-  {
-    if (m_DataLength[n] > maxLength)
-    {
-      maxLength = m_DataLength[n];
-    }
-  }
-  m_Scratch.resize(maxLength);
-
   // Allocate memory for output image
   OutputImagePointer outputPtr = this->GetOutput();
   outputPtr->SetBufferedRegion(outputPtr->GetRequestedRegion());
@@ -363,9 +365,6 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::GenerateData()
 
   // Calculate actual output
   this->DataToCoefficientsND();
-
-  // Clean up
-  m_Scratch.clear();
 }
 } // namespace itk
 
@@ -31,6 +31,7 @@
 #include "itkInterpolateImageFunction.h"
 #include "vnl/vnl_matrix.h"
 
+#include "itkBSplineCoefficientImageCache.h"
 #include "itkBSplineDecompositionImageFilter.h"
 #include "itkConceptChecking.h"
 #include "itkCovariantVector.h"
@@ -64,7 +65,9 @@ namespace itk
  * And code obtained from bigwww.epfl.ch by Philippe Thevenaz
  *
  * The B spline coefficients are calculated through the
- * BSplineDecompositionImageFilter
+ * BSplineDecompositionImageFilter. With UseCoefficientImageCache on, they
+ * are shared through a BSplineCoefficientImageCache with the other
+ * interpolators of the same image.
  *
  * Limitations:  Spline order must be between 0 and 5.
  *               Spline order must be set before setting the image.
@@ -118,6 +121,9 @@ public:
   /** PointType type alias support */
   using typename Superclass::PointType;
 
+  /** Grid coordinates type alias support */
+  using typename Superclass::GridCoordinatesType;
+
   /** Iterator type alias support */
   using Iterator = ImageLinearIteratorWithIndex<TImageType>;
 
@@ -129,6 +135,9 @@ public:
   using CoefficientFilter = BSplineDecompositionImageFilter<TImageType, CoefficientImageType>;
   using CoefficientFilterPointer = typename CoefficientFilter::Pointer;
 
+  /** Cache of the coefficients shared between interpolators */
+  using CoefficientImageCacheType = BSplineCoefficientImageCache<TImageType, CoefficientImageType>;
+
   /** Derivative type alias support */
   using CovariantVectorType = CovariantVector<OutputType, Self::ImageDimension>;
 
@@ -170,6 +179,35 @@ public:
     return this->EvaluateAtContinuousIndexInternal(index, evaluateIndex, weights);
   }
 
+  /** Evaluate the function at a batch of ContinuousIndex positions, with a
+   * single allocation of evaluateIndex and weights for the whole batch. */
+  void
+  EvaluateAtContinuousIndices(const ContinuousIndexType * indices,
+                              OutputType *                values,
+                              SizeValueType               numberOfIndices) const override;
+
+  /** Evaluate the function, and its derivatives when derivatives is not null,
+   * at a batch of ContinuousIndex positions. The weights of each position are
+   * shared by its value and its derivative, and allocated once for the whole
+   * batch. */
+  void
+  EvaluateValuesAndDerivativesAtContinuousIndices(const ContinuousIndexType * indices,
+                                                  OutputType *                values,
+                                                  CovariantVectorType *       derivatives,
+                                                  SizeValueType               numberOfIndices) const;
+
+  /** Evaluate the function at the points of a grid, along one axis at a time.
+   * The B-spline weights along each axis are computed once per coordinate of
+   * the grid. */
+  void
+  EvaluateAtContinuousIndexGrid(const GridCoordinatesType & gridCoordinates, OutputType * values) const override;
+
+  bool
+  IsInsideBufferSeparable() const override
+  {
+    return true;
+  }
+
   virtual OutputType
   EvaluateAtContinuousIndex(const ContinuousIndexType & x, ThreadIdType threadId) const
   {
@@ -304,6 +342,25 @@ public:
   itkGetConstMacro(UseImageDirection, bool);
   itkBooleanMacro(UseImageDirection);
 
+  /** The UseCoefficientImageCache flag determines whether SetInputImage()
+   * takes the coefficients from the BSplineCoefficientImageCache, which
+   * computes them only once for all the interpolators of an image and spline
+   * order with this flag on, for instance the clones of an interpolator used
+   * by several metrics or resample filters. The cache keeps the coefficients,
+   * a TCoefficientType per pixel, as long as the image lives and is not
+   * modified, or until BSplineCoefficientImageCache::ReleaseCoefficientImages()
+   * is called. ResampleImageFilter turns the flag on when its
+   * UseCoefficientImageCache flag is on.
+   * The default value of this flag is Off.
+   */
+  itkSetMacro(UseCoefficientImageCache, bool);
+  itkGetConstMacro(UseCoefficientImageCache, bool);
+  itkBooleanMacro(UseCoefficientImageCache);
+
+  /** Get the coefficients of the input image, computed by SetInputImage(), or
+   * taken from the BSplineCoefficientImageCache. */
+  itkGetConstObjectMacro(Coefficients, CoefficientImageType);
+
   SizeType
   GetRadius() const override
   {
@@ -413,6 +470,9 @@ private:
   // derivatives.
   bool m_UseImageDirection{ true };
 
+  // flag to share the coefficients through the coefficient image cache.
+  bool m_UseCoefficientImageCache{ false };
+
   ThreadIdType                          m_NumberOfWorkUnits{};
   std::unique_ptr<vnl_matrix<long>[]>   m_ThreadedEvaluateIndex;
   std::unique_ptr<vnl_matrix<double>[]> m_ThreadedWeights;
@@ -36,6 +36,7 @@
 
 #include "itkMatrix.h"
 #include "itkPrintHelper.h"
+#include "itkSeparableInterpolationGrid.h"
 
 namespace itk
 {
@@ -76,6 +77,7 @@ BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::PrintS
   itkPrintSelfObjectMacro(CoefficientFilter);
 
   os << indent << "UseImageDirection: " << (m_UseImageDirection ? "On" : "Off") << std::endl;
+  os << indent << "UseCoefficientImageCache: " << (m_UseCoefficientImageCache ? "On" : "Off") << std::endl;
 
   os << indent
      << "NumberOfWorkUnits: " << static_cast<typename NumericTraits<ThreadIdType>::PrintType>(m_NumberOfWorkUnits)
@@ -118,10 +120,17 @@ BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::SetInp
 {
   if (inputData)
   {
-    m_CoefficientFilter->SetInput(inputData);
+    if (m_UseCoefficientImageCache)
+    {
+      m_Coefficients = CoefficientImageCacheType::GetCoefficientImage(inputData, m_SplineOrder);
+    }
+    else
+    {
+      m_CoefficientFilter->SetInput(inputData);
 
-    m_CoefficientFilter->Update();
-    m_Coefficients = m_CoefficientFilter->GetOutput();
+      m_CoefficientFilter->Update();
+      m_Coefficients = m_CoefficientFilter->GetOutput();
+    }
 
     // Call the Superclass implementation after, in case the filter
     // pulls in  more of the input image
@@ -529,6 +538,88 @@ BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::Evalua
   return (interpolated);
 }
 
+template <typename TImageType, typename TCoordRep, typename TCoefficientType>
+void
+BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::EvaluateAtContinuousIndices(
+  const ContinuousIndexType * indices,
+  OutputType *                values,
+  const SizeValueType         numberOfIndices) const
+{
+  vnl_matrix<long>   evaluateIndex(ImageDimension, (m_SplineOrder + 1));
+  vnl_matrix<double> weights(ImageDimension, (m_SplineOrder + 1));
+
+  for (SizeValueType i = 0; i < numberOfIndices; ++i)
+  {
+    values[i] = this->EvaluateAtContinuousIndexInternal(indices[i], evaluateIndex, weights);
+  }
+}
+
+template <typename TImageType, typename TCoordRep, typename TCoefficientType>
+void
+BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::
+  EvaluateValuesAndDerivativesAtContinuousIndices(const ContinuousIndexType * indices,
+                                                  OutputType *                values,
+                                                  CovariantVectorType *       derivatives,
+                                                  const SizeValueType         numberOfIndices) const
+{
+  if (derivatives == nullptr)
+  {
+    this->EvaluateAtContinuousIndices(indices, values, numberOfIndices);
+    return;
+  }
+
+  vnl_matrix<long>   evaluateIndex(ImageDimension, (m_SplineOrder + 1));
+  vnl_matrix<double> weights(ImageDimension, (m_SplineOrder + 1));
+  vnl_matrix<double> weightsDerivative(ImageDimension, (m_SplineOrder + 1));
+
+  for (SizeValueType i = 0; i < numberOfIndices; ++i)
+  {
+    this->EvaluateValueAndDerivativeAtContinuousIndexInternal(
+      indices[i], values[i], derivatives[i], evaluateIndex, weights, weightsDerivative);
+  }
+}
+
+template <typename TImageType, typename TCoordRep, typename TCoefficientType>
+void
+BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::EvaluateAtContinuousIndexGrid(
+  const GridCoordinatesType & gridCoordinates,
+  OutputType *                values) const
+{
+  // The mirror boundary conditions of an axis of a single pixel give index 0,
+  // which is only inside the buffer when it starts at 0.
+  for (unsigned int n = 0; n < ImageDimension; ++n)
+  {
+    if (m_DataLength[n] == 1)
+    {
+      Superclass::EvaluateAtContinuousIndexGrid(gridCoordinates, values);
+      return;
+    }
+  }
+
+  vnl_matrix<long>   evaluateIndex(ImageDimension, (m_SplineOrder + 1));
+  vnl_matrix<double> weights(ImageDimension, (m_SplineOrder + 1));
+
+  // The weights and the indices along each axis only depend on the coordinate
+  // along that axis.
+  SeparableInterpolationGrid<ImageDimension> grid;
+  for (unsigned int n = 0; n < ImageDimension; ++n)
+  {
+    grid.SetAxis(n, gridCoordinates[n].size(), m_SplineOrder + 1);
+    for (SizeValueType i = 0; i < gridCoordinates[n].size(); ++i)
+    {
+      ContinuousIndexType x;
+      x.Fill(gridCoordinates[n][i]);
+      this->DetermineRegionOfSupport(evaluateIndex, x, m_SplineOrder);
+      this->SetInterpolationWeights(x, evaluateIndex, weights, m_SplineOrder);
+      this->ApplyMirrorBoundaryConditions(evaluateIndex, m_SplineOrder);
+
+      std::copy_n(evaluateIndex[n], m_SplineOrder + 1, grid.GetIndices(n, i));
+      std::copy_n(weights[n], m_SplineOrder + 1, grid.GetWeights(n, i));
+    }
+  }
+  grid.Interpolate(*m_Coefficients, values);
+}
+
 template <typename TImageType, typename TCoordRep, typename TCoefficientType>
 void
 BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::
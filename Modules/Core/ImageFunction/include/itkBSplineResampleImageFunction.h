@@ -46,8 +46,13 @@ namespace itk
  * conjunction with ResampleImageFunction allows the reconstruction
  * of the original image at different resolution and size.
  *
+ * The coefficient image may also be taken from a BSplineCoefficientImageCache,
+ * to share it with the BSplineInterpolateImageFunction objects of the
+ * original image.
+ *
  * \sa BSplineInterpolateImageFunction
  * \sa BSplineDecompositionImageFilter
+ * \sa BSplineCoefficientImageCache
  * \sa ResampleImageFilter
  *
  * \ingroup ImageFunctions
@@ -19,6 +19,8 @@
 #define itkInterpolateImageFunction_h
 
 #include "itkImageFunction.h"
+#include <array>
+#include <vector>
 
 namespace itk
 {
@@ -84,6 +86,9 @@ public:
   /** RealType type alias support */
   using RealType = typename NumericTraits<typename TInputImage::PixelType>::RealType;
 
+  /** The coordinates of the points of a grid along each axis. */
+  using GridCoordinatesType = std::array<std::vector<TCoordRep>, ImageDimension>;
+
   /** Interpolate the image at a point position
    *
    * Returns the interpolated image intensity at a
@@ -113,6 +118,89 @@ public:
   OutputType
   EvaluateAtContinuousIndex(const ContinuousIndexType & index) const override = 0;
 
+  /** Interpolate the image at a batch of continuous index positions
+   *
+   * Sets values[i] to the interpolated image intensity at indices[i], for
+   * each of the numberOfIndices indices, as EvaluateAtContinuousIndex() does.
+   * No bounds checking is done.
+   *
+   * This implementation calls EvaluateAtContinuousIndex() for each index.
+   * Subclasses override it to interpolate the whole batch in a single virtual
+   * call, sharing their working space between the indices. */
+  virtual void
+  EvaluateAtContinuousIndices(const ContinuousIndexType * indices,
+                              OutputType *                values,
+                              SizeValueType               numberOfIndices) const
+  {
+    for (SizeValueType i = 0; i < numberOfIndices; ++i)
+    {
+      values[i] = this->EvaluateAtContinuousIndex(indices[i]);
+    }
+  }
+
+  /** Interpolate the image at the points of a grid of continuous index positions
+   *
+   * The points of the grid are the combinations of its coordinates along each
+   * axis. Sets values to the interpolated image intensities at these points,
+   * with the coordinates along the first axis varying fastest, as
+   * EvaluateAtContinuousIndex() does. No bounds checking is done.
+   *
+   * This implementation calls EvaluateAtContinuousIndices() for each line of
+   * the grid. Subclasses whose kernel is a product of one-dimensional kernels
+   * override it to interpolate along one axis at a time, with a
+   * SeparableInterpolationGrid. */
+  virtual void
+  EvaluateAtContinuousIndexGrid(const GridCoordinatesType & gridCoordinates, OutputType * values) const
+  {
+    SizeValueType numberOfLines = 1;
+    for (unsigned int dim = 1; dim < ImageDimension; ++dim)
+    {
+      numberOfLines *= gridCoordinates[dim].size();
+    }
+    const SizeValueType                       lineLength = gridCoordinates[0].size();
+    std::vector<ContinuousIndexType>          lineIndices(lineLength);
+    std::array<SizeValueType, ImageDimension> position{};
+    for (SizeValueType line = 0; line < numberOfLines; ++line)
+    {
+      for (SizeValueType i = 0; i < lineLength; ++i)
+      {
+        lineIndices[i][0] = gridCoordinates[0][i];
+        for (unsigned int dim = 1; dim < ImageDimension; ++dim)
+        {
+          lineIndices[i][dim] = gridCoordinates[dim][position[dim]];
+        }
+      }
+      this->EvaluateAtContinuousIndices(lineIndices.data(), values + line * lineLength, lineLength);
+
+      for (unsigned int dim = 1; dim < ImageDimension; ++dim)
+      {
+        if (++position[dim] < gridCoordinates[dim].size())
+        {
+          break;
+        }
+        position[dim] = 0;
+      }
+    }
+  }
+
+  /** Whether IsInsideBuffer() tests each coordinate of a continuous index
+   * against GetStartContinuousIndex() and GetEndContinuousIndex(), as the
+   * implementation of ImageFunction does, so that the points of a grid which
+   * are inside the buffer are the combinations of its coordinates which are
+   * inside along each axis. ResampleImageFilter only interpolates at the
+   * points of a grid, with EvaluateAtContinuousIndexGrid(), when it is true.
+   *
+   * This implementation returns false, as subclasses may override
+   * IsInsideBuffer(), as RayCastInterpolateImageFunction does. The
+   * interpolators which keep the IsInsideBuffer() of ImageFunction override
+   * it to return true. */
+  virtual bool
+  IsInsideBufferSeparable() const
+  {
+    return false;
+  }
+
+
   /** Interpolate the image at an index position.
    *
    * Simply returns the image value at the
@@ -19,6 +19,7 @@
 #define itkLinearInterpolateImageFunction_h
 
 #include "itkInterpolateImageFunction.h"
+#include "itkSIMDPixelTransform.h"
 #include "itkVariableLengthVector.h"
 #include <algorithm> // For max.
 
@@ -36,7 +37,9 @@ namespace itk
  * This function works for N-dimensional images.
  *
  * This function works for images with scalar and vector pixel
- * types, and for images of type VectorImage.
+ * types, and for images of type VectorImage. For a VectorImage,
+ * EvaluateComponentsAtContinuousIndex() interpolates all the components of
+ * the pixels into a buffer of the caller, without any allocation.
  *
  * \sa VectorLinearInterpolateImageFunction
  *
@@ -77,6 +80,12 @@ public:
   /** RealType type alias support */
   using typename Superclass::RealType;
 
+  /** The type of the components of RealType */
+  using ScalarRealType = typename NumericTraits<RealType>::ScalarRealType;
+
+  /** Grid coordinates type alias support */
+  using typename Superclass::GridCoordinatesType;
+
   /** Dimension underlying input image. */
   static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
 
@@ -101,7 +110,50 @@ public:
   OutputType
   EvaluateAtContinuousIndex(const ContinuousIndexType & index) const override
   {
-    return this->EvaluateOptimized(Dispatch<ImageDimension>(), index);
+    if constexpr (HasVectorPixelArrayBuffer<TInputImage>)
+    {
+      OutputType value(this->GetInputImage()->GetNumberOfComponentsPerPixel());
+      this->EvaluateComponentsAtContinuousIndex(index, &value[0]);
+      return value;
+    }
+    else
+    {
+      return this->EvaluateOptimized(Dispatch<ImageDimension>(), index);
+    }
+  }
+
+  /** Evaluate the function at a ContinuousIndex position, for an image of
+   * type VectorImage, into the GetNumberOfComponentsPerPixel() components
+   * pointed to by components.
+   *
+   * The weights of the 2^ImageDimension neighbors are computed once, and
+   * the contiguous components of each neighbor are accumulated in a loop
+   * which the compiler vectorizes. Neighbors of zero weight are skipped, so
+   * that a point on a pixel has the value of the pixel. No bounds checking is
+   * done. */
+  void
+  EvaluateComponentsAtContinuousIndex(const ContinuousIndexType & index, ScalarRealType * components) const;
+
+  /** Evaluate the function at a batch of ContinuousIndex positions, in a
+   * single virtual call. For images of scalar pixels of up to three
+   * dimensions, the neighbors are read at offsets in the buffer, without the
+   * branches of EvaluateAtContinuousIndex(), and give the same values. For a
+   * VectorImage, the values keep their allocation from one call to the next
+   * when the number of components does not change. */
+  void
+  EvaluateAtContinuousIndices(const ContinuousIndexType * indices,
+                              OutputType *                values,
+                              SizeValueType               numberOfIndices) const override;
+
+  /** Evaluate the function at the points of a grid, along one axis at a time,
+   * for images of scalar pixels. */
+  void
+  EvaluateAtContinuousIndexGrid(const GridCoordinatesType & gridCoordinates, OutputType * values) const override;
+
+  bool
+  IsInsideBufferSeparable() const override
+  {
+    return true;
   }
 
   SizeType
@@ -117,6 +169,30 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** Sets the offset in the buffer of the lower neighbor of the index, the
+   * offset steps to the upper neighbors along each axis, and the distances
+   * from the lower neighbor. At the end of the image grid, the steps and the
+   * distances are zero. */
+  void
+  ComputeNeighborOffsetsAndDistances(const ContinuousIndexType & index,
+                                     const OffsetValueType *     offsetTable,
+                                     const IndexType &           bufferedIndex,
+                                     OffsetValueType &           lowerOffset,
+                                     OffsetValueType *           upperSteps,
+                                     InternalComputationType *   distances) const
+  {
+    lowerOffset = 0;
+    for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+    {
+      const IndexValueType lower = std::max(Math::Floor<IndexValueType>(index[dim]), this->m_StartIndex[dim]);
+      const bool           hasUpper = (lower < this->m_EndIndex[dim]);
+      const auto           distance = index[dim] - static_cast<InternalComputationType>(lower);
+      distances[dim] = hasUpper ? std::max(distance, InternalComputationType{ 0 }) : InternalComputationType{ 0 };
+      lowerOffset += (lower - bufferedIndex[dim]) * offsetTable[dim];
+      upperSteps[dim] = hasUpper ? offsetTable[dim] : 0;
+    }
+  }
+
   struct DispatchBase
   {};
   template <unsigned int>
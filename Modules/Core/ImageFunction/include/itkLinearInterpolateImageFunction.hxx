@@ -21,6 +21,7 @@
 #include "itkConceptChecking.h"
 
 #include "itkMath.h"
+#include "itkSeparableInterpolationGrid.h"
 #include <algorithm> // For min and max.
 
 namespace itk
@@ -97,6 +98,167 @@ LinearInterpolateImageFunction<TInputImage, TCoordRep>::EvaluateUnoptimized(cons
   return (static_cast<OutputType>(value));
 }
 
+template <typename TInputImage, typename TCoordRep>
+void
+LinearInterpolateImageFunction<TInputImage, TCoordRep>::EvaluateAtContinuousIndices(
+  const ContinuousIndexType * indices,
+  OutputType *                values,
+  const SizeValueType         numberOfIndices) const
+{
+  if constexpr (HasPixelArrayBuffer<TInputImage> && std::is_arithmetic_v<InputPixelType> && ImageDimension <= 3)
+  {
+    const TInputImage * const     inputImagePtr = this->GetInputImage();
+    const InputPixelType * const  buffer = inputImagePtr->GetBufferPointer();
+    const OffsetValueType * const offsetTable = inputImagePtr->GetOffsetTable();
+    const IndexType               bufferedIndex = inputImagePtr->GetBufferedRegion().GetIndex();
+
+    constexpr unsigned int numberOfNeighbors = 1 << ImageDimension;
+    for (SizeValueType i = 0; i < numberOfIndices; ++i)
+    {
+      OffsetValueType         lowerOffset;
+      OffsetValueType         upperSteps[ImageDimension];
+      InternalComputationType distances[ImageDimension];
+      this->ComputeNeighborOffsetsAndDistances(
+        indices[i], offsetTable, bufferedIndex, lowerOffset, upperSteps, distances);
+
+      RealType neighbors[numberOfNeighbors];
+      for (unsigned int counter = 0; counter < numberOfNeighbors; ++counter)
+      {
+        OffsetValueType offset = lowerOffset;
+        for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+        {
+          offset += ((counter >> dim) & 1) * upperSteps[dim];
+        }
+        neighbors[counter] = static_cast<RealType>(buffer[offset]);
+      }
+
+      // Interpolate across each axis in turn, as EvaluateOptimized() does. At
+      // a zero distance, the lower neighbor is taken as is, even when the
+      // neighbors are infinite.
+      unsigned int numberOfValues = numberOfNeighbors;
+      for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+      {
+        numberOfValues /= 2;
+        for (unsigned int n = 0; n < numberOfValues; ++n)
+        {
+          neighbors[n] = (distances[dim] > 0)
+                           ? neighbors[2 * n] + (neighbors[2 * n + 1] - neighbors[2 * n]) * distances[dim]
+                           : neighbors[2 * n];
+        }
+      }
+      values[i] = static_cast<OutputType>(neighbors[0]);
+    }
+  }
+  else if constexpr (HasVectorPixelArrayBuffer<TInputImage>)
+  {
+    const unsigned int numberOfComponents = this->GetInputImage()->GetNumberOfComponentsPerPixel();
+    for (SizeValueType i = 0; i < numberOfIndices; ++i)
+    {
+      values[i].SetSize(
+        numberOfComponents, typename OutputType::DontShrinkToFit(), typename OutputType::DumpOldValues());
+      this->EvaluateComponentsAtContinuousIndex(indices[i], &values[i][0]);
+    }
+  }
+  else
+  {
+    for (SizeValueType i = 0; i < numberOfIndices; ++i)
+    {
+      values[i] = this->EvaluateOptimized(Dispatch<ImageDimension>(), indices[i]);
+    }
+  }
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+LinearInterpolateImageFunction<TInputImage, TCoordRep>::EvaluateComponentsAtContinuousIndex(
+  const ContinuousIndexType & index,
+  ScalarRealType *            components) const
+{
+  static_assert(HasVectorPixelArrayBuffer<TInputImage>, "The image must be a VectorImage.");
+
+  const TInputImage * const inputImagePtr = this->GetInputImage();
+  const unsigned int        numberOfComponents = inputImagePtr->GetNumberOfComponentsPerPixel();
+  const auto * const        buffer = inputImagePtr->GetBufferPointer();
+
+  OffsetValueType         lowerOffset;
+  OffsetValueType         upperSteps[ImageDimension];
+  InternalComputationType distances[ImageDimension];
+  this->ComputeNeighborOffsetsAndDistances(index,
+                                           inputImagePtr->GetOffsetTable(),
+                                           inputImagePtr->GetBufferedRegion().GetIndex(),
+                                           lowerOffset,
+                                           upperSteps,
+                                           distances);
+
+  std::fill_n(components, numberOfComponents, ScalarRealType{});
+  constexpr unsigned int numberOfNeighbors = 1 << ImageDimension;
+  for (unsigned int counter = 0; counter < numberOfNeighbors; ++counter)
+  {
+    InternalComputationType weight = 1.0;
+    OffsetValueType         offset = lowerOffset;
+    for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+    {
+      if ((counter >> dim) & 1)
+      {
+        weight *= distances[dim];
+        offset += upperSteps[dim];
+      }
+      else
+      {
+        weight *= 1.0 - distances[dim];
+      }
+    }
+    if (weight == 0.0)
+    {
+      continue;
+    }
+
+    const auto * const neighbor = buffer + offset * static_cast<OffsetValueType>(numberOfComponents);
+    const auto         neighborWeight = static_cast<ScalarRealType>(weight);
+    for (unsigned int c = 0; c < numberOfComponents; ++c)
+    {
+      components[c] += neighborWeight * static_cast<ScalarRealType>(neighbor[c]);
+    }
+  }
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+LinearInterpolateImageFunction<TInputImage, TCoordRep>::EvaluateAtContinuousIndexGrid(
+  const GridCoordinatesType & gridCoordinates,
+  OutputType *                values) const
+{
+  if constexpr (HasPixelArrayBuffer<TInputImage> && std::is_arithmetic_v<InputPixelType>)
+  {
+    // Along each axis, the kernel weights the lower and the upper neighbors,
+    // the lower one alone at the end of the image grid, as EvaluateOptimized().
+    SeparableInterpolationGrid<ImageDimension> grid;
+    for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+    {
+      grid.SetAxis(dim, gridCoordinates[dim].size(), 2);
+      for (SizeValueType i = 0; i < gridCoordinates[dim].size(); ++i)
+      {
+        const double         coordinate = gridCoordinates[dim][i];
+        const IndexValueType lower = std::max(Math::Floor<IndexValueType>(coordinate), this->m_StartIndex[dim]);
+        const double         distance =
+          (lower < this->m_EndIndex[dim]) ? std::max(coordinate - static_cast<double>(lower), 0.0) : 0.0;
+
+        IndexValueType * const indices = grid.GetIndices(dim, i);
+        double * const         weights = grid.GetWeights(dim, i);
+        indices[0] = lower;
+        indices[1] = std::min(lower + 1, this->m_EndIndex[dim]);
+        weights[0] = 1.0 - distance;
+        weights[1] = distance;
+      }
+    }
+    grid.Interpolate(*this->GetInputImage(), values);
+  }
+  else
+  {
+    Superclass::EvaluateAtContinuousIndexGrid(gridCoordinates, values);
+  }
+}
+
 template <typename TInputImage, typename TCoordRep>
 void
 LinearInterpolateImageFunction<TInputImage, TCoordRep>::PrintSelf(std::ostream & os, Indent indent) const
@@ -89,6 +89,28 @@ public:
     return static_cast<OutputType>(this->GetInputImage()->GetPixel(nindex));
   }
 
+  /** Evaluate the function at a batch of ContinuousIndex positions, in a
+   * single virtual call. */
+  void
+  EvaluateAtContinuousIndices(const ContinuousIndexType * indices,
+                              OutputType *                values,
+                              SizeValueType               numberOfIndices) const override
+  {
+    const InputImageType * const inputImage = this->GetInputImage();
+    for (SizeValueType i = 0; i < numberOfIndices; ++i)
+    {
+      IndexType nindex;
+      this->ConvertContinuousIndexToNearestIndex(indices[i], nindex);
+      values[i] = static_cast<OutputType>(inputImage->GetPixel(nindex));
+    }
+  }
+
+  bool
+  IsInsideBufferSeparable() const override
+  {
+    return true;
+  }
+
   SizeType
   GetRadius() const override
   {
@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSeparableInterpolationGrid_h
+#define itkSeparableInterpolationGrid_h
+
+#include "itkIntTypes.h"
+#include <array>
+#include <vector>
+
+namespace itk
+{
+/** \class SeparableInterpolationGrid
+ * \brief Interpolation of an image at the points of a grid, with a kernel which
+ * is a product of one-dimensional kernels.
+ *
+ * The points of the grid are the combinations of its coordinates along each
+ * axis. At each of these coordinates, the one-dimensional kernel of the axis
+ * has the indices along the axis of the pixels it weights, and their weights.
+ * They are set by an interpolator, such as LinearInterpolateImageFunction or
+ * BSplineInterpolateImageFunction, with its boundary conditions already applied
+ * to the indices.
+ *
+ * Interpolate() then interpolates the image along one axis at a time: along
+ * the first axis for the lines of the image which the kernels weight, then
+ * along the second axis for the results, and so on. Each pass is restricted
+ * to the distinct indices which the kernels weight along the axes which are
+ * not interpolated yet. With kernels of k pixels, each point then costs
+ * about k operations per axis, rather than the k^Dimension operations of a
+ * separate evaluation of each point. When the grid is sparser than the
+ * image, as for a strong downsampling, the lines of the image cost more
+ * than the points, and Interpolate() evaluates the points one by one
+ * instead, without intermediate results.
+ *
+ * The pixels of zero weight are skipped, so that a point on a pixel has the
+ * value of the pixel, even when a neighbor is infinite.
+ *
+ * \ingroup ITKImageFunction
+ */
+template <unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT SeparableInterpolationGrid
+{
+public:
+  /** Standard class type aliases. */
+  using Self = SeparableInterpolationGrid;
+
+  static constexpr unsigned int ImageDimension = VDimension;
+
+  /** Sets the number of coordinates of the grid along the axis, and the number
+   * of pixels of the kernel of the axis, whose indices and weights are then set
+   * through GetIndices() and GetWeights(). */
+  void
+  SetAxis(const unsigned int axis, const SizeValueType numberOfCoordinates, const unsigned int kernelSize)
+  {
+    m_NumberOfCoordinates[axis] = numberOfCoordinates;
+    m_KernelSizes[axis] = kernelSize;
+    m_Indices[axis].resize(numberOfCoordinates * kernelSize);
+    m_Weights[axis].resize(numberOfCoordinates * kernelSize);
+  }
+
+  /** The indices along the axis of the pixels of the kernel at a coordinate of
+   * the grid, and their weights. */
+  IndexValueType *
+  GetIndices(const unsigned int axis, const SizeValueType coordinate)
+  {
+    return m_Indices[axis].data() + coordinate * m_KernelSizes[axis];
+  }
+
+  double *
+  GetWeights(const unsigned int axis, const SizeValueType coordinate)
+  {
+    return m_Weights[axis].data() + coordinate * m_KernelSizes[axis];
+  }
+
+  /** Sets values to the sums of the pixels of the image weighted by the kernels,
+   * at the points of the grid, with the first axis varying fastest. Throws an
+   * exception when the kernels reach pixels outside the buffered region. */
+  template <typename TImage, typename TValue>
+  void
+  Interpolate(const TImage & image, TValue * values) const;
+
+  /** The number of intermediate values which Interpolate() keeps at once, or
+   * 0 when it evaluates the points one by one. */
+  SizeValueType
+  GetNumberOfIntermediateValues() const;
+
+private:
+  // The distinct indices along an axis of the pixels which the kernels weight,
+  // and the position among them of each index from the first one.
+  struct WeightedIndices
+  {
+    IndexValueType              m_FirstIndex{};
+    std::vector<IndexValueType> m_Indices{};
+    std::vector<SizeValueType>  m_Positions{};
+  };
+  using WeightedIndicesArray = std::array<WeightedIndices, VDimension>;
+
+  WeightedIndicesArray
+  ComputeWeightedIndices() const;
+
+  // The number of intermediate values of the interpolation along one axis at a
+  // time, or 0 when it takes more operations than the points one by one.
+  SizeValueType
+  ComputeNumberOfIntermediateValues(const WeightedIndicesArray & weightedIndices) const;
+
+  template <typename TImage, typename TValue>
+  void
+  InterpolateAlongAxes(const TImage & image, const WeightedIndicesArray & weightedIndices, TValue * values) const;
+
+  template <typename TImage, typename TValue>
+  void
+  InterpolatePointByPoint(const TImage & image, TValue * values) const;
+
+  std::array<SizeValueType, VDimension>               m_NumberOfCoordinates{};
+  std::array<unsigned int, VDimension>                m_KernelSizes{};
+  std::array<std::vector<IndexValueType>, VDimension> m_Indices{};
+  std::array<std::vector<double>, VDimension>         m_Weights{};
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSeparableInterpolationGrid.hxx"
+#endif
+
+#endif
@@ -0,0 +1,294 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSeparableInterpolationGrid_hxx
+#define itkSeparableInterpolationGrid_hxx
+
+#include "itkMacro.h"
+#include <algorithm>
+
+namespace itk
+{
+template <unsigned int VDimension>
+template <typename TImage, typename TValue>
+void
+SeparableInterpolationGrid<VDimension>::Interpolate(const TImage & image, TValue * values) const
+{
+  static_assert(TImage::ImageDimension == VDimension, "The image must have the dimension of the grid.");
+
+  // The kernels must only reach the pixels of the buffered region.
+  const auto & bufferedRegion = image.GetBufferedRegion();
+  for (unsigned int axis = 0; axis < VDimension; ++axis)
+  {
+    if (m_NumberOfCoordinates[axis] == 0)
+    {
+      return;
+    }
+    const auto minmax = std::minmax_element(m_Indices[axis].cbegin(), m_Indices[axis].cend());
+    if (*minmax.first < bufferedRegion.GetIndex(axis) ||
+        *minmax.second >= bufferedRegion.GetIndex(axis) + static_cast<IndexValueType>(bufferedRegion.GetSize(axis)))
+    {
+      itkGenericExceptionMacro("The kernels along axis " << axis << " reach the indices " << *minmax.first << " to "
+                                                         << *minmax.second << ", outside the buffered region "
+                                                         << bufferedRegion << '.');
+    }
+  }
+
+  const WeightedIndicesArray weightedIndices = this->ComputeWeightedIndices();
+  if (this->ComputeNumberOfIntermediateValues(weightedIndices) > 0)
+  {
+    this->InterpolateAlongAxes(image, weightedIndices, values);
+  }
+  else
+  {
+    this->InterpolatePointByPoint(image, values);
+  }
+}
+
+template <unsigned int VDimension>
+SizeValueType
+SeparableInterpolationGrid<VDimension>::GetNumberOfIntermediateValues() const
+{
+  for (unsigned int axis = 0; axis < VDimension; ++axis)
+  {
+    if (m_NumberOfCoordinates[axis] == 0)
+    {
+      return 0;
+    }
+  }
+  return this->ComputeNumberOfIntermediateValues(this->ComputeWeightedIndices());
+}
+
+template <unsigned int VDimension>
+auto
+SeparableInterpolationGrid<VDimension>::ComputeWeightedIndices() const -> WeightedIndicesArray
+{
+  WeightedIndicesArray weightedIndices;
+  for (unsigned int axis = 0; axis < VDimension; ++axis)
+  {
+    const auto        minmax = std::minmax_element(m_Indices[axis].cbegin(), m_Indices[axis].cend());
+    WeightedIndices & axisIndices = weightedIndices[axis];
+    axisIndices.m_FirstIndex = *minmax.first;
+    std::vector<bool> isWeighted(static_cast<SizeValueType>(*minmax.second - *minmax.first) + 1);
+    for (size_t j = 0; j < m_Indices[axis].size(); ++j)
+    {
+      if (m_Weights[axis][j] != 0.0)
+      {
+        isWeighted[m_Indices[axis][j] - axisIndices.m_FirstIndex] = true;
+      }
+    }
+    axisIndices.m_Positions.resize(isWeighted.size());
+    for (SizeValueType r = 0; r < isWeighted.size(); ++r)
+    {
+      if (isWeighted[r])
+      {
+        axisIndices.m_Positions[r] = axisIndices.m_Indices.size();
+        axisIndices.m_Indices.push_back(axisIndices.m_FirstIndex + static_cast<IndexValueType>(r));
+      }
+    }
+  }
+  return weightedIndices;
+}
+
+template <unsigned int VDimension>
+SizeValueType
+SeparableInterpolationGrid<VDimension>::ComputeNumberOfIntermediateValues(
+  const WeightedIndicesArray & weightedIndices) const
+{
+  // The pass along an axis has a result for each coordinate of the grid along
+  // this axis and the previous ones, and each weighted index along the next
+  // ones, which costs a kernel.
+  double        separableCost = 0.0;
+  double        pointCost = 1.0;
+  SizeValueType numberOfIntermediateValues = 0;
+  SizeValueType previousPassSize = 0;
+  for (unsigned int axis = 0; axis < VDimension; ++axis)
+  {
+    SizeValueType passSize = 1;
+    for (unsigned int previousAxis = 0; previousAxis <= axis; ++previousAxis)
+    {
+      passSize *= m_NumberOfCoordinates[previousAxis];
+    }
+    for (unsigned int nextAxis = axis + 1; nextAxis < VDimension; ++nextAxis)
+    {
+      passSize *= weightedIndices[nextAxis].m_Indices.size();
+    }
+    separableCost += static_cast<double>(passSize) * m_KernelSizes[axis];
+    pointCost *= static_cast<double>(m_NumberOfCoordinates[axis]) * m_KernelSizes[axis];
+    numberOfIntermediateValues = std::max(numberOfIntermediateValues, previousPassSize + passSize);
+    previousPassSize = passSize;
+  }
+  return (separableCost <= pointCost) ? numberOfIntermediateValues : 0;
+}
+
+template <unsigned int VDimension>
+template <typename TImage, typename TValue>
+void
+SeparableInterpolationGrid<VDimension>::InterpolateAlongAxes(const TImage &               image,
+                                                             const WeightedIndicesArray & weightedIndices,
+                                                             TValue *                     values) const
+{
+  // Along the first axis, for each line of the image at the weighted indices
+  // of the other axes.
+  SizeValueType numberOfLines = 1;
+  for (unsigned int axis = 1; axis < VDimension; ++axis)
+  {
+    numberOfLines *= weightedIndices[axis].m_Indices.size();
+  }
+  const SizeValueType numberOfCoordinates0 = m_NumberOfCoordinates[0];
+  const unsigned int  kernelSize0 = m_KernelSizes[0];
+  std::vector<double> input;
+  std::vector<double> output(numberOfCoordinates0 * numberOfLines);
+
+  auto                                  lineIndex = image.GetBufferedRegion().GetIndex();
+  std::array<SizeValueType, VDimension> linePositions{};
+  for (SizeValueType line = 0; line < numberOfLines; ++line)
+  {
+    for (unsigned int axis = 1; axis < VDimension; ++axis)
+    {
+      lineIndex[axis] = weightedIndices[axis].m_Indices[linePositions[axis]];
+    }
+    const auto * const pixels = image.GetBufferPointer() + image.ComputeOffset(lineIndex);
+    double * const     lineOutput = output.data() + line * numberOfCoordinates0;
+    for (SizeValueType i = 0; i < numberOfCoordinates0; ++i)
+    {
+      const IndexValueType * const indices = m_Indices[0].data() + i * kernelSize0;
+      const double * const         weights = m_Weights[0].data() + i * kernelSize0;
+      double                       sum = 0.0;
+      for (unsigned int k = 0; k < kernelSize0; ++k)
+      {
+        if (weights[k] != 0.0)
+        {
+          sum += weights[k] * static_cast<double>(pixels[indices[k] - lineIndex[0]]);
+        }
+      }
+      lineOutput[i] = sum;
+    }
+
+    for (unsigned int axis = 1; axis < VDimension; ++axis)
+    {
+      if (++linePositions[axis] < weightedIndices[axis].m_Indices.size())
+      {
+        break;
+      }
+      linePositions[axis] = 0;
+    }
+  }
+
+  // Along each other axis, for the blocks of the results along the previous
+  // axes, which are contiguous.
+  SizeValueType blockSize = numberOfCoordinates0;
+  for (unsigned int axis = 1; axis < VDimension; ++axis)
+  {
+    SizeValueType numberOfOuterBlocks = 1;
+    for (unsigned int outerAxis = axis + 1; outerAxis < VDimension; ++outerAxis)
+    {
+      numberOfOuterBlocks *= weightedIndices[outerAxis].m_Indices.size();
+    }
+    const WeightedIndices & axisIndices = weightedIndices[axis];
+    const SizeValueType     numberOfCoordinates = m_NumberOfCoordinates[axis];
+    const unsigned int      kernelSize = m_KernelSizes[axis];
+    input.swap(output);
+    output.assign(blockSize * numberOfCoordinates * numberOfOuterBlocks, 0.0);
+
+    for (SizeValueType outer = 0; outer < numberOfOuterBlocks; ++outer)
+    {
+      const double * const outerInput = input.data() + outer * blockSize * axisIndices.m_Indices.size();
+      double * const       outerOutput = output.data() + outer * blockSize * numberOfCoordinates;
+      for (SizeValueType i = 0; i < numberOfCoordinates; ++i)
+      {
+        const IndexValueType * const indices = m_Indices[axis].data() + i * kernelSize;
+        const double * const         weights = m_Weights[axis].data() + i * kernelSize;
+        double * const               block = outerOutput + i * blockSize;
+        for (unsigned int k = 0; k < kernelSize; ++k)
+        {
+          const double weight = weights[k];
+          if (weight == 0.0)
+          {
+            continue;
+          }
+          const double * const inputBlock =
+            outerInput + axisIndices.m_Positions[indices[k] - axisIndices.m_FirstIndex] * blockSize;
+          for (SizeValueType b = 0; b < blockSize; ++b)
+          {
+            block[b] += weight * inputBlock[b];
+          }
+        }
+      }
+    }
+    blockSize *= numberOfCoordinates;
+  }
+
+  std::transform(output.cbegin(), output.cend(), values, [](const double value) { return static_cast<TValue>(value); });
+}
+
+template <unsigned int VDimension>
+template <typename TImage, typename TValue>
+void
+SeparableInterpolationGrid<VDimension>::InterpolatePointByPoint(const TImage & image, TValue * values) const
+{
+  const auto * const            buffer = image.GetBufferPointer();
+  const OffsetValueType * const offsetTable = image.GetOffsetTable();
+  const auto &                  bufferedIndex = image.GetBufferedRegion().GetIndex();
+
+  // Increments the position, the first axis varying fastest.
+  const auto increment = [](auto & position, const auto & size) {
+    for (unsigned int axis = 0; axis < VDimension; ++axis)
+    {
+      if (++position[axis] < size[axis])
+      {
+        return;
+      }
+      position[axis] = 0;
+    }
+  };
+
+  SizeValueType numberOfPoints = 1;
+  SizeValueType numberOfKernelPixels = 1;
+  for (unsigned int axis = 0; axis < VDimension; ++axis)
+  {
+    numberOfPoints *= m_NumberOfCoordinates[axis];
+    numberOfKernelPixels *= m_KernelSizes[axis];
+  }
+  std::array<SizeValueType, VDimension> coordinates{};
+  for (SizeValueType point = 0; point < numberOfPoints; ++point)
+  {
+    std::array<unsigned int, VDimension> kernelPositions{};
+    double                               sum = 0.0;
+    for (SizeValueType kernelPixel = 0; kernelPixel < numberOfKernelPixels; ++kernelPixel)
+    {
+      double          weight = 1.0;
+      OffsetValueType offset = 0;
+      for (unsigned int axis = 0; axis < VDimension; ++axis)
+      {
+        const SizeValueType j = coordinates[axis] * m_KernelSizes[axis] + kernelPositions[axis];
+        weight *= m_Weights[axis][j];
+        offset += (m_Indices[axis][j] - bufferedIndex[axis]) * offsetTable[axis];
+      }
+      if (weight != 0.0)
+      {
+        sum += weight * static_cast<double>(buffer[offset]);
+      }
+      increment(kernelPositions, m_KernelSizes);
+    }
+    values[point] = static_cast<TValue>(sum);
+    increment(coordinates, m_NumberOfCoordinates);
+  }
+}
+} // end namespace itk
+
+#endif
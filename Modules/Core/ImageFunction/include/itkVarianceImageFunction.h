@@ -20,6 +20,7 @@
 
 #include "itkImageFunction.h"
 #include "itkNumericTraits.h"
+#include <vector>
 
 namespace itk
 {
@@ -33,6 +34,11 @@ namespace itk
  * If called with a ContinuousIndex or Point, the calculation is performed
  * at the nearest neighbor.
  *
+ * When the function is evaluated at many pixels of a scalar image, calling
+ * PrecomputeVariances() computes the variances of all the pixels of the buffered
+ * region at once, by a SlidingWindowMoments, in constant time per pixel
+ * whatever the radius. EvaluateAtIndex() then returns the precomputed variances.
+ *
  * This class is templated over the input image type and the
  * coordinate representation type (e.g. float or double ).
  *
@@ -104,11 +110,31 @@ public:
     return this->EvaluateAtIndex(index);
   }
 
+  /** Set the input image. This clears the precomputed variances. */
+  void
+  SetInputImage(const InputImageType * ptr) override;
+
   /** Get/Set the radius of the neighborhood over which the
-      statistics are evaluated */
-  itkSetMacro(NeighborhoodRadius, unsigned int);
+      statistics are evaluated. Setting it clears the precomputed variances. */
+  virtual void
+  SetNeighborhoodRadius(unsigned int radius);
   itkGetConstReferenceMacro(NeighborhoodRadius, unsigned int);
 
+  /** Computes the variances of all the pixels of the buffered region of the
+   * input image, which EvaluateAtIndex() returns until the input image or the
+   * radius is set again. It must be called again after the pixels or the
+   * buffered region of the image change. It has no effect for images whose
+   * pixels are not scalars. */
+  void
+  PrecomputeVariances();
+
+  /** Whether EvaluateAtIndex() returns precomputed variances. */
+  bool
+  HasPrecomputedVariances() const
+  {
+    return !m_Variances.empty();
+  }
+
 protected:
   VarianceImageFunction();
   ~VarianceImageFunction() override = default;
@@ -117,6 +143,9 @@ protected:
 
 private:
   unsigned int m_NeighborhoodRadius{};
+
+  /** The variances of the pixels of the buffered region, in the order of the buffer. */
+  std::vector<RealType> m_Variances{};
 };
 } // end namespace itk
 
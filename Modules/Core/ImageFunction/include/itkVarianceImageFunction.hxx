@@ -20,6 +20,7 @@
 
 
 #include "itkConstNeighborhoodIterator.h"
+#include "itkSlidingWindowMoments.h"
 
 namespace itk
 {
@@ -36,6 +37,54 @@ VarianceImageFunction<TInputImage, TCoordRep>::PrintSelf(std::ostream & os, Inde
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "NeighborhoodRadius: " << m_NeighborhoodRadius << std::endl;
+  os << indent << "HasPrecomputedVariances: " << (this->HasPrecomputedVariances() ? "On" : "Off") << std::endl;
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+VarianceImageFunction<TInputImage, TCoordRep>::SetInputImage(const InputImageType * ptr)
+{
+  m_Variances.clear();
+  Superclass::SetInputImage(ptr);
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+VarianceImageFunction<TInputImage, TCoordRep>::SetNeighborhoodRadius(const unsigned int radius)
+{
+  if (m_NeighborhoodRadius != radius)
+  {
+    m_NeighborhoodRadius = radius;
+    m_Variances.clear();
+    this->Modified();
+  }
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+VarianceImageFunction<TInputImage, TCoordRep>::PrecomputeVariances()
+{
+  m_Variances.clear();
+  const InputImageType * const image = this->GetInputImage();
+  if (image == nullptr)
+  {
+    return;
+  }
+
+  if constexpr (std::is_arithmetic_v<RealType>)
+  {
+    // The order of the pixels of the buffered region is the order of the buffer.
+    SlidingWindowMoments<InputImageType, RealType> moments;
+    moments.Compute(
+      *image, image->GetBufferedRegion(), InputImageType::SizeType::Filled(m_NeighborhoodRadius), true);
+
+    const SizeValueType numberOfPixels = moments.GetSums().size();
+    m_Variances.resize(numberOfPixels);
+    for (SizeValueType i = 0; i < numberOfPixels; ++i)
+    {
+      m_Variances[i] = moments.GetVariance(i);
+    }
+  }
 }
 
 template <typename TInputImage, typename TCoordRep>
@@ -59,6 +108,11 @@ VarianceImageFunction<TInputImage, TCoordRep>::EvaluateAtIndex(const IndexType &
     return (NumericTraits<RealType>::max());
   }
 
+  if (!m_Variances.empty())
+  {
+    return m_Variances[this->GetInputImage()->ComputeOffset(index)];
+  }
+
   // Create an N-d neighborhood kernel, using a zeroflux boundary condition
   typename InputImageType::SizeType kernelSize;
   kernelSize.Fill(m_NeighborhoodRadius);
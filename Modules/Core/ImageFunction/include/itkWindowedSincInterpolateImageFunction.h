@@ -22,6 +22,7 @@
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 #include "itkInterpolateImageFunction.h"
 #include "itkMath.h"
+#include <vector>
 
 namespace itk
 {
@@ -231,23 +232,25 @@ private:
  * The fifth (TCoordRep) is again standard for interpolating functions,
  * and should be float or double.
  *
- * \par CAVEATS
+ * \par PERFORMANCE
  *
- * There are a few improvements that an enthusiastic ITK developer
- * could make to this filter. One issue is with the way that the kernel
- * is applied. The computational expense comes from two sources:
- * computing the kernel weights K(t) and multiplying the pixels in the
- * window by the kernel weights. The first is done more or less
- * efficiently in \f$ 2 m d \f$ operations (where d is the
- * dimensionality of the image). The second can be done
- * better. Presently, each pixel \f$ I(i,j,k) \f$ is multiplied by the
- * weights \f$ K(x-i), K(y-j), K(z-k) \f$ and added to the running
- * total. This results in \f$ d (2m)^d \f$ multiplication
- * operations. However, by keeping intermediate sums, it would be
- * possible to do the operation in \f$ O ( (2m)^d ) \f$
- * operations. This would require some creative coding. In addition, in
- * the case when one of the coordinates is integer, the computation
- * could be reduced by an order of magnitude.
+ * The computational expense comes from two sources: computing the
+ * kernel weights K(t), and multiplying the pixels in the window by the
+ * kernel weights. The first takes \f$ 2 m d \f$ evaluations of the
+ * window and sinc functions (where d is the dimensionality of the
+ * image). With SetKernelOversampling(), they are instead interpolated
+ * linearly from a lookup table of the kernel, sampled at the given
+ * number of points per pixel.
+ *
+ * \par
+ * For images of scalar pixels, when the window lies inside the buffer,
+ * the pixels are summed along the first axis before being weighted
+ * along the others, in about \f$ (2m)^d \f$ multiplications, and the
+ * lines of zero weight, as when a coordinate is integer, are skipped.
+ * ResampleImageFilter interpolates with EvaluateAtContinuousIndexGrid()
+ * when its transform maps the axes of the output grid onto the axes of
+ * the input grid, which costs about \f$ 2 m \f$ operations per axis
+ * and output pixel, as with a Lanczos downsampling for thumbnails.
  *
  * \sa LinearInterpolateImageFunction ResampleImageFilter
  * \sa Function::HammingWindowFunction
@@ -306,6 +309,9 @@ public:
   /** ContinuousIndex type alias support */
   using typename Superclass::ContinuousIndexType;
 
+  /** Grid coordinates type alias support */
+  using typename Superclass::GridCoordinatesType;
+
   void
   SetInputImage(const ImageType * image) override;
 
@@ -318,6 +324,18 @@ public:
   OutputType
   EvaluateAtContinuousIndex(const ContinuousIndexType & index) const override;
 
+  /** Evaluate the function at the points of a grid, along one axis at a time,
+   * for images of scalar pixels with the default ZeroFluxNeumannBoundaryCondition,
+   * whose pixels outside the buffer are the nearest pixels of the buffer. */
+  void
+  EvaluateAtContinuousIndexGrid(const GridCoordinatesType & gridCoordinates, OutputType * values) const override;
+
+  bool
+  IsInsideBufferSeparable() const override
+  {
+    return true;
+  }
+
   SizeType
   GetRadius() const override
   {
@@ -326,6 +344,16 @@ public:
     return radius;
   }
 
+  /** Set/Get the number of samples per pixel of the lookup table of the
+   * kernel. When it is not zero, the weights are interpolated linearly from
+   * the samples of the kernel, computed when it is set, instead of evaluating
+   * the window and sinc functions for each weight. With 1000 samples per
+   * pixel, the weights differ from the exact ones by about 1e-6. Zero, the
+   * default, evaluates the exact weights. */
+  void
+  SetKernelOversampling(unsigned int oversampling);
+  itkGetConstMacro(KernelOversampling, unsigned int);
+
 protected:
   WindowedSincInterpolateImageFunction() = default;
   ~WindowedSincInterpolateImageFunction() override = default;
@@ -352,6 +380,50 @@ private:
   /** Index into the weights array for each offset */
   unsigned int m_WeightOffsetTable[m_OffsetTableSize][ImageDimension]{};
 
+  /** The number of samples per pixel of the kernel table */
+  unsigned int m_KernelOversampling{ 0 };
+
+  /** The kernel at |x| = i / m_KernelOversampling, for i from 0 to
+   * VRadius * m_KernelOversampling, followed by a zero */
+  std::vector<double> m_KernelTable{};
+
+  /** Sets the weights of the m_WindowSize pixels from VRadius - 1 before the
+   * floor of a coordinate to VRadius after it, for the distance of the
+   * coordinate from its floor. */
+  void
+  ComputeWeights(const double distance, double * weights) const
+  {
+    // If distance is zero, i.e. the index falls precisely on the
+    // pixel boundary, the weights form a delta function.
+    if (distance == 0.0)
+    {
+      for (unsigned int i = 0; i < m_WindowSize; ++i)
+      {
+        weights[i] = (i == VRadius - 1) ? 1.0 : 0.0;
+      }
+      return;
+    }
+
+    // x is the offset, hence the parameter of the kernel, taken through the
+    // range (dist + rad - 1, ..., dist - rad), i.e. all x such that
+    // itk::Math::abs(x) <= rad
+    double x = distance + VRadius;
+    for (unsigned int i = 0; i < m_WindowSize; ++i)
+    {
+      x -= 1.0;
+      if (m_KernelTable.empty())
+      {
+        weights[i] = m_WindowFunction(x) * Sinc(x);
+      }
+      else
+      {
+        const double        t = std::abs(x) * m_KernelOversampling;
+        const SizeValueType sample = static_cast<SizeValueType>(t);
+        weights[i] = m_KernelTable[sample] + (t - sample) * (m_KernelTable[sample + 1] - m_KernelTable[sample]);
+      }
+    }
+  }
+
   /** The sinc function */
   inline double
   Sinc(double x) const
@@ -20,6 +20,9 @@
 
 
 #include "itkMath.h"
+#include "itkSIMDPixelTransform.h"
+#include "itkSeparableInterpolationGrid.h"
+#include <algorithm>
 
 namespace itk
 {
@@ -108,6 +111,36 @@ WindowedSincInterpolateImageFunction<TInputImage, VRadius, TWindowFunction, TBou
   }
 }
 
+template <typename TInputImage,
+          unsigned int VRadius,
+          typename TWindowFunction,
+          typename TBoundaryCondition,
+          typename TCoordRep>
+void
+WindowedSincInterpolateImageFunction<TInputImage, VRadius, TWindowFunction, TBoundaryCondition, TCoordRep>::
+  SetKernelOversampling(const unsigned int oversampling)
+{
+  if (oversampling == m_KernelOversampling)
+  {
+    return;
+  }
+  m_KernelOversampling = oversampling;
+
+  // The kernel is even, and zero from VRadius on.
+  m_KernelTable.clear();
+  if (oversampling > 0)
+  {
+    const SizeValueType numberOfSamples = SizeValueType{ VRadius } * oversampling + 1;
+    m_KernelTable.resize(numberOfSamples + 1, 0.0);
+    for (SizeValueType i = 0; i < numberOfSamples; ++i)
+    {
+      const double x = static_cast<double>(i) / oversampling;
+      m_KernelTable[i] = m_WindowFunction(x) * Sinc(x);
+    }
+  }
+  this->Modified();
+}
+
 template <typename TInputImage,
           unsigned int VRadius,
           typename TWindowFunction,
@@ -122,6 +155,7 @@ WindowedSincInterpolateImageFunction<TInputImage, VRadius, TWindowFunction, TBou
 
   os << indent << "OffsetTable: " << m_OffsetTable << std::endl;
   os << indent << "WeightOffsetTable: " << m_WeightOffsetTable << std::endl;
+  os << indent << "KernelOversampling: " << m_KernelOversampling << std::endl;
 }
 
 template <typename TInputImage,
@@ -144,47 +178,75 @@ WindowedSincInterpolateImageFunction<TInputImage, VRadius, TWindowFunction, TBou
     distance[dim] = index[dim] - static_cast<double>(baseIndex[dim]);
   }
 
-  // Position the neighborhood at the index of interest
-  Size<ImageDimension> radius;
-  radius.Fill(VRadius);
-  IteratorType nit(radius, this->GetInputImage(), this->GetInputImage()->GetBufferedRegion());
-  nit.SetLocation(baseIndex);
-
   // Compute the sinc function for each dimension
   double xWeight[ImageDimension][2 * VRadius];
   for (unsigned int dim = 0; dim < ImageDimension; ++dim)
   {
-    // x is the offset, hence the parameter of the kernel
-    double x = distance[dim] + VRadius;
+    this->ComputeWeights(distance[dim], xWeight[dim]);
+  }
+
+  using PixelType = typename NumericTraits<typename TInputImage::PixelType>::RealType;
 
-    // If distance is zero, i.e. the index falls precisely on the
-    // pixel boundary, the weights form a delta function.
-    if (distance[dim] == 0.0)
+  if constexpr (HasPixelArrayBuffer<TInputImage> && std::is_arithmetic_v<typename TInputImage::PixelType>)
+  {
+    // When the window lies inside the buffer, the boundary condition does not
+    // apply, and the pixels of each line along the first axis are summed
+    // before being weighted along the other axes.
+    const TInputImage * const inputImagePtr = this->GetInputImage();
+    const auto &              bufferedRegion = inputImagePtr->GetBufferedRegion();
+    bool                      isInside = true;
+    OffsetValueType           firstOffset = 0;
+    for (unsigned int dim = 0; dim < ImageDimension; ++dim)
     {
-      for (unsigned int i = 0; i < m_WindowSize; ++i)
-      {
-        xWeight[dim][i] = static_cast<int>(i) == VRadius - 1 ? 1 : 0;
-      }
+      const IndexValueType first = baseIndex[dim] - static_cast<IndexValueType>(VRadius) + 1;
+      isInside = isInside && first >= bufferedRegion.GetIndex(dim) &&
+                 first + static_cast<IndexValueType>(m_WindowSize) <=
+                   bufferedRegion.GetIndex(dim) + static_cast<IndexValueType>(bufferedRegion.GetSize(dim));
+      firstOffset += (first - bufferedRegion.GetIndex(dim)) * inputImagePtr->GetOffsetTable()[dim];
     }
-    else
+    if (isInside)
     {
-      // i is the relative offset in dimension dim.
-      for (unsigned int i = 0; i < m_WindowSize; ++i)
+      constexpr unsigned int numberOfLines = m_OffsetTableSize / m_WindowSize;
+      const auto * const     firstPixel = inputImagePtr->GetBufferPointer() + firstOffset;
+      unsigned int           position[ImageDimension]{};
+      PixelType              xPixelValue{};
+      for (unsigned int line = 0; line < numberOfLines; ++line)
       {
-        // Increment the offset, taking it through the range
-        // (dist + rad - 1, ..., dist - rad), i.e. all x
-        // such that itk::Math::abs(x) <= rad
-        x -= 1.0;
-
-        // Compute the weight for this m
-        xWeight[dim][i] = m_WindowFunction(x) * Sinc(x);
+        double          lineWeight = 1.0;
+        OffsetValueType lineOffset = 0;
+        for (unsigned int dim = 1; dim < ImageDimension; ++dim)
+        {
+          lineWeight *= xWeight[dim][position[dim]];
+          lineOffset += position[dim] * inputImagePtr->GetOffsetTable()[dim];
+        }
+        if (lineWeight != 0.0)
+        {
+          PixelType lineValue{};
+          for (unsigned int i = 0; i < m_WindowSize; ++i)
+          {
+            lineValue += xWeight[0][i] * static_cast<PixelType>(firstPixel[lineOffset + i]);
+          }
+          xPixelValue += lineWeight * lineValue;
+        }
+
+        // Move to the next line.
+        for (unsigned int dim = 1; dim < ImageDimension && ++position[dim] == m_WindowSize; ++dim)
+        {
+          position[dim] = 0;
+        }
       }
+      return static_cast<OutputType>(xPixelValue);
     }
   }
 
+  // Position the neighborhood at the index of interest
+  Size<ImageDimension> radius;
+  radius.Fill(VRadius);
+  IteratorType nit(radius, this->GetInputImage(), this->GetInputImage()->GetBufferedRegion());
+  nit.SetLocation(baseIndex);
+
   // Iterate over the neighborhood, taking the correct set
   // of weights in each dimension
-  using PixelType = typename NumericTraits<typename TInputImage::PixelType>::RealType;
   PixelType xPixelValue{};
   for (unsigned int j = 0; j < m_OffsetTableSize; ++j)
   {
@@ -208,6 +270,51 @@ WindowedSincInterpolateImageFunction<TInputImage, VRadius, TWindowFunction, TBou
   // Return the interpolated value
   return static_cast<OutputType>(xPixelValue);
 }
+
+template <typename TInputImage,
+          unsigned int VRadius,
+          typename TWindowFunction,
+          typename TBoundaryCondition,
+          typename TCoordRep>
+void
+WindowedSincInterpolateImageFunction<TInputImage, VRadius, TWindowFunction, TBoundaryCondition, TCoordRep>::
+  EvaluateAtContinuousIndexGrid(const GridCoordinatesType & gridCoordinates, OutputType * values) const
+{
+  if constexpr (HasPixelArrayBuffer<TInputImage> && std::is_arithmetic_v<typename TInputImage::PixelType> &&
+                std::is_same_v<TBoundaryCondition, ZeroFluxNeumannBoundaryCondition<TInputImage, TInputImage>>)
+  {
+    // Along each axis, the kernel has the weights of EvaluateAtContinuousIndex(),
+    // for the pixels from VRadius - 1 before the floor of the coordinate to
+    // VRadius after it, clamped to the buffered region.
+    const auto &                                bufferedRegion = this->GetInputImage()->GetBufferedRegion();
+    SeparableInterpolationGrid<ImageDimension> grid;
+    for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+    {
+      const IndexValueType firstIndex = bufferedRegion.GetIndex(dim);
+      const IndexValueType lastIndex = firstIndex + static_cast<IndexValueType>(bufferedRegion.GetSize(dim)) - 1;
+
+      grid.SetAxis(dim, gridCoordinates[dim].size(), m_WindowSize);
+      for (SizeValueType i = 0; i < gridCoordinates[dim].size(); ++i)
+      {
+        const IndexValueType baseIndex = Math::Floor<IndexValueType>(gridCoordinates[dim][i]);
+        const double         distance = gridCoordinates[dim][i] - static_cast<double>(baseIndex);
+
+        IndexValueType * const indices = grid.GetIndices(dim, i);
+        for (unsigned int k = 0; k < m_WindowSize; ++k)
+        {
+          const IndexValueType offset = static_cast<IndexValueType>(k) - static_cast<IndexValueType>(VRadius) + 1;
+          indices[k] = std::clamp(baseIndex + offset, firstIndex, lastIndex);
+        }
+        this->ComputeWeights(distance, grid.GetWeights(dim, i));
+      }
+    }
+    grid.Interpolate(*this->GetInputImage(), values);
+  }
+  else
+  {
+    Superclass::EvaluateAtContinuousIndexGrid(gridCoordinates, values);
+  }
+}
 } // namespace itk
 
 #endif
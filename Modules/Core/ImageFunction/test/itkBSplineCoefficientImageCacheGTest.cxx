@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkBSplineCoefficientImageCache.h"
+#include "itkBSplineInterpolateImageFunction.h"
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+using CoefficientImageType = itk::Image<double, 3>;
+using CacheType = itk::BSplineCoefficientImageCache<ImageType, CoefficientImageType>;
+
+ImageType::Pointer
+CreateImage()
+{
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType({ { -2, 3, 0 } }, { { 11, 7, 5 } }));
+  image->Allocate();
+  unsigned int value = 0;
+  for (auto & pixel : itk::ImageBufferRange{ *image })
+  {
+    value = (value * 7919 + 13) % 101;
+    pixel = static_cast<float>(value);
+  }
+  return image;
+}
+
+
+std::vector<double>
+GetCoefficients(const CoefficientImageType & coefficientImage)
+{
+  const itk::ImageBufferRange<const CoefficientImageType> range(coefficientImage);
+  return std::vector<double>(range.cbegin(), range.cend());
+}
+
+
+std::vector<double>
+Decompose(const ImageType & image, const unsigned int splineOrder, const itk::ThreadIdType numberOfWorkUnits)
+{
+  const auto filter = CacheType::DecompositionFilterType::New();
+  filter->SetSplineOrder(splineOrder);
+  filter->SetNumberOfWorkUnits(numberOfWorkUnits);
+  filter->SetInput(&image);
+  filter->Update();
+  return GetCoefficients(*filter->GetOutput());
+}
+} // namespace
+
+
+TEST(BSplineDecompositionImageFilter, ComputesTheSameCoefficientsWithAnyNumberOfWorkUnits)
+{
+  const auto image = CreateImage();
+  for (const unsigned int splineOrder : { 2, 3, 5 })
+  {
+    const auto coefficients = Decompose(*image, splineOrder, 1);
+    for (const itk::ThreadIdType numberOfWorkUnits : { 2, 3, 16 })
+    {
+      EXPECT_EQ(Decompose(*image, splineOrder, numberOfWorkUnits), coefficients);
+    }
+  }
+}
+
+
+TEST(BSplineCoefficientImageCache, SharesTheCoefficientsOfAnImage)
+{
+  CacheType::ReleaseCoefficientImages();
+  const auto image = CreateImage();
+
+  const auto coefficientImage = CacheType::GetCoefficientImage(image, 3);
+  ASSERT_NE(coefficientImage, nullptr);
+  EXPECT_EQ(GetCoefficients(*coefficientImage), Decompose(*image, 3, 1));
+  EXPECT_EQ(CacheType::GetCoefficientImage(image, 3), coefficientImage);
+  EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 1u);
+  EXPECT_EQ(CacheType::GetCoefficientImage(nullptr, 3), nullptr);
+
+  // The interpolators which use the cache share its coefficients, and
+  // interpolate as the others.
+  using InterpolatorType = itk::BSplineInterpolateImageFunction<ImageType, double, double>;
+  const auto interpolator = InterpolatorType::New();
+  interpolator->SetInputImage(image);
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    const auto cachingInterpolator = InterpolatorType::New();
+    EXPECT_FALSE(cachingInterpolator->GetUseCoefficientImageCache());
+    cachingInterpolator->UseCoefficientImageCacheOn();
+    cachingInterpolator->SetInputImage(image);
+    EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 1u);
+
+    for (const double x : { -2.0, 0.3, 4.5, 8.0 })
+    {
+      itk::ContinuousIndex<double, 3> index;
+      index[0] = x;
+      index[1] = 3.0 + 0.7 * i;
+      index[2] = 2.2;
+      EXPECT_EQ(cachingInterpolator->EvaluateAtContinuousIndex(index), interpolator->EvaluateAtContinuousIndex(index));
+    }
+  }
+}
+
+
+TEST(BSplineCoefficientImageCache, RecomputesTheCoefficientsOfModifiedImages)
+{
+  CacheType::ReleaseCoefficientImages();
+  const auto image = CreateImage();
+
+  const auto coefficientImage = CacheType::GetCoefficientImage(image, 3);
+  image->GetBufferPointer()[5] += 1.0f;
+  image->Modified();
+  const auto modifiedCoefficientImage = CacheType::GetCoefficientImage(image, 3);
+  EXPECT_NE(modifiedCoefficientImage, coefficientImage);
+  EXPECT_EQ(GetCoefficients(*modifiedCoefficientImage), Decompose(*image, 3, 1));
+  EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 1u);
+
+  // The coefficients of each spline order are kept.
+  const auto linearCoefficientImage = CacheType::GetCoefficientImage(image, 1);
+  EXPECT_NE(linearCoefficientImage, modifiedCoefficientImage);
+  EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 2u);
+  EXPECT_EQ(CacheType::GetCoefficientImage(image, 3), modifiedCoefficientImage);
+  EXPECT_EQ(CacheType::GetCoefficientImage(image, 1), linearCoefficientImage);
+
+  CacheType::ReleaseCoefficientImages();
+  EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 0u);
+  EXPECT_NE(CacheType::GetCoefficientImage(image, 3), modifiedCoefficientImage);
+}
+
+
+TEST(BSplineCoefficientImageCache, ReleasesTheCoefficientsOfDeletedImages)
+{
+  CacheType::ReleaseCoefficientImages();
+  auto       image = CreateImage();
+  const auto otherImage = CreateImage();
+
+  CacheType::GetCoefficientImage(image, 3);
+  CacheType::GetCoefficientImage(image, 2);
+  CacheType::GetCoefficientImage(otherImage, 3);
+  EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 3u);
+
+  image = nullptr;
+  EXPECT_EQ(CacheType::GetNumberOfCoefficientImages(), 1u);
+}
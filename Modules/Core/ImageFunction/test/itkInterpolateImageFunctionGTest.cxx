@@ -0,0 +1,526 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkInterpolateImageFunction.h"
+#include "itkBSplineInterpolateImageFunction.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkNearestNeighborInterpolateImageFunction.h"
+#include "itkWindowedSincInterpolateImageFunction.h"
+
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkIndexRange.h"
+#include "itkRGBPixel.h"
+#include "itkSeparableInterpolationGrid.h"
+#include "itkVectorImage.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+// Creates a test image with an origin other than zero, filled with pseudo-random values.
+template <typename TImage>
+typename TImage::Pointer
+CreateImage(const itk::SizeValueType size = 7)
+{
+  const auto image = TImage::New();
+  auto       index = TImage::IndexType::Filled(-2);
+  index[0] = 3;
+  image->SetRegions(typename TImage::RegionType(index, TImage::SizeType::Filled(size)));
+  image->Allocate();
+  unsigned int value = 0;
+  for (auto & pixel : itk::ImageBufferRange{ *image })
+  {
+    value = (value * 7919 + 13) % 101;
+    pixel = static_cast<typename TImage::PixelType>(value);
+  }
+  return image;
+}
+
+
+// Returns continuous indices inside the buffer of the interpolator: pixels, points between
+// them, the start of the buffer, and the last pixel.
+template <typename TInterpolator>
+std::vector<typename TInterpolator::ContinuousIndexType>
+CreateContinuousIndices(const TInterpolator & interpolator)
+{
+  using ContinuousIndexType = typename TInterpolator::ContinuousIndexType;
+
+  std::vector<ContinuousIndexType> indices;
+  const auto                       startIndex = interpolator.GetStartContinuousIndex();
+  const auto                       endIndex = interpolator.GetEndContinuousIndex();
+  ContinuousIndexType              lastPixel;
+  for (unsigned int dim = 0; dim < TInterpolator::ImageDimension; ++dim)
+  {
+    lastPixel[dim] = endIndex[dim] - 0.5;
+  }
+  for (unsigned int i = 0; i < 100; ++i)
+  {
+    ContinuousIndexType index;
+    for (unsigned int dim = 0; dim < TInterpolator::ImageDimension; ++dim)
+    {
+      const double fraction = ((i * (dim + 3) * 37) % 101) / 101.0;
+      index[dim] = startIndex[dim] + fraction * (endIndex[dim] - startIndex[dim]);
+      if ((i + dim) % 5 == 0)
+      {
+        index[dim] = std::min(std::round(index[dim]), lastPixel[dim]);
+      }
+    }
+    indices.push_back(index);
+  }
+  indices.push_back(startIndex);
+  indices.push_back(lastPixel);
+  return indices;
+}
+
+
+template <typename TInterpolator>
+void
+Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(const TInterpolator & interpolator)
+{
+  const auto indices = CreateContinuousIndices(interpolator);
+  std::vector<typename TInterpolator::OutputType> values(indices.size());
+
+  // Through the base class, as the callers of the interpolators do.
+  const typename TInterpolator::Superclass & base = interpolator;
+  base.EvaluateAtContinuousIndices(indices.data(), values.data(), indices.size());
+  for (size_t i = 0; i < indices.size(); ++i)
+  {
+    EXPECT_EQ(values[i], interpolator.EvaluateAtContinuousIndex(indices[i])) << " at " << indices[i];
+  }
+}
+
+
+template <typename TImage>
+void
+Expect_EvaluateAtContinuousIndices_of_interpolators()
+{
+  const auto image = CreateImage<TImage>();
+
+  const auto linearInterpolator = itk::LinearInterpolateImageFunction<TImage>::New();
+  linearInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(*linearInterpolator);
+
+  const auto nearestNeighborInterpolator = itk::NearestNeighborInterpolateImageFunction<TImage>::New();
+  nearestNeighborInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(*nearestNeighborInterpolator);
+
+  const auto windowedSincInterpolator = itk::WindowedSincInterpolateImageFunction<TImage, 2>::New();
+  windowedSincInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(*windowedSincInterpolator);
+}
+
+
+// Compares EvaluateAtContinuousIndexGrid() with EvaluateAtContinuousIndex() at the points of a
+// grid whose coordinates are pixels, points between them, the start of the buffer, and the
+// last pixel. Interpolating along one axis at a time only changes the order of the sums.
+template <typename TInterpolator>
+void
+Expect_EvaluateAtContinuousIndexGrid_equals_EvaluateAtContinuousIndex(const TInterpolator & interpolator)
+{
+  constexpr unsigned int Dimension = TInterpolator::ImageDimension;
+  using ContinuousIndexType = typename TInterpolator::ContinuousIndexType;
+
+  const auto                                  startIndex = interpolator.GetStartContinuousIndex();
+  const auto                                  endIndex = interpolator.GetEndContinuousIndex();
+  typename TInterpolator::GridCoordinatesType gridCoordinates;
+  itk::SizeValueType                          numberOfPoints = 1;
+  for (unsigned int dim = 0; dim < Dimension; ++dim)
+  {
+    gridCoordinates[dim] = { startIndex[dim], endIndex[dim] - 0.5 };
+    for (unsigned int i = 0; i < 5 + dim; ++i)
+    {
+      const double fraction = ((i * (dim + 3) * 37) % 101) / 101.0;
+      gridCoordinates[dim].push_back(startIndex[dim] + fraction * (endIndex[dim] - startIndex[dim]));
+    }
+    gridCoordinates[dim].push_back(std::round(gridCoordinates[dim].back()));
+    numberOfPoints *= gridCoordinates[dim].size();
+  }
+
+  std::vector<typename TInterpolator::OutputType> values(numberOfPoints);
+  const typename TInterpolator::Superclass &      base = interpolator;
+  base.EvaluateAtContinuousIndexGrid(gridCoordinates, values.data());
+
+  itk::ImageRegion<Dimension> gridRegion;
+  for (unsigned int dim = 0; dim < Dimension; ++dim)
+  {
+    gridRegion.SetSize(dim, gridCoordinates[dim].size());
+  }
+  size_t i = 0;
+  for (const auto & gridIndex : itk::ImageRegionIndexRange<Dimension>(gridRegion))
+  {
+    ContinuousIndexType index;
+    for (unsigned int dim = 0; dim < Dimension; ++dim)
+    {
+      index[dim] = gridCoordinates[dim][gridIndex[dim]];
+    }
+    const double expected = interpolator.EvaluateAtContinuousIndex(index);
+    EXPECT_NEAR(values[i], expected, 1e-12 * (1.0 + std::abs(expected))) << " at " << index;
+    ++i;
+  }
+}
+
+
+template <typename TImage>
+void
+Expect_EvaluateAtContinuousIndexGrid_of_interpolators()
+{
+  const auto image = CreateImage<TImage>();
+
+  const auto linearInterpolator = itk::LinearInterpolateImageFunction<TImage>::New();
+  linearInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndexGrid_equals_EvaluateAtContinuousIndex(*linearInterpolator);
+
+  const auto nearestNeighborInterpolator = itk::NearestNeighborInterpolateImageFunction<TImage>::New();
+  nearestNeighborInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndexGrid_equals_EvaluateAtContinuousIndex(*nearestNeighborInterpolator);
+
+  const auto bSplineInterpolator = itk::BSplineInterpolateImageFunction<TImage>::New();
+  bSplineInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndexGrid_equals_EvaluateAtContinuousIndex(*bSplineInterpolator);
+
+  const auto windowedSincInterpolator = itk::WindowedSincInterpolateImageFunction<TImage, 3>::New();
+  windowedSincInterpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndexGrid_equals_EvaluateAtContinuousIndex(*windowedSincInterpolator);
+}
+} // namespace
+
+
+TEST(InterpolateImageFunction, EvaluateAtContinuousIndicesOfScalarImages)
+{
+  Expect_EvaluateAtContinuousIndices_of_interpolators<itk::Image<unsigned char, 1>>();
+  Expect_EvaluateAtContinuousIndices_of_interpolators<itk::Image<float, 2>>();
+  Expect_EvaluateAtContinuousIndices_of_interpolators<itk::Image<short, 3>>();
+  Expect_EvaluateAtContinuousIndices_of_interpolators<itk::Image<double, 4>>();
+}
+
+
+TEST(InterpolateImageFunction, EvaluateAtContinuousIndicesOfRGBImage)
+{
+  using ImageType = itk::Image<itk::RGBPixel<unsigned char>, 2>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(5));
+  image->Allocate();
+  unsigned char value = 0;
+  for (auto & pixel : itk::ImageBufferRange{ *image })
+  {
+    pixel.Set(value, static_cast<unsigned char>(2 * value), static_cast<unsigned char>(255 - value));
+    value += 9;
+  }
+  const auto interpolator = itk::LinearInterpolateImageFunction<ImageType>::New();
+  interpolator->SetInputImage(image);
+  Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(*interpolator);
+}
+
+
+TEST(InterpolateImageFunction, EvaluateAtContinuousIndicesOfPixelsOfInfiniteValues)
+{
+  using ImageType = itk::Image<double, 2>;
+  using NumericLimits = std::numeric_limits<double>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 3, 2 } });
+  image->Allocate();
+  const double pixels[] = { NumericLimits::infinity(), -NumericLimits::infinity(), 1.0,
+                            NumericLimits::max(),      NumericLimits::lowest(),    NumericLimits::quiet_NaN() };
+  std::copy_n(pixels, 6, image->GetBufferPointer());
+
+  const auto interpolator = itk::LinearInterpolateImageFunction<ImageType>::New();
+  interpolator->SetInputImage(image);
+
+  // A point on a pixel has the value of the pixel, as with EvaluateAtIndex().
+  std::vector<itk::ContinuousIndex<double, 2>> indices;
+  for (const auto & index : itk::ImageRegionIndexRange<2>(image->GetBufferedRegion()))
+  {
+    indices.emplace_back(index);
+  }
+  std::vector<double> values(indices.size());
+  interpolator->EvaluateAtContinuousIndices(indices.data(), values.data(), indices.size());
+  for (size_t i = 0; i < indices.size(); ++i)
+  {
+    if (std::isnan(pixels[i]))
+    {
+      EXPECT_TRUE(std::isnan(values[i]));
+    }
+    else
+    {
+      EXPECT_EQ(values[i], pixels[i]) << " at " << indices[i];
+    }
+  }
+}
+
+
+TEST(InterpolateImageFunction, EvaluateAtContinuousIndexGrid)
+{
+  Expect_EvaluateAtContinuousIndexGrid_of_interpolators<itk::Image<unsigned char, 1>>();
+  Expect_EvaluateAtContinuousIndexGrid_of_interpolators<itk::Image<float, 2>>();
+  Expect_EvaluateAtContinuousIndexGrid_of_interpolators<itk::Image<short, 3>>();
+}
+
+
+// A linear downsampling from 512^3 to 64^3 pixels interpolates the points one
+// by one, without intermediate results, as the lines of the image would cost
+// more than the points. An upsampling interpolates along one axis at a time.
+TEST(SeparableInterpolationGrid, EvaluatesPointsOfStrongDownsamplingOneByOne)
+{
+  const auto setLinearKernels =
+    [](itk::SeparableInterpolationGrid<3> & grid, const itk::SizeValueType numberOfCoordinates, const double step) {
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+      grid.SetAxis(axis, numberOfCoordinates, 2);
+      for (itk::SizeValueType i = 0; i < numberOfCoordinates; ++i)
+      {
+        const double coordinate = i * step + 0.375;
+        const auto   lower = static_cast<itk::IndexValueType>(coordinate);
+        grid.GetIndices(axis, i)[0] = lower;
+        grid.GetIndices(axis, i)[1] = lower + 1;
+        grid.GetWeights(axis, i)[0] = 1.0 - (coordinate - lower);
+        grid.GetWeights(axis, i)[1] = coordinate - lower;
+      }
+    }
+  };
+
+  itk::SeparableInterpolationGrid<3> downsampling;
+  setLinearKernels(downsampling, 64, 8.0);
+  EXPECT_EQ(downsampling.GetNumberOfIntermediateValues(), 0u);
+
+  itk::SeparableInterpolationGrid<3> upsampling;
+  setLinearKernels(upsampling, 128, 0.5);
+  EXPECT_GT(upsampling.GetNumberOfIntermediateValues(), 0u);
+  EXPECT_LE(upsampling.GetNumberOfIntermediateValues(), 2u * 128u * 128u * 128u);
+
+  // The values of the points evaluated one by one.
+  using ImageType = itk::Image<float, 3>;
+  using InterpolatorType = itk::LinearInterpolateImageFunction<ImageType>;
+  const auto image = CreateImage<ImageType>(64);
+  const auto interpolator = InterpolatorType::New();
+  interpolator->SetInputImage(image);
+  const auto                            startIndex = interpolator->GetStartContinuousIndex();
+  InterpolatorType::GridCoordinatesType gridCoordinates;
+  for (unsigned int dim = 0; dim < 3; ++dim)
+  {
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      gridCoordinates[dim].push_back(startIndex[dim] + 8.0 * i + 0.5 + 0.25 * dim);
+    }
+  }
+  std::vector<double> values(8 * 8 * 8);
+  interpolator->EvaluateAtContinuousIndexGrid(gridCoordinates, values.data());
+  size_t i = 0;
+  for (const auto & gridIndex : itk::ZeroBasedIndexRange<3>(itk::Size<3>::Filled(8)))
+  {
+    itk::ContinuousIndex<double, 3> index;
+    for (unsigned int dim = 0; dim < 3; ++dim)
+    {
+      index[dim] = gridCoordinates[dim][gridIndex[dim]];
+    }
+    const double expected = interpolator->EvaluateAtContinuousIndex(index);
+    EXPECT_NEAR(values[i], expected, 1e-12 * (1.0 + std::abs(expected))) << " at " << index;
+    ++i;
+  }
+}
+
+
+TEST(LinearInterpolateImageFunction, EvaluateComponentsOfVectorImage)
+{
+  using VectorImageType = itk::VectorImage<float, 3>;
+  using ScalarImageType = itk::Image<float, 3>;
+  constexpr unsigned int numberOfComponents = 7;
+
+  // Each component of the vector image is one of the scalar images.
+  const auto                          vectorImage = VectorImageType::New();
+  std::vector<ScalarImageType::Pointer> scalarImages;
+  for (unsigned int c = 0; c < numberOfComponents; ++c)
+  {
+    scalarImages.push_back(CreateImage<ScalarImageType>());
+    std::transform(scalarImages[c]->GetBufferPointer(),
+                   scalarImages[c]->GetBufferPointer() + scalarImages[c]->GetBufferedRegion().GetNumberOfPixels(),
+                   scalarImages[c]->GetBufferPointer(),
+                   [c](const float pixel) { return pixel * static_cast<float>(c + 1) - 20.0f; });
+  }
+  vectorImage->SetRegions(scalarImages[0]->GetBufferedRegion());
+  vectorImage->SetNumberOfComponentsPerPixel(numberOfComponents);
+  vectorImage->Allocate();
+  const itk::SizeValueType numberOfPixels = vectorImage->GetBufferedRegion().GetNumberOfPixels();
+  for (itk::SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    for (unsigned int c = 0; c < numberOfComponents; ++c)
+    {
+      vectorImage->GetBufferPointer()[i * numberOfComponents + c] = scalarImages[c]->GetBufferPointer()[i];
+    }
+  }
+
+  const auto vectorInterpolator = itk::LinearInterpolateImageFunction<VectorImageType>::New();
+  vectorInterpolator->SetInputImage(vectorImage);
+  std::vector<itk::LinearInterpolateImageFunction<ScalarImageType>::Pointer> scalarInterpolators;
+  for (unsigned int c = 0; c < numberOfComponents; ++c)
+  {
+    scalarInterpolators.push_back(itk::LinearInterpolateImageFunction<ScalarImageType>::New());
+    scalarInterpolators[c]->SetInputImage(scalarImages[c]);
+  }
+
+  const auto indices = CreateContinuousIndices(*vectorInterpolator);
+  std::vector<itk::LinearInterpolateImageFunction<VectorImageType>::OutputType> values(indices.size());
+  vectorInterpolator->EvaluateAtContinuousIndices(indices.data(), values.data(), indices.size());
+  const double * const firstValueData = values[0].GetDataPointer();
+  vectorInterpolator->EvaluateAtContinuousIndices(indices.data(), values.data(), indices.size());
+  EXPECT_EQ(values[0].GetDataPointer(), firstValueData);
+
+  double components[numberOfComponents];
+  for (size_t i = 0; i < indices.size(); ++i)
+  {
+    vectorInterpolator->EvaluateComponentsAtContinuousIndex(indices[i], components);
+    const auto value = vectorInterpolator->EvaluateAtContinuousIndex(indices[i]);
+    ASSERT_EQ(value.GetSize(), numberOfComponents);
+    ASSERT_EQ(values[i].GetSize(), numberOfComponents);
+    for (unsigned int c = 0; c < numberOfComponents; ++c)
+    {
+      const double expected = scalarInterpolators[c]->EvaluateAtContinuousIndex(indices[i]);
+      EXPECT_NEAR(components[c], expected, 1e-12 * (1.0 + std::abs(expected))) << " at " << indices[i];
+      EXPECT_EQ(value[c], components[c]);
+      EXPECT_EQ(values[i][c], components[c]);
+    }
+  }
+}
+
+
+TEST(LinearInterpolateImageFunction, EvaluateComponentsOfVectorImageOfInfiniteValues)
+{
+  using ImageType = itk::VectorImage<double, 2>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 2, 2 } });
+  image->SetNumberOfComponentsPerPixel(2);
+  image->Allocate();
+  const double pixels[] = { std::numeric_limits<double>::infinity(), 1.0, 2.0, -std::numeric_limits<double>::infinity(),
+                            3.0, 4.0, 5.0, 6.0 };
+  std::copy_n(pixels, 8, image->GetBufferPointer());
+
+  const auto interpolator = itk::LinearInterpolateImageFunction<ImageType>::New();
+  interpolator->SetInputImage(image);
+
+  // A point on a pixel has the value of the pixel.
+  for (const auto & index : itk::ImageRegionIndexRange<2>(image->GetBufferedRegion()))
+  {
+    const auto value = interpolator->EvaluateAtContinuousIndex(itk::ContinuousIndex<double, 2>(index));
+    EXPECT_EQ(value, image->GetPixel(index)) << " at " << index;
+  }
+}
+
+
+TEST(WindowedSincInterpolateImageFunction, EvaluateWithKernelLookupTable)
+{
+  using ImageType = itk::Image<float, 2>;
+  using WindowFunctionType = itk::Function::LanczosWindowFunction<3>;
+  using InterpolatorType = itk::WindowedSincInterpolateImageFunction<ImageType, 3, WindowFunctionType>;
+  const auto image = CreateImage<ImageType>(16);
+  const auto interpolator = InterpolatorType::New();
+  interpolator->SetInputImage(image);
+  EXPECT_EQ(interpolator->GetKernelOversampling(), 0u);
+
+  // The sum of the pixels weighted by the kernel, with the indices clamped to
+  // the buffer, as by the ZeroFluxNeumannBoundaryCondition.
+  const auto & region = image->GetBufferedRegion();
+  const auto   reference = [&image, &region](const InterpolatorType::ContinuousIndexType & index) {
+    const WindowFunctionType windowFunction;
+    const auto               kernel = [&windowFunction](const double x) {
+      return x == 0.0 ? 1.0 : windowFunction(x) * std::sin(itk::Math::pi * x) / (itk::Math::pi * x);
+    };
+    const itk::IndexValueType floor0 = itk::Math::Floor<itk::IndexValueType>(index[0]);
+    const itk::IndexValueType floor1 = itk::Math::Floor<itk::IndexValueType>(index[1]);
+    double                    value = 0.0;
+    for (itk::IndexValueType j = floor1 - 2; j <= floor1 + 3; ++j)
+    {
+      for (itk::IndexValueType i = floor0 - 2; i <= floor0 + 3; ++i)
+      {
+        const ImageType::IndexType pixelIndex{
+          { std::clamp(i, region.GetIndex(0), region.GetUpperIndex()[0]),
+            std::clamp(j, region.GetIndex(1), region.GetUpperIndex()[1]) }
+        };
+        value += kernel(index[0] - i) * kernel(index[1] - j) * image->GetPixel(pixelIndex);
+      }
+    }
+    return value;
+  };
+
+  const auto indices = CreateContinuousIndices(*interpolator);
+  for (const auto & index : indices)
+  {
+    const double expected = reference(index);
+    EXPECT_NEAR(interpolator->EvaluateAtContinuousIndex(index), expected, 1e-12 * (1.0 + std::abs(expected)))
+      << " at " << index;
+  }
+
+  interpolator->SetKernelOversampling(1000);
+  EXPECT_EQ(interpolator->GetKernelOversampling(), 1000u);
+  for (const auto & index : indices)
+  {
+    const double expected = reference(index);
+    EXPECT_NEAR(interpolator->EvaluateAtContinuousIndex(index), expected, 1e-4 * (1.0 + std::abs(expected)))
+      << " at " << index;
+  }
+  Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(*interpolator);
+  Expect_EvaluateAtContinuousIndexGrid_equals_EvaluateAtContinuousIndex(*interpolator);
+
+  interpolator->SetKernelOversampling(0);
+  for (const auto & index : indices)
+  {
+    const double expected = reference(index);
+    EXPECT_NEAR(interpolator->EvaluateAtContinuousIndex(index), expected, 1e-12 * (1.0 + std::abs(expected)))
+      << " at " << index;
+  }
+}
+
+
+TEST(BSplineInterpolateImageFunction, EvaluateValuesAndDerivativesAtContinuousIndices)
+{
+  using ImageType = itk::Image<float, 3>;
+  using InterpolatorType = itk::BSplineInterpolateImageFunction<ImageType>;
+  const auto image = CreateImage<ImageType>();
+
+  for (const unsigned int splineOrder : { 1, 3 })
+  {
+    const auto interpolator = InterpolatorType::New();
+    interpolator->SetSplineOrder(splineOrder);
+    interpolator->SetInputImage(image);
+    Expect_EvaluateAtContinuousIndices_equals_EvaluateAtContinuousIndex(*interpolator);
+
+    const auto indices = CreateContinuousIndices(*interpolator);
+    std::vector<InterpolatorType::OutputType>          values(indices.size());
+    std::vector<InterpolatorType::CovariantVectorType> derivatives(indices.size());
+    interpolator->EvaluateValuesAndDerivativesAtContinuousIndices(
+      indices.data(), values.data(), derivatives.data(), indices.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+      InterpolatorType::OutputType          value;
+      InterpolatorType::CovariantVectorType derivative;
+      interpolator->EvaluateValueAndDerivativeAtContinuousIndex(indices[i], value, derivative);
+      EXPECT_EQ(values[i], value) << " at " << indices[i];
+      EXPECT_EQ(derivatives[i], derivative) << " at " << indices[i];
+    }
+
+    // Without derivatives, only the values are evaluated.
+    std::vector<InterpolatorType::OutputType> valuesOnly(indices.size());
+    interpolator->EvaluateValuesAndDerivativesAtContinuousIndices(
+      indices.data(), valuesOnly.data(), nullptr, indices.size());
+    EXPECT_EQ(valuesOnly, values);
+  }
+}
@@ -20,6 +20,7 @@
 
 #include "itkVarianceImageFunction.h"
 #include "itkImage.h"
+#include "itkTestingMacros.h"
 
 int
 itkVarianceImageFunctionTest(int, char *[])
@@ -100,6 +101,34 @@ itkVarianceImageFunctionTest(int, char *[])
     return EXIT_FAILURE;
   }
 
+  // The precomputed variances are the variances of the neighborhoods,
+  // including the neighborhoods which overlap the boundary.
+  PixelType * const buffer = image->GetBufferPointer();
+  for (itk::SizeValueType i = 0; i < region.GetNumberOfPixels(); ++i)
+  {
+    buffer[i] = static_cast<PixelType>((i * 7919) % 251);
+  }
+  function->SetNeighborhoodRadius(2);
+  const ImageType::IndexType indices[] = { { { 25, 25, 25 } }, { { 0, 0, 0 } }, { { 49, 1, 30 } } };
+  std::vector<FunctionType::OutputType> variances;
+  for (const auto & i : indices)
+  {
+    variances.push_back(function->EvaluateAtIndex(i));
+  }
+  function->PrecomputeVariances();
+  ITK_TEST_EXPECT_TRUE(function->HasPrecomputedVariances());
+  for (unsigned int i = 0; i < variances.size(); ++i)
+  {
+    if (itk::Math::abs(function->EvaluateAtIndex(indices[i]) - variances[i]) > 1e-6 * variances[i])
+    {
+      std::cerr << "Error in precomputed variance at " << indices[i] << ": " << function->EvaluateAtIndex(indices[i])
+                << " instead of " << variances[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  function->SetNeighborhoodRadius(3);
+  ITK_TEST_EXPECT_TRUE(!function->HasPrecomputedVariances());
+
   std::cout << "Test PASSED ! " << std::endl;
   return EXIT_SUCCESS;
 }
@@ -18,6 +18,7 @@
 #ifndef itkCompositeTransform_h
 #define itkCompositeTransform_h
 
+#include "itkAffineTransform.h"
 #include "itkMultiTransform.h"
 
 #include <deque>
@@ -81,6 +82,13 @@ namespace itk
  * sub transform and adding them to a composite transform in reverse order.
  * The m_TransformsToOptimizeFlags is copied in reverse for the inverse.
  *
+ * Merging:
+ * Once the sub transforms are set, as before resampling with the result of
+ * a registration, MergeMatrixOffsetTransforms() replaces each sequence of
+ * adjacent MatrixOffsetTransformBase sub transforms, such as an Euler and
+ * an affine transform, by a single AffineTransform, so that TransformPoint
+ * goes through one matrix product for them.
+ *
  * \ingroup ITKTransform
  */
 template <typename TParametersValueType = double, unsigned int VDimension = 3>
@@ -386,6 +394,17 @@ public:
   virtual void
   FlattenTransformQueue();
 
+  /**
+   * Replace each sequence of adjacent sub transforms which derive from
+   * MatrixOffsetTransformBase by a single AffineTransform, which maps points
+   * as the sequence does. The merged transform is set to be optimized if any
+   * of the transforms of the sequence was, and its parameters are those of
+   * the AffineTransform. The sub transforms themselves are not modified.
+   * Nested composite transforms are merged after FlattenTransformQueue().
+   */
+  virtual void
+  MergeMatrixOffsetTransforms();
+
   /**
    * Compute the Jacobian with respect to the parameters for the composite
    * transform using Jacobian rule. See comments in the implementation.
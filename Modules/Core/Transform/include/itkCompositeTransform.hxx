@@ -944,6 +944,50 @@ CompositeTransform<TParametersValueType, VDimension>::FlattenTransformQueue()
 }
 
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+CompositeTransform<TParametersValueType, VDimension>::MergeMatrixOffsetTransforms()
+{
+  using MatrixOffsetTransformType = MatrixOffsetTransformBase<TParametersValueType, VDimension, VDimension>;
+  using AffineTransformType = AffineTransform<TParametersValueType, VDimension>;
+
+  TransformQueueType            transformQueue;
+  TransformsToOptimizeFlagsType transformsToOptimizeFlags;
+
+  for (SizeValueType m = 0; m < this->GetNumberOfTransforms(); ++m)
+  {
+    const auto * const transform =
+      dynamic_cast<const MatrixOffsetTransformType *>(this->m_TransformQueue[m].GetPointer());
+    const auto * const previousTransform =
+      transformQueue.empty() ? nullptr
+                             : dynamic_cast<const MatrixOffsetTransformType *>(transformQueue.back().GetPointer());
+    if (transform && previousTransform)
+    {
+      // The transforms are applied in reverse queue order, the previous
+      // transform after this one.
+      const auto & previousMatrix = previousTransform->GetMatrix();
+      auto         mergedTransform = AffineTransformType::New();
+      mergedTransform->SetMatrix(previousMatrix * transform->GetMatrix());
+      mergedTransform->SetOffset(previousMatrix * transform->GetOffset() + previousTransform->GetOffset());
+      transformQueue.back() = mergedTransform.GetPointer();
+      transformsToOptimizeFlags.back() = transformsToOptimizeFlags.back() || this->m_TransformsToOptimizeFlags[m];
+    }
+    else
+    {
+      transformQueue.push_back(this->m_TransformQueue[m]);
+      transformsToOptimizeFlags.push_back(this->m_TransformsToOptimizeFlags[m]);
+    }
+  }
+
+  if (transformQueue.size() != this->m_TransformQueue.size())
+  {
+    this->m_TransformQueue = transformQueue;
+    this->m_TransformsToOptimizeFlags = transformsToOptimizeFlags;
+    this->Modified();
+  }
+}
+
+
 template <typename TParametersValueType, unsigned int VDimension>
 void
 CompositeTransform<TParametersValueType, VDimension>::PrintSelf(std::ostream & os, Indent indent) const
@@ -0,0 +1,108 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkCompositeTransform.h"
+#include "itkEuler3DTransform.h"
+#include "itkScaleTransform.h"
+#include "itkSimilarity3DTransform.h"
+#include "itkTranslationTransform.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+
+TEST(CompositeTransform, MergeMatrixOffsetTransforms)
+{
+  using CompositeTransformType = itk::CompositeTransform<double, 3>;
+  using AffineTransformType = itk::AffineTransform<double, 3>;
+  using PointType = CompositeTransformType::InputPointType;
+
+  const auto eulerTransform = itk::Euler3DTransform<double>::New();
+  eulerTransform->SetRotation(0.1, -0.2, 0.3);
+  eulerTransform->SetCenter(PointType{ { 1.0, 2.0, 3.0 } });
+  eulerTransform->SetTranslation(itk::MakeVector(4.0, -5.0, 6.0));
+
+  const auto affineTransform = AffineTransformType::New();
+  affineTransform->Scale(itk::MakeVector(1.1, 0.9, 1.2));
+  affineTransform->Shear(0, 2, 0.15);
+  affineTransform->Translate(itk::MakeVector(-1.0, 0.5, 2.0));
+
+  const auto translationTransform = itk::TranslationTransform<double, 3>::New();
+  translationTransform->SetOffset(itk::MakeVector(0.25, 0.5, -0.75));
+
+  const auto similarityTransform = itk::Similarity3DTransform<double>::New();
+  similarityTransform->SetScale(1.3);
+  similarityTransform->SetCenter(PointType{ { -2.0, 0.0, 1.0 } });
+
+  const auto scaleTransform = itk::ScaleTransform<double, 3>::New();
+  scaleTransform->SetScale(itk::MakeVector(0.5, 2.0, 1.5));
+
+  const auto lastEulerTransform = itk::Euler3DTransform<double>::New();
+  lastEulerTransform->SetRotation(-0.3, 0.0, 0.2);
+
+  const auto transform = CompositeTransformType::New();
+  transform->AddTransform(eulerTransform);
+  transform->AddTransform(affineTransform);
+  transform->AddTransform(translationTransform);
+  transform->AddTransform(similarityTransform);
+  transform->AddTransform(scaleTransform);
+  transform->AddTransform(translationTransform);
+  transform->AddTransform(lastEulerTransform);
+  transform->SetAllTransformsToOptimizeOff();
+  transform->SetNthTransformToOptimizeOn(1);
+
+  const std::vector<PointType> points{ PointType{ { 0.0, 0.0, 0.0 } },
+                                       PointType{ { 1.5, -2.0, 3.25 } },
+                                       PointType{ { -10.0, 7.0, 100.0 } } };
+  std::vector<PointType>       expectedPoints;
+  for (const auto & point : points)
+  {
+    expectedPoints.push_back(transform->TransformPoint(point));
+  }
+
+  transform->MergeMatrixOffsetTransforms();
+
+  // The adjacent Euler and affine transforms, and the adjacent similarity and
+  // scale transforms, are each replaced by an affine transform.
+  ASSERT_EQ(transform->GetNumberOfTransforms(), 5u);
+  EXPECT_NE(dynamic_cast<const AffineTransformType *>(transform->GetNthTransformConstPointer(0)), nullptr);
+  EXPECT_EQ(transform->GetNthTransformConstPointer(1), translationTransform.GetPointer());
+  EXPECT_NE(dynamic_cast<const AffineTransformType *>(transform->GetNthTransformConstPointer(2)), nullptr);
+  EXPECT_EQ(transform->GetNthTransformConstPointer(3), translationTransform.GetPointer());
+  EXPECT_EQ(transform->GetNthTransformConstPointer(4), lastEulerTransform.GetPointer());
+  EXPECT_TRUE(transform->GetNthTransformToOptimize(0));
+  EXPECT_FALSE(transform->GetNthTransformToOptimize(2));
+  EXPECT_EQ(transform->GetNumberOfParameters(), 12u);
+
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    const PointType mergedPoint = transform->TransformPoint(points[i]);
+    for (unsigned int dim = 0; dim < 3; ++dim)
+    {
+      EXPECT_NEAR(mergedPoint[dim], expectedPoints[i][dim], 1e-12 * (1.0 + std::abs(expectedPoints[i][dim])));
+    }
+  }
+
+  // Nothing is left to merge.
+  const auto mTime = transform->GetMTime();
+  transform->MergeMatrixOffsetTransforms();
+  EXPECT_EQ(transform->GetNumberOfTransforms(), 5u);
+  EXPECT_EQ(transform->GetMTime(), mTime);
+}
@@ -19,6 +19,7 @@
 #define itkBinaryGeneratorImageFilter_h
 
 #include "itkInPlaceImageFilter.h"
+#include "itkSIMDPixelTransform.h"
 #include "itkSimpleDataObjectDecorator.h"
 
 
@@ -186,6 +186,101 @@ BinaryGeneratorImageFilter<TInputImage1, TInputImage2, TOutputImage>::DynamicThr
 
   TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
 
+  if constexpr (Functor::IsSIMDVectorizable<TFunctor>::value && HasPixelArrayBuffer<TInputImage1> &&
+                HasPixelArrayBuffer<TInputImage2> && HasPixelArrayBuffer<TOutputImage>)
+  {
+    // The lines of the images are arrays, to which the functor is applied
+    // with SIMD instructions, all at once when they follow each other.
+    const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+    const bool          isContiguous =
+      IsContiguousInBuffer(outputRegionForThread, outputPtr->GetBufferedRegion()) &&
+      (!inputPtr1 || IsContiguousInBuffer(outputRegionForThread, inputPtr1->GetBufferedRegion())) &&
+      (!inputPtr2 || IsContiguousInBuffer(outputRegionForThread, inputPtr2->GetBufferedRegion()));
+
+    if (inputPtr1 && inputPtr2)
+    {
+      if (isContiguous)
+      {
+        const SizeValueType numberOfPixels = outputRegionForThread.GetNumberOfPixels();
+        SIMDTransformPixels(functor,
+                            inputPtr1->GetBufferPointer() + inputPtr1->ComputeOffset(outputRegionForThread.GetIndex()),
+                            inputPtr2->GetBufferPointer() + inputPtr2->ComputeOffset(outputRegionForThread.GetIndex()),
+                            outputPtr->GetBufferPointer() + outputPtr->ComputeOffset(outputRegionForThread.GetIndex()),
+                            numberOfPixels);
+        progress.Completed(numberOfPixels);
+        return;
+      }
+      ImageScanlineConstIterator inputIt1(inputPtr1, outputRegionForThread);
+      ImageScanlineConstIterator inputIt2(inputPtr2, outputRegionForThread);
+      ImageScanlineIterator      outputIt(outputPtr, outputRegionForThread);
+      while (!inputIt1.IsAtEnd())
+      {
+        SIMDTransformPixels(functor, &inputIt1.Value(), &inputIt2.Value(), &outputIt.Value(), lineLength);
+        progress.Completed(lineLength);
+        inputIt1.NextLine();
+        inputIt2.NextLine();
+        outputIt.NextLine();
+      }
+      return;
+    }
+    // The constants are copied, so that the compiler knows that they do not
+    // change while the output is written.
+    if (inputPtr1)
+    {
+      const Input2ImagePixelType input2Value = this->GetConstant2();
+      const auto                 functor1 = [&functor, input2Value](const Input1ImagePixelType & input1Value) {
+        return functor(input1Value, input2Value);
+      };
+      if (isContiguous)
+      {
+        const SizeValueType numberOfPixels = outputRegionForThread.GetNumberOfPixels();
+        SIMDTransformPixels(functor1,
+                            inputPtr1->GetBufferPointer() + inputPtr1->ComputeOffset(outputRegionForThread.GetIndex()),
+                            outputPtr->GetBufferPointer() + outputPtr->ComputeOffset(outputRegionForThread.GetIndex()),
+                            numberOfPixels);
+        progress.Completed(numberOfPixels);
+        return;
+      }
+      ImageScanlineConstIterator inputIt1(inputPtr1, outputRegionForThread);
+      ImageScanlineIterator      outputIt(outputPtr, outputRegionForThread);
+      while (!inputIt1.IsAtEnd())
+      {
+        SIMDTransformPixels(functor1, &inputIt1.Value(), &outputIt.Value(), lineLength);
+        progress.Completed(lineLength);
+        inputIt1.NextLine();
+        outputIt.NextLine();
+      }
+      return;
+    }
+    if (inputPtr2)
+    {
+      const Input1ImagePixelType input1Value = this->GetConstant1();
+      const auto                 functor2 = [&functor, input1Value](const Input2ImagePixelType & input2Value) {
+        return functor(input1Value, input2Value);
+      };
+      if (isContiguous)
+      {
+        const SizeValueType numberOfPixels = outputRegionForThread.GetNumberOfPixels();
+        SIMDTransformPixels(functor2,
+                            inputPtr2->GetBufferPointer() + inputPtr2->ComputeOffset(outputRegionForThread.GetIndex()),
+                            outputPtr->GetBufferPointer() + outputPtr->ComputeOffset(outputRegionForThread.GetIndex()),
+                            numberOfPixels);
+        progress.Completed(numberOfPixels);
+        return;
+      }
+      ImageScanlineConstIterator inputIt2(inputPtr2, outputRegionForThread);
+      ImageScanlineIterator      outputIt(outputPtr, outputRegionForThread);
+      while (!inputIt2.IsAtEnd())
+      {
+        SIMDTransformPixels(functor2, &inputIt2.Value(), &outputIt.Value(), lineLength);
+        progress.Completed(lineLength);
+        inputIt2.NextLine();
+        outputIt.NextLine();
+      }
+      return;
+    }
+  }
+
   if (inputPtr1 && inputPtr2)
   {
     ImageScanlineConstIterator inputIt1(inputPtr1, outputRegionForThread);
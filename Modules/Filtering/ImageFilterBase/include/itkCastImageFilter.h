@@ -19,6 +19,7 @@
 #define itkCastImageFilter_h
 
 #include "itkUnaryFunctorImageFilter.h"
+#include "itkPixelwiseFusionStage.h"
 #include "itkProgressReporter.h"
 #include "itkMetaProgrammingLibrary.h"
 
@@ -97,7 +98,9 @@ public:
  * \endsphinx
  */
 template <typename TInputImage, typename TOutputImage>
-class ITK_TEMPLATE_EXPORT CastImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+class ITK_TEMPLATE_EXPORT CastImageFilter
+  : public InPlaceImageFilter<TInputImage, TOutputImage>
+  , public PixelwiseFusionStage
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(CastImageFilter);
@@ -122,6 +125,34 @@ public:
   /** \see LightObject::GetNameOfClass() */
   itkOverrideGetNameOfClassMacro(CastImageFilter);
 
+  /** The cast may be fused with the neighboring filters by
+   * FusedPixelwiseImageFilter, for itk::Image inputs and outputs of the same
+   * dimension, whose pixels are static castable. \sa PixelwiseFusionStage */
+  bool
+  CanFusePixelwise() const override
+  {
+    return PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>() &&
+           mpl::is_static_castable<InputPixelType, OutputPixelType>::value;
+  }
+  size_t
+  GetFusionInputPixelSize() const override
+  {
+    return sizeof(InputPixelType);
+  }
+  size_t
+  GetFusionOutputPixelSize() const override
+  {
+    return sizeof(OutputPixelType);
+  }
+  void
+  BeforeFusedTransformPixels() override
+  {}
+  void
+  FusedTransformPixels(const void * input, void * output, SizeValueType numberOfPixels) override;
+  void
+  AfterFusedTransformPixels() override
+  {}
+
 protected:
   CastImageFilter();
   ~CastImageFilter() override = default;
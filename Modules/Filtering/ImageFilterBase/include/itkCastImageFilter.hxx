@@ -78,6 +78,32 @@ CastImageFilter<TInputImage, TOutputImage>::GenerateOutputInformation()
 }
 
 
+template <typename TInputImage, typename TOutputImage>
+void
+CastImageFilter<TInputImage, TOutputImage>::FusedTransformPixels(const void *  input,
+                                                                 void *        output,
+                                                                 SizeValueType numberOfPixels)
+{
+  if constexpr (PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>() &&
+                mpl::is_static_castable<InputPixelType, OutputPixelType>::value)
+  {
+    const auto * inputPixels = static_cast<const InputPixelType *>(input);
+    auto *       outputPixels = static_cast<OutputPixelType *>(output);
+    for (SizeValueType i = 0; i < numberOfPixels; ++i)
+    {
+      outputPixels[i] = static_cast<OutputPixelType>(inputPixels[i]);
+    }
+  }
+  else
+  {
+    (void)input;
+    (void)output;
+    (void)numberOfPixels;
+    itkExceptionMacro("The pixels of " << this->GetNameOfClass() << " cannot be fused.");
+  }
+}
+
+
 template <typename TInputImage, typename TOutputImage>
 void
 CastImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
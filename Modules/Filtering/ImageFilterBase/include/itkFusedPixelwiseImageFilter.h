@@ -0,0 +1,164 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFusedPixelwiseImageFilter_h
+#define itkFusedPixelwiseImageFilter_h
+
+#include "itkInPlaceImageFilter.h"
+#include "itkPixelwiseFusionStage.h"
+#include <vector>
+
+namespace itk
+{
+/** \class FusedPixelwiseImageFilter
+ * \brief Executes a chain of pixel-wise filters in a single pass.
+ *
+ * A chain of pixel-wise filters, like CastImageFilter, ShiftScaleImageFilter,
+ * ClampImageFilter and BinaryThresholdImageFilter, reads and writes a whole
+ * image for each filter. FusedPixelwiseImageFilter executes such a chain as
+ * a single filter: each thread applies the operations of the filters one
+ * after the other to chunks of a few thousand pixels of its output region,
+ * kept in small buffers, so that the intermediate images are neither
+ * allocated nor written to memory.
+ *
+ * The chain is given by its last filter. The fused filter walks the
+ * pipeline upstream from it while the filters implement
+ * PixelwiseFusionStage and CanFusePixelwise() returns true, that is
+ * UnaryFunctorImageFilter and UnaryGeneratorImageFilter subclasses,
+ * CastImageFilter and ShiftScaleImageFilter, for itk::Image inputs and
+ * outputs of the same dimension. The input of the first fused filter
+ * becomes the input of the fused filter, which is found again at each
+ * update, so that the chain may be changed afterwards.
+ *
+ * \code
+ * cast->SetInput(reader->GetOutput());
+ * shiftScale->SetInput(cast->GetOutput());
+ * clamp->SetInput(shiftScale->GetOutput());
+ * threshold->SetInput(clamp->GetOutput());
+ *
+ * auto fused = FusedPixelwiseImageFilter<InputImageType, MaskImageType>::New();
+ * fused->SetLastFilter(threshold);
+ * fused->Update(); // same pixels as threshold->Update()
+ * \endcode
+ *
+ * The fused filter is modified when any filter of the chain is modified, or
+ * one of their other inputs, like the thresholds of
+ * BinaryThresholdImageFilter, so that it updates as the chain would. The
+ * fused filters are not executed: their outputs are left out of date, and
+ * computed as usual if they are updated themselves. The values computed by
+ * the filters, like the underflow count of ShiftScaleImageFilter, are
+ * updated by the fused filter.
+ *
+ * \sa PixelwiseFusionStage
+ * \ingroup IntensityImageFilters MultiThreaded
+ * \ingroup ITKImageFilterBase
+ */
+template <typename TInputImage, typename TOutputImage>
+class ITK_TEMPLATE_EXPORT FusedPixelwiseImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(FusedPixelwiseImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = FusedPixelwiseImageFilter;
+  using Superclass = InPlaceImageFilter<TInputImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(FusedPixelwiseImageFilter);
+
+  using InputImageType = TInputImage;
+  using InputImagePixelType = typename InputImageType::PixelType;
+  using OutputImageType = TOutputImage;
+  using OutputImagePixelType = typename OutputImageType::PixelType;
+  using OutputImageRegionType = typename OutputImageType::RegionType;
+
+  static_assert(PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>(),
+                "FusedPixelwiseImageFilter requires itk::Image types of the same dimension.");
+
+  /** Set/Get the last filter of the chain to fuse. Its output must be of
+   * type TOutputImage, and the input of the first fused filter of type
+   * TInputImage. */
+  itkSetObjectMacro(LastFilter, ProcessObject);
+  itkGetModifiableObjectMacro(LastFilter, ProcessObject);
+
+  /** Set/Get the number of pixels processed at once by each filter of the
+   * chain. Default is 4096. */
+  itkSetClampMacro(ChunkNumberOfPixels, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(ChunkNumberOfPixels, SizeValueType);
+
+  /** Get the number of filters fused by the last update. */
+  unsigned int
+  GetNumberOfFusedFilters() const
+  {
+    return static_cast<unsigned int>(m_Stages.size());
+  }
+
+  /** Finds the chain of fused filters, and connects the input of the first
+   * one to the input of this filter, before updating the information. */
+  void
+  UpdateOutputInformation() override;
+
+  /** The modification time takes into account the fused filters and their
+   * other inputs. */
+  ModifiedTimeType
+  GetMTime() const override;
+
+protected:
+  FusedPixelwiseImageFilter();
+  ~FusedPixelwiseImageFilter() override = default;
+
+  void
+  BeforeThreadedGenerateData() override;
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+
+  void
+  AfterThreadedGenerateData() override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Walks the pipeline upstream from LastFilter, and returns the input of
+   * the first fused filter. */
+  DataObject *
+  FindStages();
+
+  /** The inputs of the fused filters other than their primary input. */
+  std::vector<DataObject *>
+  GetStageSideInputs() const;
+
+  ProcessObject::Pointer m_LastFilter{};
+  SizeValueType          m_ChunkNumberOfPixels{ 4096 };
+
+  /** The fused filters, from the first one, and their interface. */
+  std::vector<ProcessObject::Pointer> m_Stages{};
+  std::vector<PixelwiseFusionStage *> m_StageInterfaces{};
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkFusedPixelwiseImageFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,235 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFusedPixelwiseImageFilter_hxx
+#define itkFusedPixelwiseImageFilter_hxx
+
+#include "itkImageScanlineIterator.h"
+#include "itkTotalProgressReporter.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::FusedPixelwiseImageFilter()
+{
+  this->SetNumberOfRequiredInputs(1);
+  this->InPlaceOff();
+  this->DynamicMultiThreadingOn();
+}
+
+template <typename TInputImage, typename TOutputImage>
+DataObject *
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::FindStages()
+{
+  m_Stages.clear();
+  m_StageInterfaces.clear();
+
+  if (!m_LastFilter)
+  {
+    itkExceptionMacro("LastFilter is not set.");
+  }
+  const ProcessObject::DataObjectPointerArray lastOutputs = m_LastFilter->GetOutputs();
+  if (lastOutputs.size() != 1 || dynamic_cast<OutputImageType *>(lastOutputs[0].GetPointer()) == nullptr)
+  {
+    itkExceptionMacro("The output of " << m_LastFilter->GetNameOfClass()
+                                       << " is not of the output image type of the fused filter.");
+  }
+
+  DataObject *           firstInput = nullptr;
+  ProcessObject::Pointer filter = m_LastFilter;
+  while (filter)
+  {
+    auto * stage = dynamic_cast<PixelwiseFusionStage *>(filter.GetPointer());
+    if (stage == nullptr || !stage->CanFusePixelwise())
+    {
+      break;
+    }
+    const ProcessObject::DataObjectPointerArray inputs = filter->GetIndexedInputs();
+    if (inputs.empty() || inputs[0] == nullptr)
+    {
+      break;
+    }
+    if (!m_StageInterfaces.empty() &&
+        stage->GetFusionOutputPixelSize() != m_StageInterfaces.front()->GetFusionInputPixelSize())
+    {
+      break;
+    }
+    m_Stages.insert(m_Stages.begin(), filter);
+    m_StageInterfaces.insert(m_StageInterfaces.begin(), stage);
+    firstInput = inputs[0];
+    filter = firstInput->GetSource();
+  }
+
+  if (m_Stages.empty())
+  {
+    itkExceptionMacro(<< m_LastFilter->GetNameOfClass() << " cannot be fused.");
+  }
+  return firstInput;
+}
+
+template <typename TInputImage, typename TOutputImage>
+std::vector<DataObject *>
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::GetStageSideInputs() const
+{
+  std::vector<DataObject *> sideInputs;
+  for (const ProcessObject::Pointer & stage : m_Stages)
+  {
+    const ProcessObject::DataObjectPointerArray indexedInputs = stage->GetIndexedInputs();
+    const DataObject * primaryInput = indexedInputs.empty() ? nullptr : indexedInputs[0].GetPointer();
+    for (const DataObject::Pointer & input : stage->GetInputs())
+    {
+      if (input && input != primaryInput)
+      {
+        sideInputs.push_back(input);
+      }
+    }
+  }
+  return sideInputs;
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::UpdateOutputInformation()
+{
+  const auto * input = dynamic_cast<const InputImageType *>(this->FindStages());
+  if (input == nullptr)
+  {
+    itkExceptionMacro("The input of " << m_Stages.front()->GetNameOfClass()
+                                      << " is not of the input image type of the fused filter.");
+  }
+  this->SetInput(input);
+
+  for (DataObject * sideInput : this->GetStageSideInputs())
+  {
+    sideInput->UpdateOutputInformation();
+  }
+
+  Superclass::UpdateOutputInformation();
+}
+
+template <typename TInputImage, typename TOutputImage>
+ModifiedTimeType
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::GetMTime() const
+{
+  ModifiedTimeType mtime = Superclass::GetMTime();
+  for (const ProcessObject::Pointer & stage : m_Stages)
+  {
+    mtime = std::max(mtime, stage->GetMTime());
+  }
+  for (const DataObject * sideInput : this->GetStageSideInputs())
+  {
+    mtime = std::max({ mtime, sideInput->GetMTime(), sideInput->GetPipelineMTime() });
+  }
+  return mtime;
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::BeforeThreadedGenerateData()
+{
+  // The other inputs of the fused filters, like the thresholds of
+  // BinaryThresholdImageFilter, are used by their preparation.
+  for (DataObject * sideInput : this->GetStageSideInputs())
+  {
+    if (sideInput->GetSource())
+    {
+      sideInput->Update();
+    }
+  }
+
+  for (PixelwiseFusionStage * stage : m_StageInterfaces)
+  {
+    stage->BeforeFusedTransformPixels();
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  const InputImageType * inputPtr = this->GetInput();
+  OutputImageType *      outputPtr = this->GetOutput();
+
+  TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
+
+  const size_t        numberOfStages = m_StageInterfaces.size();
+  const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+  const SizeValueType chunkLength = std::min(m_ChunkNumberOfPixels, lineLength);
+
+  // The intermediate chunks alternate between two buffers, which fit the
+  // largest intermediate pixel type.
+  size_t intermediatePixelSize = 0;
+  for (size_t i = 0; i + 1 < numberOfStages; ++i)
+  {
+    intermediatePixelSize = std::max(intermediatePixelSize, m_StageInterfaces[i]->GetFusionOutputPixelSize());
+  }
+  const size_t bufferLength =
+    (chunkLength * intermediatePixelSize + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+  std::vector<std::max_align_t> buffers[2] = { std::vector<std::max_align_t>(bufferLength),
+                                               std::vector<std::max_align_t>(numberOfStages > 2 ? bufferLength : 0) };
+
+  ImageScanlineIterator outputIt(outputPtr, outputRegionForThread);
+  while (!outputIt.IsAtEnd())
+  {
+    const typename OutputImageType::IndexType lineIndex = outputIt.GetIndex();
+    const InputImagePixelType * inputLine = inputPtr->GetBufferPointer() + inputPtr->ComputeOffset(lineIndex);
+    OutputImagePixelType *      outputLine = outputPtr->GetBufferPointer() + outputPtr->ComputeOffset(lineIndex);
+
+    for (SizeValueType first = 0; first < lineLength; first += chunkLength)
+    {
+      const SizeValueType numberOfPixels = std::min(chunkLength, lineLength - first);
+      const void *        stageInput = inputLine + first;
+      for (size_t i = 0; i < numberOfStages; ++i)
+      {
+        void * stageOutput = (i + 1 == numberOfStages) ? static_cast<void *>(outputLine + first)
+                                                       : static_cast<void *>(buffers[i % 2].data());
+        m_StageInterfaces[i]->FusedTransformPixels(stageInput, stageOutput, numberOfPixels);
+        stageInput = stageOutput;
+      }
+    }
+    outputIt.NextLine();
+    progress.Completed(lineLength);
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::AfterThreadedGenerateData()
+{
+  for (PixelwiseFusionStage * stage : m_StageInterfaces)
+  {
+    stage->AfterFusedTransformPixels();
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FusedPixelwiseImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(LastFilter);
+  os << indent << "ChunkNumberOfPixels: " << m_ChunkNumberOfPixels << std::endl;
+  os << indent << "NumberOfFusedFilters: " << m_Stages.size() << std::endl;
+}
+} // end namespace itk
+
+#endif
@@ -23,6 +23,7 @@
 #include "itkNeighborhoodInnerProduct.h"
 #include "itkImageRegionIterator.h"
 #include "itkConstNeighborhoodIterator.h"
+#include "itkConstInteriorNeighborhoodIterator.h"
 #include "itkTotalProgressReporter.h"
 
 namespace itk
@@ -101,12 +102,32 @@ NeighborhoodOperatorImageFilter<TInputImage, TOutputImage, TOperatorValueType>::
 
   // Process non-boundary region and each of the boundary faces.
   // These are N-d regions which border the edge of the buffer.
+  auto face = faceList.cbegin();
+  if constexpr (HasPixelArrayBuffer<InputImageType>)
+  {
+    // The first face is the non-boundary region, whose neighborhoods are read
+    // at precomputed offsets, without boundary condition.
+    if (face != faceList.cend())
+    {
+      ConstInteriorNeighborhoodIterator<InputImageType> nit(m_Operator.GetRadius(), input, *face);
+      it = ImageRegionIterator<OutputImageType>(output, *face);
+      while (!nit.IsAtEnd())
+      {
+        it.Value() = static_cast<typename OutputImageType::PixelType>(smartInnerProduct(nit, m_Operator));
+        ++nit;
+        ++it;
+        progress.CompletedPixel();
+      }
+      ++face;
+    }
+  }
+
   ConstNeighborhoodIterator<InputImageType> bit;
-  for (const auto & face : faceList)
+  for (; face != faceList.cend(); ++face)
   {
-    bit = ConstNeighborhoodIterator<InputImageType>(m_Operator.GetRadius(), input, face);
+    bit = ConstNeighborhoodIterator<InputImageType>(m_Operator.GetRadius(), input, *face);
     bit.OverrideBoundaryCondition(m_BoundsCondition);
-    it = ImageRegionIterator<OutputImageType>(output, face);
+    it = ImageRegionIterator<OutputImageType>(output, *face);
     bit.GoToBegin();
     while (!bit.IsAtEnd())
     {
@@ -35,10 +35,14 @@ namespace itk
  * to the neighborhood and calculating the standard deviation of the
  * residuals to this (hyper) plane.
  *
+ * The sums of the neighborhoods are computed by a SlidingWindowMoments, in
+ * constant time per pixel whatever the radius.
+ *
  * \sa Image
  * \sa Neighborhood
  * \sa NeighborhoodOperator
  * \sa NeighborhoodIterator
+ * \sa SlidingWindowMoments
  *
  * \ingroup IntensityImageFilters
  * \ingroup ITKImageFilterBase
@@ -18,11 +18,8 @@
 #ifndef itkNoiseImageFilter_hxx
 #define itkNoiseImageFilter_hxx
 
-#include "itkConstNeighborhoodIterator.h"
-#include "itkNeighborhoodInnerProduct.h"
-#include "itkImageRegionIterator.h"
-#include "itkNeighborhoodAlgorithm.h"
-#include "itkOffset.h"
+#include "itkImageScanlineIterator.h"
+#include "itkSlidingWindowMoments.h"
 #include "itkTotalProgressReporter.h"
 
 namespace itk
@@ -39,61 +36,25 @@ void
 NoiseImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   const OutputImageRegionType & outputRegionForThread)
 {
-  unsigned int i;
-
-  ZeroFluxNeumannBoundaryCondition<InputImageType> nbc;
-
-  ConstNeighborhoodIterator<InputImageType> bit;
-  ImageRegionIterator<OutputImageType>      it;
-
-  // Allocate output
-  typename OutputImageType::Pointer     output = this->GetOutput();
-  typename InputImageType::ConstPointer input = this->GetInput();
-
-  // Find the data-set boundary "faces"
-  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>                        bC;
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::FaceListType faceList =
-    bC(input, outputRegionForThread, this->GetRadius());
+  OutputImageType *      output = this->GetOutput();
+  const InputImageType * input = this->GetInput();
 
   TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
 
-  InputRealType value;
-  InputRealType sum;
-  InputRealType sumOfSquares;
-  InputRealType var;
-  InputRealType num;
+  // The sums of the neighborhoods, with a zero flux Neumann boundary
+  // condition, are updated from one pixel to the next, whatever the radius.
+  SlidingWindowMoments<InputImageType, InputRealType> moments;
+  moments.Compute(*input, outputRegionForThread, this->GetRadius(), true);
 
-  // Process each of the boundary faces.  These are N-d regions which border
-  // the edge of the buffer.
-  for (const auto & face : faceList)
+  // calculate the standard deviation value
+  SizeValueType i = 0;
+  for (ImageScanlineIterator<OutputImageType> it(output, outputRegionForThread); !it.IsAtEnd(); it.NextLine())
   {
-    bit = ConstNeighborhoodIterator<InputImageType>(this->GetRadius(), input, face);
-    unsigned int neighborhoodSize = bit.Size();
-    num = static_cast<InputRealType>(bit.Size());
-
-    it = ImageRegionIterator<OutputImageType>(output, face);
-    bit.OverrideBoundaryCondition(&nbc);
-    bit.GoToBegin();
-
-    while (!bit.IsAtEnd())
+    for (; !it.IsAtEndOfLine(); ++it, ++i)
     {
-      sum = InputRealType{};
-      sumOfSquares = InputRealType{};
-      for (i = 0; i < neighborhoodSize; ++i)
-      {
-        value = static_cast<InputRealType>(bit.GetPixel(i));
-        sum += value;
-        sumOfSquares += (value * value);
-      }
-
-      // calculate the standard deviation value
-      var = (sumOfSquares - (sum * sum / num)) / (num - 1.0);
-      it.Set(static_cast<OutputPixelType>(std::sqrt(var)));
-
-      ++bit;
-      ++it;
-      progress.CompletedPixel();
+      it.Set(static_cast<OutputPixelType>(std::sqrt(moments.GetVariance(i))));
     }
+    progress.Completed(outputRegionForThread.GetSize(0));
   }
 }
 } // end namespace itk
@@ -20,6 +20,8 @@
 
 #include "itkMath.h"
 #include "itkInPlaceImageFilter.h"
+#include "itkPixelwiseFusionStage.h"
+#include "itkSIMDPixelTransform.h"
 #include "itkImageRegionIteratorWithIndex.h"
 
 #include <functional>
@@ -52,7 +54,9 @@ namespace itk
  *
  */
 template <typename TInputImage, typename TOutputImage>
-class ITK_TEMPLATE_EXPORT UnaryGeneratorImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+class ITK_TEMPLATE_EXPORT UnaryGeneratorImageFilter
+  : public InPlaceImageFilter<TInputImage, TOutputImage>
+  , public PixelwiseFusionStage
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(UnaryGeneratorImageFilter);
@@ -94,6 +98,7 @@ public:
     m_DynamicThreadedGenerateDataFunction = [this, f](const OutputImageRegionType & outputRegionForThread) {
       return this->DynamicThreadedGenerateDataWithFunctor(f, outputRegionForThread);
     };
+    this->SetFusedTransformPixelsFunctor(f);
 
     this->Modified();
   }
@@ -103,6 +108,7 @@ public:
     m_DynamicThreadedGenerateDataFunction = [this, f](const OutputImageRegionType & outputRegionForThread) {
       return this->DynamicThreadedGenerateDataWithFunctor(f, outputRegionForThread);
     };
+    this->SetFusedTransformPixelsFunctor(f);
 
     this->Modified();
   }
@@ -118,6 +124,7 @@ public:
     m_DynamicThreadedGenerateDataFunction = [this, funcPointer](const OutputImageRegionType & outputRegionForThread) {
       return this->DynamicThreadedGenerateDataWithFunctor(funcPointer, outputRegionForThread);
     };
+    this->SetFusedTransformPixelsFunctor(funcPointer);
 
     this->Modified();
   }
@@ -127,6 +134,7 @@ public:
     m_DynamicThreadedGenerateDataFunction = [this, funcPointer](const OutputImageRegionType & outputRegionForThread) {
       return this->DynamicThreadedGenerateDataWithFunctor(funcPointer, outputRegionForThread);
     };
+    this->SetFusedTransformPixelsFunctor(funcPointer);
 
     this->Modified();
   }
@@ -146,11 +154,46 @@ public:
     m_DynamicThreadedGenerateDataFunction = [this, functor](const OutputImageRegionType & outputRegionForThread) {
       return this->DynamicThreadedGenerateDataWithFunctor(functor, outputRegionForThread);
     };
+    this->SetFusedTransformPixelsFunctor(functor);
 
     this->Modified();
   }
 #endif // !defined( ITK_WRAPPING_PARSER )
 
+  /** The functor may be fused with the neighboring filters by
+   * FusedPixelwiseImageFilter, for itk::Image inputs and outputs of the same
+   * dimension. \sa PixelwiseFusionStage */
+  bool
+  CanFusePixelwise() const override
+  {
+    return PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>() && m_FusedTransformPixelsFunction;
+  }
+  size_t
+  GetFusionInputPixelSize() const override
+  {
+    return sizeof(InputImagePixelType);
+  }
+  size_t
+  GetFusionOutputPixelSize() const override
+  {
+    return sizeof(OutputImagePixelType);
+  }
+  void
+  BeforeFusedTransformPixels() override
+  {
+    this->BeforeThreadedGenerateData();
+  }
+  void
+  FusedTransformPixels(const void * input, void * output, SizeValueType numberOfPixels) override
+  {
+    m_FusedTransformPixelsFunction(input, output, numberOfPixels);
+  }
+  void
+  AfterFusedTransformPixels() override
+  {
+    this->AfterThreadedGenerateData();
+  }
+
 protected:
   UnaryGeneratorImageFilter();
   ~UnaryGeneratorImageFilter() override = default;
@@ -184,7 +227,28 @@ protected:
   DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
+#if !defined(ITK_WRAPPING_PARSER)
+  template <typename TFunctor>
+  void
+  SetFusedTransformPixelsFunctor(const TFunctor & functor)
+  {
+    if constexpr (PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>())
+    {
+      m_FusedTransformPixelsFunction = [functor](const void * input, void * output, SizeValueType numberOfPixels) {
+        const auto * inputPixels = static_cast<const InputImagePixelType *>(input);
+        auto *       outputPixels = static_cast<OutputImagePixelType *>(output);
+        for (SizeValueType i = 0; i < numberOfPixels; ++i)
+        {
+          outputPixels[i] = functor(inputPixels[i]);
+        }
+      };
+    }
+  }
+#endif // !defined( ITK_WRAPPING_PARSER )
+
   std::function<void(const OutputImageRegionType &)> m_DynamicThreadedGenerateDataFunction{};
+
+  std::function<void(const void *, void *, SizeValueType)> m_FusedTransformPixelsFunction{};
 };
 } // end namespace itk
 
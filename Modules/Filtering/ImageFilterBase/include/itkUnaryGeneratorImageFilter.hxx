@@ -96,6 +96,32 @@ UnaryGeneratorImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDat
   ImageScanlineConstIterator inputIt(inputPtr, inputRegionForThread);
   ImageScanlineIterator      outputIt(outputPtr, outputRegionForThread);
 
+  if constexpr (Functor::IsSIMDVectorizable<TFunctor>::value && HasPixelArrayBuffer<TInputImage> &&
+                HasPixelArrayBuffer<TOutputImage> && TInputImage::ImageDimension == TOutputImage::ImageDimension)
+  {
+    // The lines of the images are arrays, to which the functor is applied
+    // with SIMD instructions, all at once when they follow each other.
+    if (IsContiguousInBuffer(inputRegionForThread, inputPtr->GetBufferedRegion()) &&
+        IsContiguousInBuffer(outputRegionForThread, outputPtr->GetBufferedRegion()))
+    {
+      const SizeValueType numberOfPixels = outputRegionForThread.GetNumberOfPixels();
+      SIMDTransformPixels(functor,
+                          inputPtr->GetBufferPointer() + inputPtr->ComputeOffset(inputRegionForThread.GetIndex()),
+                          outputPtr->GetBufferPointer() + outputPtr->ComputeOffset(outputRegionForThread.GetIndex()),
+                          numberOfPixels);
+      progress.Completed(numberOfPixels);
+      return;
+    }
+    while (!inputIt.IsAtEnd())
+    {
+      SIMDTransformPixels(functor, &inputIt.Value(), &outputIt.Value(), regionSize[0]);
+      progress.Completed(regionSize[0]);
+      inputIt.NextLine();
+      outputIt.NextLine();
+    }
+    return;
+  }
+
   while (!inputIt.IsAtEnd())
   {
     while (!inputIt.IsAtEndOfLine())
@@ -19,6 +19,7 @@
 #define itkGradientImageFilter_hxx
 
 #include "itkConstNeighborhoodIterator.h"
+#include "itkConstInteriorNeighborhoodIterator.h"
 #include "itkNeighborhoodInnerProduct.h"
 #include "itkImageRegionIterator.h"
 #include "itkDerivativeOperator.h"
@@ -155,10 +156,32 @@ GradientImageFilter<TInputImage, TOperatorValueType, TOutputValueType, TOutputIm
   CovariantVectorType gradient;
   // Process non-boundary face and then each of the boundary faces.
   // These are N-d regions which border the edge of the buffer.
-  for (const auto & face : faceList)
+  auto face = faceList.cbegin();
+  if constexpr (HasPixelArrayBuffer<InputImageType>)
   {
-    nit = ConstNeighborhoodIterator<InputImageType>(radius, inputImage, face);
-    ImageRegionIterator<OutputImageType> it(outputImage, face);
+    // The neighborhoods of the non-boundary face are read at precomputed
+    // offsets, without boundary condition.
+    ConstInteriorNeighborhoodIterator<InputImageType> interiorIt(radius, inputImage, *face);
+    ImageRegionIterator<OutputImageType>              it(outputImage, *face);
+    while (!interiorIt.IsAtEnd())
+    {
+      for (unsigned int i = 0; i < InputImageDimension; ++i)
+      {
+        gradient[i] = SIP(x_slice[i], interiorIt, op[i]);
+      }
+      this->SetOutputPixel(it, gradient);
+
+      ++interiorIt;
+      ++it;
+      progress.CompletedPixel();
+    }
+    ++face;
+  }
+
+  for (; face != faceList.cend(); ++face)
+  {
+    nit = ConstNeighborhoodIterator<InputImageType>(radius, inputImage, *face);
+    ImageRegionIterator<OutputImageType> it(outputImage, *face);
     nit.OverrideBoundaryCondition(m_BoundaryCondition.get());
     nit.GoToBegin();
 
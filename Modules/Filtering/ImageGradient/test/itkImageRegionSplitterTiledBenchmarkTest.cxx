@@ -0,0 +1,125 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkDiscreteGaussianImageFilter.h"
+#include "itkGradientMagnitudeImageFilter.h"
+#include "itkImageBufferRange.h"
+#include "itkImageRegionSplitterTiled.h"
+#include "itkMedianImageFilter.h"
+#include "itkRandomImageSource.h"
+#include "itkTimeProbesCollectorBase.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+// Compares the throughput of MedianImageFilter, DiscreteGaussianImageFilter and
+// GradientMagnitudeImageFilter with the default slab splitting of the output
+// region and with the cache sized tiles of ImageRegionSplitterTiled, and checks
+// that the splitting does not change the results.
+//
+// Usage: itkImageRegionSplitterTiledBenchmarkTest imageSize [numberOfIterations]
+// The images are cubes of imageSize^3 float pixels.
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// Runs the filter with the default splitter, then with the tiled one.
+bool
+Benchmark(itk::ImageToImageFilter<ImageType, ImageType> * filter,
+          const std::string &                             name,
+          unsigned int                                    numberOfIterations,
+          itk::TimeProbesCollectorBase &                  timeProbes)
+{
+  ImageType::Pointer reference;
+  for (const bool tiled : { false, true })
+  {
+    const std::string probeName = name + (tiled ? " Tiled" : " Default");
+    filter->GetMultiThreader()->SetImageRegionSplitter(tiled ? itk::ImageRegionSplitterTiled::New() : nullptr);
+    for (unsigned int i = 0; i < numberOfIterations; ++i)
+    {
+      // Modified() makes the filter compute its output again.
+      filter->Modified();
+      timeProbes.Start(probeName.c_str());
+      filter->Update();
+      timeProbes.Stop(probeName.c_str());
+    }
+    if (!tiled)
+    {
+      reference = filter->GetOutput();
+      reference->DisconnectPipeline();
+    }
+  }
+
+  const itk::ImageBufferRange<const ImageType> range(*filter->GetOutput());
+  const itk::ImageBufferRange<const ImageType> referenceRange(*reference);
+  if (!std::equal(range.cbegin(), range.cend(), referenceRange.cbegin(), referenceRange.cend()))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The output of " << name << " differs with the tiled splitter." << std::endl;
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int
+itkImageRegionSplitterTiledBenchmarkTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " imageSize [numberOfIterations]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto         imageSize = static_cast<itk::SizeValueType>(std::stoul(argv[1]));
+  const unsigned int numberOfIterations = (argc > 2) ? std::stoul(argv[2]) : 5;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  source->SetSize(ImageType::SizeType::Filled(imageSize));
+  source->SetMin(0.0);
+  source->SetMax(1000.0);
+  ITK_TRY_EXPECT_NO_EXCEPTION(source->Update());
+
+  auto median = itk::MedianImageFilter<ImageType, ImageType>::New();
+  median->SetInput(source->GetOutput());
+  median->SetRadius(1);
+
+  auto gaussian = itk::DiscreteGaussianImageFilter<ImageType, ImageType>::New();
+  gaussian->SetInput(source->GetOutput());
+  gaussian->SetVariance(4.0);
+
+  auto gradientMagnitude = itk::GradientMagnitudeImageFilter<ImageType, ImageType>::New();
+  gradientMagnitude->SetInput(source->GetOutput());
+
+  itk::TimeProbesCollectorBase timeProbes;
+  bool                         success = true;
+
+  success &= Benchmark(median, "Median", numberOfIterations, timeProbes);
+  success &= Benchmark(gaussian, "DiscreteGaussian", numberOfIterations, timeProbes);
+  success &= Benchmark(gradientMagnitude, "GradientMagnitude", numberOfIterations, timeProbes);
+
+  timeProbes.Report(std::cout);
+
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -27,6 +27,7 @@
 #include "itkSize.h"
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkDataObjectDecorator.h"
+#include <vector>
 
 
 namespace itk
@@ -69,6 +70,21 @@ namespace itk
  * ProcessObject::GenerateInputRequestedRegion() and
  * ProcessObject::GenerateOutputInformation().
  *
+ * When the transform is linear and maps each axis of the output index
+ * grid onto the same axis of the input index grid, as a ScaleTransform or
+ * a TranslationTransform does between images of the same direction, and
+ * the IsInsideBufferSeparable() of the interpolator is true, the input is
+ * interpolated at the points of a grid, with the
+ * EvaluateAtContinuousIndexGrid() of the interpolator. The linear, B-spline
+ * and windowed sinc interpolators then interpolate along one axis at a time.
+ *
+ * When the same transform resamples many images, as a CompositeTransform of
+ * an affine, a BSplineTransform and a DisplacementFieldTransform mapping an
+ * atlas onto each of its channels, CacheTransformedPointsOn() bakes the
+ * transform into the points it maps the output pixels to, which are kept
+ * for the next updates while neither the transform nor the output grid
+ * changes. Each output pixel then goes through the transform only once.
+ *
  * This filter is implemented as a multithreaded filter.  It provides a
  * DynamicThreadedGenerateData() method for its implementation.
  * \warning For multithreading, the TransformPoint method of the
@@ -270,6 +286,29 @@ public:
   itkBooleanMacro(UseReferenceImage);
   itkGetConstMacro(UseReferenceImage, bool);
 
+  /** Turn on/off the caching of the points to which a transform which is not
+   *  linear maps the pixels of the largest possible output region. The cached
+   *  points are computed again when the output grid changes, or when the
+   *  transform or one of the sub transforms of a MultiTransform is modified.
+   *  They take a point per output pixel. The default is off. */
+  itkSetMacro(CacheTransformedPoints, bool);
+  itkBooleanMacro(CacheTransformedPoints);
+  itkGetConstMacro(CacheTransformedPoints, bool);
+
+  /** Turn on/off the sharing of the B-spline coefficients of the input image.
+   *  When on, and the interpolator is a BSplineInterpolateImageFunction of
+   *  the input image type and TInterpolatorPrecisionType, with double
+   *  coefficients, the filter has it take the coefficients from the cache
+   *  during each update, without changing its UseCoefficientImageCache flag,
+   *  so that the filters and interpolators which resample the same image
+   *  decompose it only once. The BSplineCoefficientImageCache keeps a
+   *  coefficient image, of a double per pixel, until the input image is
+   *  deleted or modified. The default is off.
+   *  \sa BSplineCoefficientImageCache */
+  itkSetMacro(UseCoefficientImageCache, bool);
+  itkBooleanMacro(UseCoefficientImageCache);
+  itkGetConstMacro(UseCoefficientImageCache, bool);
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(OutputHasNumericTraitsCheck, (Concept::HasNumericTraits<PixelComponentType>));
@@ -344,6 +383,18 @@ protected:
   virtual void
   LinearThreadedGenerateData(const OutputImageRegionType & outputRegionForThread);
 
+  /** Implementation for resampling with linear transformation types which
+   *  map each axis of the output index grid onto the same axis of the input
+   *  index grid. */
+  virtual void
+  SeparableThreadedGenerateData(const OutputImageRegionType & outputRegionForThread);
+
+  /** Whether the linear transformation maps each axis of the output index
+   *  grid onto the same axis of the input index grid, within a millionth of
+   *  an input pixel over the largest possible output region. */
+  bool
+  IsIndexMappingSeparable() const;
+
   /** Cast pixel from interpolator output to PixelType. */
   itkLegacyMacro(virtual PixelType CastPixelWithBoundsChecking(const InterpolatorOutputType value,
                                                                const ComponentType          minComponent,
@@ -367,6 +418,20 @@ private:
   void
   InitializeTransform();
 
+  /** Computes the points to which the transform maps the pixels of the
+   * largest possible output region, unless they are cached already. */
+  void
+  UpdateTransformedPoints();
+
+  /** The latest modification time of the transform and of its sub
+   * transforms. */
+  static ModifiedTimeType
+  GetTransformMTime(const TransformType & transform);
+
+  /** The offset of the cached point of an output pixel. */
+  SizeValueType
+  ComputeTransformedPointOffset(const IndexType & index) const;
+
   SizeType                m_Size{};         // Size of the output image
   InterpolatorPointerType m_Interpolator{}; // Image function for
                                             // interpolation
@@ -380,6 +445,19 @@ private:
   DirectionType   m_OutputDirection{};      // output image direction cosines
   IndexType       m_OutputStartIndex{};     // output image start index
   bool            m_UseReferenceImage{ false };
+  bool            m_UseCoefficientImageCache{ false };
+
+  bool                        m_CacheTransformedPoints{ false };
+  bool                        m_UseTransformedPoints{ false };
+  std::vector<InputPointType> m_TransformedPoints{};
+
+  // The transform and output grid of the cached points.
+  const TransformType * m_TransformedPointsTransform{ nullptr };
+  ModifiedTimeType      m_TransformedPointsTransformMTime{ 0 };
+  OutputImageRegionType m_TransformedPointsRegion{};
+  SpacingType           m_TransformedPointsSpacing{};
+  OriginPointType       m_TransformedPointsOrigin{};
+  DirectionType         m_TransformedPointsDirection{};
 };
 } // end namespace itk
 
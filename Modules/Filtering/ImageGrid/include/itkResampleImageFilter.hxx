@@ -26,9 +26,15 @@
 #include "itkSpecialCoordinatesImage.h"
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkImageAlgorithm.h"
+#include "itkIndexRange.h"
+#include "itkMultiTransform.h"
+#include "itkBSplineInterpolateImageFunction.h"
 
 #include <algorithm>   // For max.
-#include <type_traits> // For is_same.
+#include <array>
+#include <cmath>
+#include <type_traits> // For is_same and is_arithmetic.
+#include <vector>
 
 namespace itk
 {
@@ -163,7 +169,27 @@ void
 ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
   BeforeThreadedGenerateData()
 {
-  m_Interpolator->SetInputImage(this->GetInput());
+  bool interpolatorInputIsSet = false;
+  if constexpr (std::is_arithmetic_v<InputPixelType>)
+  {
+    using BSplineInterpolatorType = BSplineInterpolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
+    auto * const bSplineInterpolator = dynamic_cast<BSplineInterpolatorType *>(m_Interpolator.GetPointer());
+    if (m_UseCoefficientImageCache && bSplineInterpolator != nullptr &&
+        !bSplineInterpolator->GetUseCoefficientImageCache())
+    {
+      // Take the coefficients from the cache for this update only, leaving
+      // the flag of the interpolator as its user set it.
+      bSplineInterpolator->UseCoefficientImageCacheOn();
+      bSplineInterpolator->SetInputImage(this->GetInput());
+      bSplineInterpolator->UseCoefficientImageCacheOff();
+      interpolatorInputIsSet = true;
+    }
+  }
+
+  if (!interpolatorInputIsSet)
+  {
+    m_Interpolator->SetInputImage(this->GetInput());
+  }
 
   // Connect input image to extrapolator
   if (!m_Extrapolator.IsNull())
@@ -184,6 +210,105 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
       PixelConvertType::SetNthComponent(n, m_DefaultPixelValue, zeroComponent);
     }
   }
+
+  using InputSpecialCoordinatesImageType = SpecialCoordinatesImage<InputPixelType, InputImageDimension>;
+  using OutputSpecialCoordinatesImageType = SpecialCoordinatesImage<PixelType, OutputImageDimension>;
+  m_UseTransformedPoints =
+    m_CacheTransformedPoints &&
+    this->GetTransform()->GetTransformCategory() != TransformType::TransformCategoryEnum::Linear &&
+    dynamic_cast<const InputSpecialCoordinatesImageType *>(this->GetInput()) == nullptr &&
+    dynamic_cast<const OutputSpecialCoordinatesImageType *>(this->GetOutput()) == nullptr;
+  if (m_UseTransformedPoints)
+  {
+    this->UpdateTransformedPoints();
+  }
+  else if (!m_CacheTransformedPoints)
+  {
+    // Release the points cached before the cache was turned off.
+    m_TransformedPoints = std::vector<InputPointType>();
+    m_TransformedPointsTransform = nullptr;
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  UpdateTransformedPoints()
+{
+  const OutputImageType * const outputPtr = this->GetOutput();
+  const TransformType * const   transformPtr = this->GetTransform();
+  const OutputImageRegionType & largestPossibleRegion = outputPtr->GetLargestPossibleRegion();
+  const ModifiedTimeType        transformMTime = Self::GetTransformMTime(*transformPtr);
+
+  if (transformPtr == m_TransformedPointsTransform && transformMTime == m_TransformedPointsTransformMTime &&
+      largestPossibleRegion == m_TransformedPointsRegion && outputPtr->GetSpacing() == m_TransformedPointsSpacing &&
+      outputPtr->GetOrigin() == m_TransformedPointsOrigin && outputPtr->GetDirection() == m_TransformedPointsDirection)
+  {
+    return;
+  }
+
+  m_TransformedPointsTransform = transformPtr;
+  m_TransformedPointsTransformMTime = transformMTime;
+  m_TransformedPointsRegion = largestPossibleRegion;
+  m_TransformedPointsSpacing = outputPtr->GetSpacing();
+  m_TransformedPointsOrigin = outputPtr->GetOrigin();
+  m_TransformedPointsDirection = outputPtr->GetDirection();
+  m_TransformedPoints.resize(largestPossibleRegion.GetNumberOfPixels());
+
+  this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+    largestPossibleRegion,
+    [this, outputPtr, transformPtr](const OutputImageRegionType & region) {
+      for (const IndexType & index : ImageRegionIndexRange<OutputImageDimension>(region))
+      {
+        m_TransformedPoints[this->ComputeTransformedPointOffset(index)] =
+          transformPtr->TransformPoint(outputPtr->template TransformIndexToPhysicalPoint<double>(index));
+      }
+    },
+    nullptr);
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+ModifiedTimeType
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::GetTransformMTime(
+  const TransformType & transform)
+{
+  ModifiedTimeType latestTime = transform.GetMTime();
+
+  if constexpr (InputImageDimension == OutputImageDimension)
+  {
+    using MultiTransformType = MultiTransform<TTransformPrecisionType, OutputImageDimension, OutputImageDimension>;
+    if (const auto * const multiTransform = dynamic_cast<const MultiTransformType *>(&transform))
+    {
+      for (SizeValueType n = 0; n < multiTransform->GetNumberOfTransforms(); ++n)
+      {
+        latestTime = std::max(latestTime, Self::GetTransformMTime(*multiTransform->GetNthTransformConstPointer(n)));
+      }
+    }
+  }
+  return latestTime;
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+SizeValueType
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  ComputeTransformedPointOffset(const IndexType & index) const
+{
+  SizeValueType offset = 0;
+  for (unsigned int dim = OutputImageDimension; dim > 0; --dim)
+  {
+    offset = offset * m_TransformedPointsRegion.GetSize(dim - 1) +
+             static_cast<SizeValueType>(index[dim - 1] - m_TransformedPointsRegion.GetIndex(dim - 1));
+  }
+  return offset;
 }
 
 template <typename TInputImage,
@@ -233,6 +358,11 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
   if (!isSpecialCoordinatesImage &&
       this->GetTransform()->GetTransformCategory() == TransformType::TransformCategoryEnum::Linear)
   {
+    if (m_Interpolator->IsInsideBufferSeparable() && this->IsIndexMappingSeparable())
+    {
+      this->SeparableThreadedGenerateData(outputRegionForThread);
+      return;
+    }
     this->LinearThreadedGenerateData(outputRegionForThread);
     return;
   }
@@ -391,11 +521,18 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
   {
     // Determine the index of the current output pixel
 
-    OutputPointType outputPoint; // Coordinates of current output pixel
-    outputPtr->TransformIndexToPhysicalPoint(outIt.GetIndex(), outputPoint);
-
-    // Compute corresponding input pixel position
-    const InputPointType inputPoint = transformPtr->TransformPoint(outputPoint);
+    // Compute corresponding input pixel position, or take it from the cache
+    InputPointType inputPoint;
+    if (m_UseTransformedPoints)
+    {
+      inputPoint = m_TransformedPoints[this->ComputeTransformedPointOffset(outIt.GetIndex())];
+    }
+    else
+    {
+      OutputPointType outputPoint; // Coordinates of current output pixel
+      outputPtr->TransformIndexToPhysicalPoint(outIt.GetIndex(), outputPoint);
+      inputPoint = transformPtr->TransformPoint(outputPoint);
+    }
 
     ContinuousInputIndexType inputIndex;
     const bool               isInsideInput = inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
@@ -463,6 +600,13 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
       transformPtr->TransformPoint(outputPtr->template TransformIndexToPhysicalPoint<double>(index)));
   };
 
+  // The pixels of a scan line which map inside the buffer of the interpolator
+  // are interpolated in a single call, which shares its setup among them.
+  const SizeValueType                   lineLength = outputRegionForThread.GetSize(0);
+  std::vector<ContinuousInputIndexType> insideIndices(lineLength);
+  std::vector<InterpolatorOutputType>   insideValues(lineLength);
+  std::vector<bool>                     isInside(lineLength);
+
   // Create an iterator that will walk the output region for this thread.
   for (ImageScanlineIterator outIt(outputPtr, outputRegionForThread); !outIt.IsAtEnd(); outIt.NextLine())
   {
@@ -476,13 +620,10 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
     index[0] += firstSizeValueOfLargestPossibleRegion;
     const auto vectorFromStartIndex = transformIndex(index) - startIndex;
 
-    IndexValueType scanlineIndex = outIt.GetIndex()[0];
-
+    const IndexValueType firstScanlineIndex = outIt.GetIndex()[0];
 
-    while (!outIt.IsAtEndOfLine())
-    {
-
-      // Perform linear interpolation from startIndex, along vectorFromStartIndex
+    // Perform linear interpolation from startIndex, along vectorFromStartIndex
+    const auto computeInputIndex = [&](const IndexValueType scanlineIndex) {
       const double alpha =
         (scanlineIndex - firstIndexValueOfLargestPossibleRegion) / firstSizeValueOfLargestPossibleRegion;
 
@@ -491,11 +632,30 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
       {
         inputIndex[i] += alpha * vectorFromStartIndex[i];
       }
+      return inputIndex;
+    };
 
-      // Evaluate input at right position and copy to the output
-      if (m_Interpolator->IsInsideBuffer(inputIndex))
+    SizeValueType numberOfInsideIndices = 0;
+    for (SizeValueType x = 0; x < lineLength; ++x)
+    {
+      const ContinuousInputIndexType inputIndex = computeInputIndex(firstScanlineIndex + x);
+      isInside[x] = m_Interpolator->IsInsideBuffer(inputIndex);
+      if (isInside[x])
       {
-        outIt.Set(Self::CastPixelWithBoundsChecking(m_Interpolator->EvaluateAtContinuousIndex(inputIndex)));
+        insideIndices[numberOfInsideIndices] = inputIndex;
+        ++numberOfInsideIndices;
+      }
+    }
+    m_Interpolator->EvaluateAtContinuousIndices(insideIndices.data(), insideValues.data(), numberOfInsideIndices);
+
+    // Copy the values to the output
+    SizeValueType insideValueIndex = 0;
+    for (SizeValueType x = 0; x < lineLength; ++x, ++outIt)
+    {
+      if (isInside[x])
+      {
+        outIt.Set(Self::CastPixelWithBoundsChecking(insideValues[insideValueIndex]));
+        ++insideValueIndex;
       }
       else
       {
@@ -505,17 +665,236 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
         }
         else
         {
-          outIt.Set(Self::CastPixelWithBoundsChecking(m_Extrapolator->EvaluateAtContinuousIndex(inputIndex)));
+          outIt.Set(Self::CastPixelWithBoundsChecking(
+            m_Extrapolator->EvaluateAtContinuousIndex(computeInputIndex(firstScanlineIndex + x))));
         }
       }
-
-      ++outIt;
-      ++scanlineIndex;
     }
     progress.Completed(outputRegionForThread.GetSize()[0]);
   }
 }
 
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+bool
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  IsIndexMappingSeparable() const
+{
+  if constexpr (InputImageDimension != OutputImageDimension)
+  {
+    return false;
+  }
+  else
+  {
+    const OutputImageType * outputPtr = this->GetOutput();
+    const InputImageType *  inputPtr = this->GetInput();
+    const TransformType *   transformPtr = this->GetTransform();
+
+    const auto transformIndex = [outputPtr, transformPtr, inputPtr](const IndexType & index) {
+      return inputPtr->template TransformPhysicalPointToContinuousIndex<TInterpolatorPrecisionType>(
+        transformPtr->TransformPoint(outputPtr->template TransformIndexToPhysicalPoint<double>(index)));
+    };
+
+    // The vectors along each axis of the largest possible region, mapped to the
+    // input index grid, must be along the same axis.
+    const OutputImageRegionType &  largestPossibleRegion = outputPtr->GetLargestPossibleRegion();
+    const ContinuousInputIndexType startIndex = transformIndex(largestPossibleRegion.GetIndex());
+    for (unsigned int dim = 0; dim < OutputImageDimension; ++dim)
+    {
+      IndexType index = largestPossibleRegion.GetIndex();
+      index[dim] += static_cast<IndexValueType>(largestPossibleRegion.GetSize(dim));
+      const auto vectorAlongAxis = transformIndex(index) - startIndex;
+      for (unsigned int i = 0; i < InputImageDimension; ++i)
+      {
+        if (i != dim && !(std::abs(vectorAlongAxis[i]) <= 1e-6))
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  SeparableThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  if constexpr (InputImageDimension != OutputImageDimension)
+  {
+    this->LinearThreadedGenerateData(outputRegionForThread);
+  }
+  else
+  {
+    OutputImageType *      outputPtr = this->GetOutput();
+    const InputImageType * inputPtr = this->GetInput();
+    const TransformType *  transformPtr = this->GetTransform();
+
+    TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
+
+    const OutputImageRegionType & largestPossibleRegion = outputPtr->GetLargestPossibleRegion();
+    const IndexType &             outputStart = outputRegionForThread.GetIndex();
+    const SizeType &              outputSize = outputRegionForThread.GetSize();
+
+    // Cache information from the superclass
+    PixelType defaultValue = this->GetDefaultPixelValue();
+
+    const auto transformIndex = [outputPtr, transformPtr, inputPtr](const IndexType & index) {
+      return inputPtr->template TransformPhysicalPointToContinuousIndex<TInterpolatorPrecisionType>(
+        transformPtr->TransformPoint(outputPtr->template TransformIndexToPhysicalPoint<double>(index)));
+    };
+
+    // The coordinates of the output region along each axis, in the input index
+    // grid, as in LinearThreadedGenerateData(): along the first axis, they are
+    // interpolated along the scan line of the largest possible region, and
+    // along the other axes, they are the ones of the start of the scan line.
+    IndexType lineStartIndex = outputStart;
+    lineStartIndex[0] = largestPossibleRegion.GetIndex(0);
+    const ContinuousInputIndexType startIndex = transformIndex(lineStartIndex);
+    IndexType                      lineEndIndex = lineStartIndex;
+    lineEndIndex[0] += static_cast<IndexValueType>(largestPossibleRegion.GetSize(0));
+    const TInterpolatorPrecisionType vectorAlongLine = transformIndex(lineEndIndex)[0] - startIndex[0];
+
+    std::array<std::vector<TInterpolatorPrecisionType>, OutputImageDimension> coordinates;
+    for (unsigned int dim = 0; dim < OutputImageDimension; ++dim)
+    {
+      coordinates[dim].resize(outputSize[dim]);
+      for (SizeValueType i = 0; i < outputSize[dim]; ++i)
+      {
+        if (dim == 0)
+        {
+          const double alpha = (outputStart[0] + static_cast<IndexValueType>(i) - lineStartIndex[0]) /
+                               static_cast<double>(largestPossibleRegion.GetSize(0));
+          coordinates[0][i] = startIndex[0] + alpha * vectorAlongLine;
+        }
+        else
+        {
+          IndexType index = lineStartIndex;
+          index[dim] += static_cast<IndexValueType>(i);
+          coordinates[dim][i] = transformIndex(index)[dim];
+        }
+      }
+    }
+
+    // The position of each coordinate among the coordinates of the grid which
+    // are inside the buffer of the interpolator, or -1 when it is outside.
+    const auto & startContinuousIndex = m_Interpolator->GetStartContinuousIndex();
+    const auto & endContinuousIndex = m_Interpolator->GetEndContinuousIndex();
+    typename InterpolatorType::GridCoordinatesType                 gridCoordinates;
+    std::array<std::vector<IndexValueType>, OutputImageDimension> gridPositions;
+    const auto addToGrid = [&](const unsigned int dim, const SizeValueType i) {
+      const TInterpolatorPrecisionType coordinate = coordinates[dim][i];
+      if (coordinate >= startContinuousIndex[dim] && coordinate < endContinuousIndex[dim])
+      {
+        gridPositions[dim][i] = static_cast<IndexValueType>(gridCoordinates[dim].size());
+        gridCoordinates[dim].push_back(coordinate);
+      }
+      else
+      {
+        gridPositions[dim][i] = -1;
+      }
+    };
+    for (unsigned int dim = 0; dim < OutputImageDimension; ++dim)
+    {
+      gridPositions[dim].resize(outputSize[dim]);
+      for (SizeValueType i = 0; dim + 1 < OutputImageDimension && i < outputSize[dim]; ++i)
+      {
+        addToGrid(dim, i);
+      }
+    }
+
+    // The output region is resampled in chunks of slices along the last axis,
+    // which bound the memory of the grid.
+    constexpr unsigned int  lastAxis = OutputImageDimension - 1;
+    constexpr SizeValueType maximumNumberOfPixelsPerChunk = SizeValueType{ 1 } << 18;
+    const SizeValueType     numberOfPixelsPerSlice = outputRegionForThread.GetNumberOfPixels() / outputSize[lastAxis];
+    const SizeValueType     numberOfSlicesPerChunk =
+      std::max(SizeValueType{ 1 }, maximumNumberOfPixelsPerChunk / numberOfPixelsPerSlice);
+
+    std::vector<InterpolatorOutputType> values;
+    for (SizeValueType firstSlice = 0; firstSlice < outputSize[lastAxis]; firstSlice += numberOfSlicesPerChunk)
+    {
+      const SizeValueType numberOfSlices = std::min(numberOfSlicesPerChunk, outputSize[lastAxis] - firstSlice);
+      gridCoordinates[lastAxis].clear();
+      for (SizeValueType i = firstSlice; i < firstSlice + numberOfSlices; ++i)
+      {
+        addToGrid(lastAxis, i);
+      }
+
+      SizeValueType numberOfGridPoints = 1;
+      for (unsigned int dim = 0; dim < OutputImageDimension; ++dim)
+      {
+        numberOfGridPoints *= gridCoordinates[dim].size();
+      }
+      values.resize(numberOfGridPoints);
+      if (numberOfGridPoints > 0)
+      {
+        m_Interpolator->EvaluateAtContinuousIndexGrid(gridCoordinates, values.data());
+      }
+
+      OutputImageRegionType chunkRegion = outputRegionForThread;
+      chunkRegion.SetIndex(lastAxis, outputStart[lastAxis] + static_cast<IndexValueType>(firstSlice));
+      chunkRegion.SetSize(lastAxis, numberOfSlices);
+      for (ImageScanlineIterator outIt(outputPtr, chunkRegion); !outIt.IsAtEnd(); outIt.NextLine())
+      {
+        // The offset of the values of the scan line in the grid, or -1 when the
+        // scan line is outside.
+        const IndexType lineIndex = outIt.GetIndex();
+        IndexValueType  lineOffset = 0;
+        SizeValueType   stride = gridCoordinates[0].size();
+        for (unsigned int dim = 1; dim < OutputImageDimension && lineOffset >= 0; ++dim)
+        {
+          const IndexValueType position = gridPositions[dim][lineIndex[dim] - outputStart[dim]];
+          lineOffset = (position >= 0) ? lineOffset + position * static_cast<IndexValueType>(stride) : -1;
+          stride *= gridCoordinates[dim].size();
+        }
+
+        ContinuousInputIndexType inputIndex;
+        for (unsigned int dim = 1; dim < OutputImageDimension; ++dim)
+        {
+          inputIndex[dim] = coordinates[dim][lineIndex[dim] - outputStart[dim]];
+        }
+
+        // Copy the values to the output. The scan lines of a chunk span the
+        // output region along the first axis, unless it is the last one. The
+        // points are inside or outside as IsInsideBuffer() tells, and those
+        // which are inside but not on the grid are interpolated one by one.
+        const SizeValueType firstX = static_cast<SizeValueType>(chunkRegion.GetIndex(0) - outputStart[0]);
+        const SizeValueType endX = firstX + chunkRegion.GetSize(0);
+        for (SizeValueType x = firstX; x < endX; ++x, ++outIt)
+        {
+          inputIndex[0] = coordinates[0][x];
+          const IndexValueType position = gridPositions[0][x];
+          if (m_Interpolator->IsInsideBuffer(inputIndex))
+          {
+            outIt.Set(Self::CastPixelWithBoundsChecking((lineOffset >= 0 && position >= 0)
+                                                          ? values[lineOffset + position]
+                                                          : m_Interpolator->EvaluateAtContinuousIndex(inputIndex)));
+          }
+          else
+          {
+            if (m_Extrapolator.IsNull())
+            {
+              outIt.Set(defaultValue); // default background value
+            }
+            else
+            {
+              outIt.Set(Self::CastPixelWithBoundsChecking(m_Extrapolator->EvaluateAtContinuousIndex(inputIndex)));
+            }
+          }
+        }
+        progress.Completed(chunkRegion.GetSize(0));
+      }
+    }
+  }
+}
+
 template <typename TInputImage,
           typename TOutputImage,
           typename TInterpolatorPrecisionType,
@@ -672,6 +1051,8 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
   os << indent << "Interpolator: " << m_Interpolator.GetPointer() << std::endl;
   os << indent << "Extrapolator: " << m_Extrapolator.GetPointer() << std::endl;
   os << indent << "UseReferenceImage: " << (m_UseReferenceImage ? "On" : "Off") << std::endl;
+  os << indent << "CacheTransformedPoints: " << (m_CacheTransformedPoints ? "On" : "Off") << std::endl;
+  os << indent << "UseCoefficientImageCache: " << (m_UseCoefficientImageCache ? "On" : "Off") << std::endl;
 }
 } // end namespace itk
 
@@ -19,14 +19,29 @@
 // The header file to be tested:
 #include "itkResampleImageFilter.h"
 
+#include "itkBSplineCoefficientImageCache.h"
+#include "itkBSplineInterpolateImageFunction.h"
+#include "itkBSplineTransform.h"
+#include "itkCompositeTransform.h"
 #include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkIndexRange.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkNearestNeighborExtrapolateImageFunction.h"
+#include "itkNearestNeighborInterpolateImageFunction.h"
+#include "itkScaleTransform.h"
+#include "itkTranslationTransform.h"
+#include "itkWindowedSincInterpolateImageFunction.h"
 
 // Google Test header file:
 #include <gtest/gtest.h>
 
 // Standard C++ header files:
+#include <cmath>
 #include <limits>
 #include <random>
+#include <vector>
 
 
 namespace
@@ -111,6 +126,173 @@ Expect_ResampleImageFilter_thows_on_incomplete_configuration(const TPixel inputP
   EXPECT_EQ(TestThrowErrorOnEmptyResampleSpace(inputPixel, true), inputPixel);
 }
 
+
+// Tests that the output pixels of a ResampleImageFilter, whose transform maps each axis of
+// the output index grid onto the same axis of the input index grid, are the values of the
+// interpolator at the mapped indices, or the default pixel value outside the input.
+template <typename TImage>
+void
+Expect_ResampleImageFilter_interpolates_at_the_mapped_indices(
+  const typename itk::ResampleImageFilter<TImage, TImage>::TransformType &   transform,
+  typename itk::ResampleImageFilter<TImage, TImage>::InterpolatorType &      interpolator,
+  typename itk::ResampleImageFilter<TImage, TImage>::ExtrapolatorType * const extrapolator)
+{
+  using FilterType = itk::ResampleImageFilter<TImage, TImage>;
+  constexpr unsigned int Dimension = TImage::ImageDimension;
+
+  const auto image = TImage::New();
+  image->SetRegions(typename TImage::RegionType(TImage::IndexType::Filled(-3), TImage::SizeType::Filled(9)));
+  image->SetOrigin(itk::MakeFilled<typename TImage::PointType>(0.5));
+  image->SetSpacing(itk::MakeFilled<typename TImage::SpacingType>(1.5));
+  image->Allocate();
+  double value = 0.0;
+  for (auto & pixel : itk::ImageBufferRange{ *image })
+  {
+    value = std::fmod(value * 3.7 + 1.3, 50.0);
+    pixel = value;
+  }
+
+  const auto filter = FilterType::New();
+  filter->SetInput(image);
+  filter->SetTransform(&transform);
+  filter->SetInterpolator(&interpolator);
+  filter->SetExtrapolator(extrapolator);
+  filter->SetDefaultPixelValue(-1.0);
+  filter->SetOutputOrigin(itk::MakeFilled<typename TImage::PointType>(-4.0));
+  filter->SetOutputSpacing(itk::MakeFilled<typename TImage::SpacingType>(0.7));
+  typename TImage::SizeType size;
+  for (unsigned int dim = 0; dim < Dimension; ++dim)
+  {
+    size[dim] = 23 + dim;
+  }
+  filter->SetSize(size);
+  filter->Update();
+
+  // The filter disconnects the interpolator and the extrapolator from its input.
+  interpolator.SetInputImage(image);
+  if (extrapolator != nullptr)
+  {
+    extrapolator->SetInputImage(image);
+  }
+
+  const TImage & output = *filter->GetOutput();
+  for (itk::ImageRegionConstIteratorWithIndex<TImage> it(&output, output.GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    const auto inputIndex = image->template TransformPhysicalPointToContinuousIndex<double>(
+      transform.TransformPoint(output.template TransformIndexToPhysicalPoint<double>(it.GetIndex())));
+    double expected = -1.0;
+    if (interpolator.IsInsideBuffer(inputIndex))
+    {
+      expected = interpolator.EvaluateAtContinuousIndex(inputIndex);
+    }
+    else if (extrapolator != nullptr)
+    {
+      expected = extrapolator->EvaluateAtContinuousIndex(inputIndex);
+    }
+    ASSERT_NEAR(it.Get(), expected, 1e-9) << " at " << it.GetIndex();
+  }
+}
+
+
+template <typename TImage>
+void
+Expect_ResampleImageFilter_interpolates_at_the_mapped_indices_of_separable_transforms()
+{
+  constexpr unsigned int Dimension = TImage::ImageDimension;
+
+  const auto scaleTransform = itk::ScaleTransform<double, Dimension>::New();
+  typename itk::ScaleTransform<double, Dimension>::ScaleType scale;
+  for (unsigned int dim = 0; dim < Dimension; ++dim)
+  {
+    scale[dim] = 0.8 + 0.3 * dim;
+  }
+  scaleTransform->SetScale(scale);
+  scaleTransform->SetCenter(itk::MakeFilled<typename TImage::PointType>(1.0));
+
+  const auto translationTransform = itk::TranslationTransform<double, Dimension>::New();
+  translationTransform->SetOffset(
+    itk::MakeFilled<typename itk::TranslationTransform<double, Dimension>::OutputVectorType>(2.3));
+
+  const auto linearInterpolator = itk::LinearInterpolateImageFunction<TImage>::New();
+  const auto nearestNeighborInterpolator = itk::NearestNeighborInterpolateImageFunction<TImage>::New();
+  const auto bSplineInterpolator = itk::BSplineInterpolateImageFunction<TImage>::New();
+  const auto windowedSincInterpolator = itk::WindowedSincInterpolateImageFunction<TImage, 3>::New();
+  const auto extrapolator = itk::NearestNeighborExtrapolateImageFunction<TImage, double>::New();
+
+  for (const itk::Transform<double, Dimension, Dimension> * const transform :
+       { static_cast<const itk::Transform<double, Dimension, Dimension> *>(scaleTransform.get()),
+         static_cast<const itk::Transform<double, Dimension, Dimension> *>(translationTransform.get()) })
+  {
+    for (itk::InterpolateImageFunction<TImage> * const interpolator :
+         { static_cast<itk::InterpolateImageFunction<TImage> *>(linearInterpolator.get()),
+           static_cast<itk::InterpolateImageFunction<TImage> *>(nearestNeighborInterpolator.get()),
+           static_cast<itk::InterpolateImageFunction<TImage> *>(bSplineInterpolator.get()),
+           static_cast<itk::InterpolateImageFunction<TImage> *>(windowedSincInterpolator.get()) })
+    {
+      Expect_ResampleImageFilter_interpolates_at_the_mapped_indices<TImage>(*transform, *interpolator, nullptr);
+      Expect_ResampleImageFilter_interpolates_at_the_mapped_indices<TImage>(
+        *transform, *interpolator, extrapolator.get());
+    }
+  }
+}
+
+// A linear interpolator which only regards the points at least two pixels away from the
+// start of the buffer along the first axis as inside, by overriding IsInsideBuffer().
+template <typename TImage>
+class NarrowedLinearInterpolateImageFunction : public itk::LinearInterpolateImageFunction<TImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(NarrowedLinearInterpolateImageFunction);
+
+  using Self = NarrowedLinearInterpolateImageFunction;
+  using Superclass = itk::LinearInterpolateImageFunction<TImage>;
+  using Pointer = itk::SmartPointer<Self>;
+  using typename Superclass::ContinuousIndexType;
+
+  itkNewMacro(Self);
+
+  using Superclass::IsInsideBuffer;
+
+  bool
+  IsInsideBuffer(const ContinuousIndexType & index) const override
+  {
+    return Superclass::IsInsideBuffer(index) && index[0] >= this->GetStartContinuousIndex()[0] + 2.0;
+  }
+
+protected:
+  NarrowedLinearInterpolateImageFunction() = default;
+};
+
+// A B-spline interpolator which keeps the coefficients of its last input image,
+// after the resample filter has disconnected it.
+template <typename TImage>
+class CoefficientsKeepingBSplineInterpolateImageFunction : public itk::BSplineInterpolateImageFunction<TImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CoefficientsKeepingBSplineInterpolateImageFunction);
+
+  using Self = CoefficientsKeepingBSplineInterpolateImageFunction;
+  using Superclass = itk::BSplineInterpolateImageFunction<TImage>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+
+  void
+  SetInputImage(const TImage * inputData) override
+  {
+    Superclass::SetInputImage(inputData);
+    if (inputData != nullptr)
+    {
+      m_KeptCoefficients = this->GetCoefficients();
+    }
+  }
+
+  typename Superclass::CoefficientImageType::ConstPointer m_KeptCoefficients{};
+
+protected:
+  CoefficientsKeepingBSplineInterpolateImageFunction() = default;
+};
+
 } // namespace
 
 // Compile time check of mixing transform and precision types
@@ -172,3 +354,193 @@ TEST(ResampleImageFilter, Expect_ResampleImageFilter_thows_on_incomplete_configu
 {
   Expect_ResampleImageFilter_thows_on_incomplete_configuration(128.0);
 }
+
+
+TEST(ResampleImageFilter, InterpolatesAtTheMappedIndicesOfSeparableTransforms)
+{
+  Expect_ResampleImageFilter_interpolates_at_the_mapped_indices_of_separable_transforms<itk::Image<double, 2>>();
+  Expect_ResampleImageFilter_interpolates_at_the_mapped_indices_of_separable_transforms<itk::Image<double, 3>>();
+}
+
+
+TEST(ResampleImageFilter, ClassifiesThePointsByTheIsInsideBufferOfTheInterpolator)
+{
+  using ImageType = itk::Image<double, 2>;
+
+  const auto translationTransform = itk::TranslationTransform<double, 2>::New();
+  translationTransform->SetOffset(itk::MakeFilled<itk::TranslationTransform<double, 2>::OutputVectorType>(1.05));
+  const auto interpolator = NarrowedLinearInterpolateImageFunction<ImageType>::New();
+  const auto extrapolator = itk::NearestNeighborExtrapolateImageFunction<ImageType, double>::New();
+
+  Expect_ResampleImageFilter_interpolates_at_the_mapped_indices<ImageType>(
+    *translationTransform, *interpolator, nullptr);
+  Expect_ResampleImageFilter_interpolates_at_the_mapped_indices<ImageType>(
+    *translationTransform, *interpolator, extrapolator.get());
+}
+
+
+TEST(ResampleImageFilter, ResamplesLargeOneDimensionalImages)
+{
+  // More pixels than a single chunk of the separable resampling holds.
+  using ImageType = itk::Image<float, 1>;
+  constexpr itk::SizeValueType numberOfPixels = 600000;
+
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { numberOfPixels } });
+  image->Allocate();
+  float value = 0.0f;
+  for (auto & pixel : itk::ImageBufferRange{ *image })
+  {
+    pixel = value;
+    value = (value < 1000.0f) ? (value + 1.0f) : 0.0f;
+  }
+
+  const auto filter = itk::ResampleImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(image);
+  filter->SetOutputParametersFromImage(image);
+  filter->SetNumberOfWorkUnits(1);
+  filter->Update();
+
+  const itk::ImageBufferRange<const ImageType> inputRange{ *image };
+  const itk::ImageBufferRange<const ImageType> outputRange{ *filter->GetOutput() };
+  ASSERT_EQ(outputRange.size(), inputRange.size());
+  for (size_t i = 0; i < inputRange.size(); ++i)
+  {
+    ASSERT_NEAR(outputRange[i], inputRange[i], 1e-3) << " at " << i;
+  }
+}
+
+
+TEST(ResampleImageFilter, SharesTheBSplineCoefficientsOfTheInputImage)
+{
+  using ImageType = itk::Image<float, 2>;
+  using InterpolatorType = CoefficientsKeepingBSplineInterpolateImageFunction<ImageType>;
+  using CacheType = itk::BSplineCoefficientImageCache<ImageType, InterpolatorType::CoefficientImageType>;
+
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 20, 16 } });
+  image->Allocate();
+  float value = 0.0f;
+  for (auto & pixel : itk::ImageBufferRange{ *image })
+  {
+    value = std::fmod(value * 3.7f + 1.3f, 50.0f);
+    pixel = value;
+  }
+
+  std::vector<InterpolatorType::Pointer> interpolators;
+  for (const bool useCoefficientImageCache : { true, true, false })
+  {
+    const auto interpolator = InterpolatorType::New();
+    const auto filter = itk::ResampleImageFilter<ImageType, ImageType>::New();
+    EXPECT_FALSE(filter->GetUseCoefficientImageCache());
+    filter->SetUseCoefficientImageCache(useCoefficientImageCache);
+    filter->SetInput(image);
+    filter->SetInterpolator(interpolator);
+    filter->SetOutputParametersFromImage(image);
+    filter->Update();
+    EXPECT_FALSE(interpolator->GetUseCoefficientImageCache());
+    ASSERT_NE(interpolator->m_KeptCoefficients, nullptr);
+    interpolators.push_back(interpolator);
+  }
+
+  // The filters which use the cache decompose the image once.
+  EXPECT_EQ(interpolators[1]->m_KeptCoefficients, interpolators[0]->m_KeptCoefficients);
+  EXPECT_EQ(CacheType::GetCoefficientImage(image, 3), interpolators[0]->m_KeptCoefficients);
+  EXPECT_NE(interpolators[2]->m_KeptCoefficients, interpolators[0]->m_KeptCoefficients);
+  CacheType::ReleaseCoefficientImages();
+}
+
+
+TEST(ResampleImageFilter, CachesTheTransformedPointsOfNonlinearTransforms)
+{
+  using ImageType = itk::Image<float, 2>;
+  using FilterType = itk::ResampleImageFilter<ImageType, ImageType>;
+  using BSplineTransformType = itk::BSplineTransform<double, 2, 3>;
+
+  std::vector<ImageType::Pointer> images;
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    const auto image = ImageType::New();
+    image->SetRegions(ImageType::SizeType{ { 20, 16 } });
+    image->Allocate();
+    unsigned int value = i;
+    for (auto & pixel : itk::ImageBufferRange{ *image })
+    {
+      value = (value * 7919 + 13) % 101;
+      pixel = static_cast<float>(value);
+    }
+    images.push_back(image);
+  }
+
+  const auto affineTransform = itk::AffineTransform<double, 2>::New();
+  affineTransform->Rotate2D(0.1);
+  affineTransform->Translate(itk::MakeVector(1.5, -0.5));
+
+  const auto bSplineTransform = BSplineTransformType::New();
+  bSplineTransform->SetTransformDomainOrigin(itk::MakePoint(-1.0, -1.0));
+  bSplineTransform->SetTransformDomainPhysicalDimensions(itk::MakeVector(22.0, 18.0));
+  bSplineTransform->SetTransformDomainMeshSize(itk::MakeSize(3, 2));
+  BSplineTransformType::ParametersType parameters(bSplineTransform->GetNumberOfParameters());
+  for (unsigned int i = 0; i < parameters.size(); ++i)
+  {
+    parameters[i] = std::sin(i);
+  }
+  bSplineTransform->SetParametersByValue(parameters);
+
+  const auto transform = itk::CompositeTransform<double, 2>::New();
+  transform->AddTransform(affineTransform);
+  transform->AddTransform(bSplineTransform);
+
+  const auto createFilter = [&transform, &images] {
+    const auto filter = FilterType::New();
+    filter->SetTransform(transform);
+    filter->SetOutputParametersFromImage(images[0]);
+    filter->SetSize(itk::MakeSize(17, 21));
+    filter->SetOutputSpacing(itk::MakeVector(1.1, 0.8));
+    return filter;
+  };
+  const auto filter = createFilter();
+  const auto cachingFilter = createFilter();
+  EXPECT_FALSE(cachingFilter->GetCacheTransformedPoints());
+  cachingFilter->CacheTransformedPointsOn();
+
+  // Resamples an image with both filters, which give the same pixels.
+  const auto expect_equal_outputs = [&filter, &cachingFilter](const ImageType * const image) {
+    filter->SetInput(image);
+    filter->Modified();
+    filter->Update();
+    cachingFilter->SetInput(image);
+    cachingFilter->Modified();
+    cachingFilter->Update();
+    const itk::ImageBufferRange<const ImageType> expectedPixels(*filter->GetOutput());
+    const itk::ImageBufferRange<const ImageType> pixels(*cachingFilter->GetOutput());
+    EXPECT_TRUE(std::equal(pixels.cbegin(), pixels.cend(), expectedPixels.cbegin(), expectedPixels.cend()));
+  };
+  expect_equal_outputs(images[0]);
+  expect_equal_outputs(images[1]);
+
+  // A change of a sub transform, or of the output grid, invalidates the cache.
+  parameters[3] += 2.0;
+  bSplineTransform->SetParametersByValue(parameters);
+  expect_equal_outputs(images[0]);
+
+  filter->SetOutputOrigin(itk::MakePoint(0.5, -1.0));
+  cachingFilter->SetOutputOrigin(itk::MakePoint(0.5, -1.0));
+  expect_equal_outputs(images[1]);
+
+  // Streamed regions take their points from the same cache.
+  filter->SetInput(images[0]);
+  filter->Update();
+  cachingFilter->SetInput(images[0]);
+  cachingFilter->UpdateLargestPossibleRegion();
+  ImageType::RegionType region = cachingFilter->GetOutput()->GetLargestPossibleRegion();
+  region.SetSize(1, 5);
+  region.SetIndex(1, 7);
+  cachingFilter->GetOutput()->SetRequestedRegion(region);
+  cachingFilter->Modified();
+  cachingFilter->Update();
+  for (const auto & index : itk::ImageRegionIndexRange<2>(region))
+  {
+    EXPECT_EQ(cachingFilter->GetOutput()->GetPixel(index), filter->GetOutput()->GetPixel(index)) << " at " << index;
+  }
+}
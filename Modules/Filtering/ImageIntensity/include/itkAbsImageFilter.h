@@ -47,6 +47,10 @@ public:
     return static_cast<TOutput>(itk::Math::abs(A));
   }
 };
+
+template <typename TInput, typename TOutput>
+struct IsSIMDVectorizable<Abs<TInput, TOutput>> : std::true_type
+{};
 } // namespace Functor
 
 /** \class AbsImageFilter
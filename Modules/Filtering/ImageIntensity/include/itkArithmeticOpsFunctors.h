@@ -19,6 +19,7 @@
 #define itkArithmeticOpsFunctors_h
 
 #include "itkMath.h"
+#include "itkSIMDPixelTransform.h"
 
 namespace itk
 {
@@ -48,6 +49,10 @@ public:
   }
 };
 
+template <typename TInput1, typename TInput2, typename TOutput>
+struct IsSIMDVectorizable<Add2<TInput1, TInput2, TOutput>> : std::true_type
+{};
+
 
 /**
  * \class Add3
@@ -98,6 +103,10 @@ public:
   }
 };
 
+template <typename TInput1, typename TInput2, typename TOutput>
+struct IsSIMDVectorizable<Sub2<TInput1, TInput2, TOutput>> : std::true_type
+{};
+
 
 /**
  * \class Mult
@@ -123,6 +132,10 @@ public:
   }
 };
 
+template <typename TInput1, typename TInput2, typename TOutput>
+struct IsSIMDVectorizable<Mult<TInput1, TInput2, TOutput>> : std::true_type
+{};
+
 
 /**
  * \class Div
@@ -87,6 +87,10 @@ private:
   OutputType m_UpperBound;
 };
 
+template <typename TInput, typename TOutput>
+struct IsSIMDVectorizable<Clamp<TInput, TOutput>> : std::true_type
+{};
+
 
 template <typename TInput, typename TOutput>
 inline auto
@@ -94,17 +98,12 @@ Clamp<TInput, TOutput>::operator()(const InputType & A) const -> OutputType
 {
   const auto dA = static_cast<double>(A);
 
-  if (dA < m_LowerBound)
-  {
-    return m_LowerBound;
-  }
-
-  if (dA > m_UpperBound)
-  {
-    return m_UpperBound;
-  }
-
-  return static_cast<OutputType>(A);
+  // Selects rather than branches, so that the loops over the pixels can be
+  // vectorized. The bounds are read first, since a vectorized loop may not
+  // read them conditionally.
+  const OutputType lowerBound = m_LowerBound;
+  const OutputType upperBound = m_UpperBound;
+  return dA < lowerBound ? lowerBound : (dA > upperBound ? upperBound : static_cast<OutputType>(A));
 }
 
 } // end namespace Functor
@@ -177,7 +177,8 @@ PolylineMaskImageFilter<TInputImage, TPolyline, TVector, TOutputImage>::Generate
   outputImagePtr->SetRequestedRegion(inputImagePtr->GetRequestedRegion());
   outputImagePtr->SetBufferedRegion(inputImagePtr->GetBufferedRegion());
   outputImagePtr->SetLargestPossibleRegion(inputImagePtr->GetLargestPossibleRegion());
-  outputImagePtr->AllocateInitialized();
+  // Every output pixel is set by the masking loop below.
+  outputImagePtr->Allocate();
 
   InputImageConstIteratorType inputIt(inputImagePtr, inputImagePtr->GetLargestPossibleRegion());
   OutputImageIteratorType     outputIt(outputImagePtr, outputImagePtr->GetLargestPossibleRegion());
@@ -328,7 +329,8 @@ PolylineMaskImageFilter<TInputImage, TPolyline, TVector, TOutputImage>::Generate
   itkDebugMacro("Projection image origin:" << origin);
 
   projectionImagePtr->SetRegions(projectionRegion);
-  projectionImagePtr->AllocateInitialized();
+  // The buffer is filled with the unlabeled value below.
+  projectionImagePtr->Allocate();
 
   using ProjectionImageIteratorType = ImageRegionIterator<ProjectionImageType>;
   ProjectionImageIteratorType projectionIt(projectionImagePtr, projectionImagePtr->GetLargestPossibleRegion());
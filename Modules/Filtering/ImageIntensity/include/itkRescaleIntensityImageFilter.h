@@ -179,6 +179,14 @@ public:
   void
   BeforeThreadedGenerateData() override;
 
+  /** The filter cannot be fused by FusedPixelwiseImageFilter, since it
+   * computes the range of its whole input first. */
+  bool
+  CanFusePixelwise() const override
+  {
+    return false;
+  }
+
   /** Print internal ivars */
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
@@ -20,6 +20,7 @@
 
 #include "itkImageToImageFilter.h"
 #include "itkArray.h"
+#include "itkPixelwiseFusionStage.h"
 #include <mutex>
 
 namespace itk
@@ -37,7 +38,9 @@ namespace itk
  * \ingroup ITKImageIntensity
  */
 template <typename TInputImage, typename TOutputImage>
-class ITK_TEMPLATE_EXPORT ShiftScaleImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+class ITK_TEMPLATE_EXPORT ShiftScaleImageFilter
+  : public ImageToImageFilter<TInputImage, TOutputImage>
+  , public PixelwiseFusionStage
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(ShiftScaleImageFilter);
@@ -94,6 +97,36 @@ public:
   itkGetConstMacro(UnderflowCount, SizeValueType);
   itkGetConstMacro(OverflowCount, SizeValueType);
 
+  /** The shift and scale may be fused with the neighboring filters by
+   * FusedPixelwiseImageFilter, for itk::Image inputs and outputs. The
+   * underflow and overflow counts are computed as well.
+   * \sa PixelwiseFusionStage */
+  bool
+  CanFusePixelwise() const override
+  {
+    return PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>();
+  }
+  size_t
+  GetFusionInputPixelSize() const override
+  {
+    return sizeof(InputImagePixelType);
+  }
+  size_t
+  GetFusionOutputPixelSize() const override
+  {
+    return sizeof(OutputImagePixelType);
+  }
+  void
+  BeforeFusedTransformPixels() override
+  {
+    this->BeforeThreadedGenerateData();
+  }
+  void
+  FusedTransformPixels(const void * input, void * output, SizeValueType numberOfPixels) override;
+  void
+  AfterFusedTransformPixels() override
+  {}
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(OutputHasNumericTraitsCheck, (Concept::HasNumericTraits<OutputImagePixelType>));
@@ -117,6 +150,24 @@ protected:
   DynamicThreadedGenerateData(const OutputImageRegionType &) override;
 
 private:
+  /** Shifts, scales and clamps a pixel, counting the clamped values. */
+  OutputImagePixelType
+  ShiftScalePixel(const InputImagePixelType & pixel, SizeValueType & underflow, SizeValueType & overflow) const
+  {
+    const RealType value = (static_cast<RealType>(pixel) + m_Shift) * m_Scale;
+    if (value < NumericTraits<OutputImagePixelType>::NonpositiveMin())
+    {
+      ++underflow;
+      return NumericTraits<OutputImagePixelType>::NonpositiveMin();
+    }
+    if (value > static_cast<RealType>(NumericTraits<OutputImagePixelType>::max()))
+    {
+      ++overflow;
+      return NumericTraits<OutputImagePixelType>::max();
+    }
+    return static_cast<OutputImagePixelType>(value);
+  }
+
   RealType m_Shift{};
   RealType m_Scale{ NumericTraits<RealType>::OneValue() };
 
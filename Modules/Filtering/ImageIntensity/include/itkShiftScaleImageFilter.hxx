@@ -19,6 +19,7 @@
 #define itkShiftScaleImageFilter_hxx
 
 #include "itkImageScanlineIterator.h"
+#include "itkPixelSpan.h"
 #include "itkNumericTraits.h"
 #include "itkTotalProgressReporter.h"
 
@@ -47,40 +48,44 @@ ShiftScaleImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   SizeValueType underflow = 0;
   SizeValueType overflow = 0;
 
-  ImageScanlineIterator      ot(outputPtr, outputRegion);
-  ImageScanlineConstIterator it(inputPtr, outputRegion);
-
   // support progress methods/callbacks
 
   TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
 
   // do the work
-  while (!it.IsAtEnd())
+  if constexpr (HasPixelArrayBuffer<TInputImage> && HasPixelArrayBuffer<TOutputImage>)
+  {
+    ForEachPixelSpan(
+      outputRegion,
+      [&](PixelSpan<const InputImagePixelType> input, PixelSpan<OutputImagePixelType> output) {
+        for (SizeValueType i = 0; i < output.size(); ++i)
+        {
+          // shift and scale the input pixels
+          output[i] = this->ShiftScalePixel(input[i], underflow, overflow);
+        }
+        progress.Completed(output.size());
+      },
+      inputPtr,
+      outputPtr);
+  }
+  else
   {
-    while (!it.IsAtEndOfLine())
+    ImageScanlineIterator      ot(outputPtr, outputRegion);
+    ImageScanlineConstIterator it(inputPtr, outputRegion);
+
+    while (!it.IsAtEnd())
     {
-      // shift and scale the input pixels
-      const RealType value = (static_cast<RealType>(it.Get()) + m_Shift) * m_Scale;
-      if (value < NumericTraits<OutputImagePixelType>::NonpositiveMin())
-      {
-        ot.Set(NumericTraits<OutputImagePixelType>::NonpositiveMin());
-        ++underflow;
-      }
-      else if (value > static_cast<RealType>(NumericTraits<OutputImagePixelType>::max()))
+      while (!it.IsAtEndOfLine())
       {
-        ot.Set(NumericTraits<OutputImagePixelType>::max());
-        ++overflow;
+        // shift and scale the input pixels
+        ot.Set(this->ShiftScalePixel(it.Get(), underflow, overflow));
+        ++it;
+        ++ot;
       }
-      else
-      {
-        ot.Set(static_cast<OutputImagePixelType>(value));
-      }
-      ++it;
-      ++ot;
+      it.NextLine();
+      ot.NextLine();
+      progress.Completed(outputRegion.GetSize()[0]);
     }
-    it.NextLine();
-    ot.NextLine();
-    progress.Completed(outputRegion.GetSize()[0]);
   }
 
   const std::lock_guard<std::mutex> lockGuard(m_Mutex);
@@ -88,6 +93,40 @@ ShiftScaleImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   m_UnderflowCount += underflow;
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+ShiftScaleImageFilter<TInputImage, TOutputImage>::FusedTransformPixels(const void *  input,
+                                                                       void *        output,
+                                                                       SizeValueType numberOfPixels)
+{
+  if constexpr (PixelwiseFusionStage::IsFusable<TInputImage, TOutputImage>())
+  {
+    const auto * inputPixels = static_cast<const InputImagePixelType *>(input);
+    auto *       outputPixels = static_cast<OutputImagePixelType *>(output);
+
+    SizeValueType underflow = 0;
+    SizeValueType overflow = 0;
+    for (SizeValueType i = 0; i < numberOfPixels; ++i)
+    {
+      outputPixels[i] = this->ShiftScalePixel(inputPixels[i], underflow, overflow);
+    }
+
+    if (underflow != 0 || overflow != 0)
+    {
+      const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+      m_OverflowCount += overflow;
+      m_UnderflowCount += underflow;
+    }
+  }
+  else
+  {
+    (void)input;
+    (void)output;
+    (void)numberOfPixels;
+    itkExceptionMacro("The pixels of " << this->GetNameOfClass() << " cannot be fused.");
+  }
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 ShiftScaleImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
@@ -48,6 +48,10 @@ public:
     return static_cast<TOutput>(std::sqrt(static_cast<double>(A)));
   }
 };
+
+template <typename TInput, typename TOutput>
+struct IsSIMDVectorizable<Sqrt<TInput, TOutput>> : std::true_type
+{};
 } // namespace Functor
 
 /**
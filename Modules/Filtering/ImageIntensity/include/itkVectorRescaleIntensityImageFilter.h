@@ -145,6 +145,14 @@ public:
   void
   BeforeThreadedGenerateData() override;
 
+  /** The filter cannot be fused by FusedPixelwiseImageFilter, since it
+   * computes the largest magnitude of its whole input first. */
+  bool
+  CanFusePixelwise() const override
+  {
+    return false;
+  }
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
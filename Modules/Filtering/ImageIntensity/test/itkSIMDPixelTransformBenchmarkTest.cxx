@@ -0,0 +1,239 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkAbsImageFilter.h"
+#include "itkAddImageFilter.h"
+#include "itkClampImageFilter.h"
+#include "itkImageScanlineIterator.h"
+#include "itkMultiplyImageFilter.h"
+#include "itkRandomImageSource.h"
+#include "itkSqrtImageFilter.h"
+#include "itkTimeProbesCollectorBase.h"
+#include "itkTestingMacros.h"
+
+#include <string>
+#include <tuple>
+
+// Compares the throughput of pixel-wise filters, which apply their functors
+// to the lines of the images with SIMDTransformPixels(), with a loop calling
+// the same functors one pixel at a time through scanline iterators, as the
+// filters did before. Checks that the outputs are identical, also when the
+// requested region is not contiguous in the buffer.
+//
+// Usage: itkSIMDPixelTransformBenchmarkTest imageSize [numberOfIterations]
+// The images are cubes of imageSize^3 float and unsigned short pixels.
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+
+template <typename TOutputImage, typename TFunctor, typename... TInputImages>
+typename TOutputImage::Pointer
+ComputeReference(const TFunctor & functor, const TInputImages *... inputs)
+{
+  auto output = TOutputImage::New();
+  output->SetRegions(std::get<0>(std::make_tuple(inputs...))->GetBufferedRegion());
+  output->Allocate();
+
+  itk::ImageScanlineIterator<TOutputImage> outputIt(output, output->GetBufferedRegion());
+  auto inputIts =
+    std::make_tuple(itk::ImageScanlineConstIterator<TInputImages>(inputs, inputs->GetBufferedRegion())...);
+  while (!outputIt.IsAtEnd())
+  {
+    while (!outputIt.IsAtEndOfLine())
+    {
+      std::apply([&outputIt, &functor](auto &... inputIt) { outputIt.Set(functor(inputIt.Get()...)); }, inputIts);
+      std::apply([](auto &... inputIt) { (++inputIt, ...); }, inputIts);
+      ++outputIt;
+    }
+    std::apply([](auto &... inputIt) { (inputIt.NextLine(), ...); }, inputIts);
+    outputIt.NextLine();
+  }
+  return output;
+}
+
+template <typename TImage>
+bool
+AreEqual(const TImage * image, const TImage * reference, const typename TImage::RegionType & region)
+{
+  itk::ImageRegionConstIterator<TImage> imageIt(image, region);
+  itk::ImageRegionConstIterator<TImage> referenceIt(reference, region);
+  for (; !imageIt.IsAtEnd(); ++imageIt, ++referenceIt)
+  {
+    if (imageIt.Get() != referenceIt.Get())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Times the filter and the reference loop, and checks that they compute the
+// same pixels on the whole image and on a cropped requested region.
+template <typename TFilter, typename TReference>
+bool
+Benchmark(const std::string &            name,
+          TFilter *                      filter,
+          const TReference &             computeReference,
+          unsigned int                   numberOfIterations,
+          itk::TimeProbesCollectorBase & timeProbes)
+{
+  using OutputImageType = typename TFilter::OutputImageType;
+  typename OutputImageType::Pointer reference;
+  for (unsigned int i = 0; i < numberOfIterations; ++i)
+  {
+    filter->Modified();
+    timeProbes.Start((name + " SIMD").c_str());
+    filter->Update();
+    timeProbes.Stop((name + " SIMD").c_str());
+
+    timeProbes.Start((name + " Scalar").c_str());
+    reference = computeReference();
+    timeProbes.Stop((name + " Scalar").c_str());
+  }
+  if (!AreEqual<OutputImageType>(filter->GetOutput(), reference, reference->GetBufferedRegion()))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << name << " differs from the scalar loop." << std::endl;
+    return false;
+  }
+
+  // The cropped region is not contiguous in the buffers of the inputs.
+  typename OutputImageType::RegionType cropped = reference->GetBufferedRegion();
+  cropped.ShrinkByRadius(1);
+  filter->Modified();
+  filter->GetOutput()->SetRequestedRegion(cropped);
+  filter->Update();
+  if (!AreEqual<OutputImageType>(filter->GetOutput(), reference, cropped))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << name << " differs from the scalar loop in a cropped region." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <typename TPixel>
+bool
+BenchmarkPixelType(const std::string &            pixelName,
+                   itk::SizeValueType             imageSize,
+                   unsigned int                   numberOfIterations,
+                   itk::TimeProbesCollectorBase & timeProbes)
+{
+  using ImageType = itk::Image<TPixel, Dimension>;
+
+  auto source1 = itk::RandomImageSource<ImageType>::New();
+  source1->SetSize(ImageType::SizeType::Filled(imageSize));
+  source1->SetMin(0);
+  source1->SetMax(200);
+  source1->Update();
+  auto source2 = itk::RandomImageSource<ImageType>::New();
+  source2->SetSize(ImageType::SizeType::Filled(imageSize));
+  source2->SetMin(1);
+  source2->SetMax(100);
+  source2->Update();
+  const ImageType * input1 = source1->GetOutput();
+  const ImageType * input2 = source2->GetOutput();
+
+  bool success = true;
+
+  auto add = itk::AddImageFilter<ImageType>::New();
+  add->SetInput1(input1);
+  add->SetInput2(input2);
+  add->InPlaceOff();
+  success &= Benchmark(
+    pixelName + " Add",
+    add.GetPointer(),
+    [=] { return ComputeReference<ImageType>(itk::Functor::Add2<TPixel>(), input1, input2); },
+    numberOfIterations,
+    timeProbes);
+
+  auto multiply = itk::MultiplyImageFilter<ImageType>::New();
+  multiply->SetInput1(input1);
+  multiply->SetConstant2(3);
+  multiply->InPlaceOff();
+  success &= Benchmark(
+    pixelName + " MultiplyByConstant",
+    multiply.GetPointer(),
+    [=] {
+      return ComputeReference<ImageType>([](const TPixel & a) { return itk::Functor::Mult<TPixel>()(a, 3); }, input1);
+    },
+    numberOfIterations,
+    timeProbes);
+
+  auto clamp = itk::ClampImageFilter<ImageType, ImageType>::New();
+  clamp->SetInput(input1);
+  clamp->SetBounds(50, 150);
+  clamp->InPlaceOff();
+  success &= Benchmark(
+    pixelName + " Clamp",
+    clamp.GetPointer(),
+    [=] { return ComputeReference<ImageType>(clamp->GetFunctor(), input1); },
+    numberOfIterations,
+    timeProbes);
+
+  auto sqrt = itk::SqrtImageFilter<ImageType, ImageType>::New();
+  sqrt->SetInput(input1);
+  sqrt->InPlaceOff();
+  success &= Benchmark(
+    pixelName + " Sqrt",
+    sqrt.GetPointer(),
+    [=] { return ComputeReference<ImageType>(itk::Functor::Sqrt<TPixel, TPixel>(), input1); },
+    numberOfIterations,
+    timeProbes);
+
+  auto abs = itk::AbsImageFilter<ImageType, ImageType>::New();
+  abs->SetInput(input1);
+  abs->InPlaceOff();
+  success &= Benchmark(
+    pixelName + " Abs",
+    abs.GetPointer(),
+    [=] { return ComputeReference<ImageType>(itk::Functor::Abs<TPixel, TPixel>(), input1); },
+    numberOfIterations,
+    timeProbes);
+
+  return success;
+}
+} // namespace
+
+int
+itkSIMDPixelTransformBenchmarkTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " imageSize [numberOfIterations]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto         imageSize = static_cast<itk::SizeValueType>(std::stoul(argv[1]));
+  const unsigned int numberOfIterations = (argc > 2) ? std::stoul(argv[2]) : 5;
+
+  itk::TimeProbesCollectorBase timeProbes;
+  bool                         success = true;
+  success &= BenchmarkPixelType<float>("float", imageSize, numberOfIterations, timeProbes);
+  success &= BenchmarkPixelType<unsigned short>("uint16", imageSize, numberOfIterations, timeProbes);
+
+  timeProbes.Report(std::cout);
+
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -20,6 +20,7 @@
 
 
 #include "itkImageScanlineIterator.h"
+#include "itkPixelSpan.h"
 #include <mutex>
 
 #include <vector>
@@ -76,40 +77,61 @@ MinimumMaximumImageFilter<TInputImage>::ThreadedStreamedGenerateData(const Regio
   PixelType localMin = NumericTraits<PixelType>::max();
   PixelType localMax = NumericTraits<PixelType>::NonpositiveMin();
 
-  ImageScanlineConstIterator it(this->GetInput(), regionForThread);
-
-
   // do the work
-  while (!it.IsAtEnd())
+  if constexpr (HasPixelArrayBuffer<TInputImage>)
   {
-    // Handle the odd pixel separately
-    if (regionForThread.GetSize(0) % 2 == 1)
-    {
-      const PixelType value = it.Get();
-      localMin = std::min(value, localMin);
-      localMax = std::max(value, localMax);
-      ++it;
-    }
+    // Branch-free, and on local variables which may not alias the pixels, so
+    // that the compiler may vectorize it.
+    ForEachPixelSpan(
+      regionForThread,
+      [&localMin, &localMax](PixelSpan<const PixelType> pixels) {
+        PixelType spanMin = localMin;
+        PixelType spanMax = localMax;
+        for (const PixelType value : pixels)
+        {
+          spanMin = std::min(value, spanMin);
+          spanMax = std::max(value, spanMax);
+        }
+        localMin = spanMin;
+        localMax = spanMax;
+      },
+      this->GetInput());
+  }
+  else
+  {
+    ImageScanlineConstIterator it(this->GetInput(), regionForThread);
 
-    while (!it.IsAtEndOfLine())
+    while (!it.IsAtEnd())
     {
-      const PixelType value1 = it.Get();
-      ++it;
-      const PixelType value2 = it.Get();
-      ++it;
-
-      if (value1 > value2)
+      // Handle the odd pixel separately
+      if (regionForThread.GetSize(0) % 2 == 1)
       {
-        localMax = std::max(value1, localMax);
-        localMin = std::min(value2, localMin);
+        const PixelType value = it.Get();
+        localMin = std::min(value, localMin);
+        localMax = std::max(value, localMax);
+        ++it;
       }
-      else
+
+      while (!it.IsAtEndOfLine())
       {
-        localMax = std::max(value2, localMax);
-        localMin = std::min(value1, localMin);
+        const PixelType value1 = it.Get();
+        ++it;
+        const PixelType value2 = it.Get();
+        ++it;
+
+        if (value1 > value2)
+        {
+          localMax = std::max(value1, localMax);
+          localMin = std::min(value2, localMin);
+        }
+        else
+        {
+          localMax = std::max(value2, localMax);
+          localMin = std::min(value1, localMin);
+        }
       }
+      it.NextLine();
     }
-    it.NextLine();
   }
 
   const std::lock_guard<std::mutex> lockGuard(m_Mutex);
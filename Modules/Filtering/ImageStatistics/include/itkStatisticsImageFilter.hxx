@@ -20,6 +20,7 @@
 
 
 #include "itkImageScanlineIterator.h"
+#include "itkPixelSpan.h"
 #include <mutex>
 
 namespace itk
@@ -105,24 +106,51 @@ StatisticsImageFilter<TInputImage>::ThreadedStreamedGenerateData(const RegionTyp
   PixelType                      min = NumericTraits<PixelType>::max();
   PixelType                      max = NumericTraits<PixelType>::NonpositiveMin();
 
-  ImageScanlineConstIterator it(this->GetInput(), regionForThread);
-
   // do the work
-  while (!it.IsAtEnd())
+  if constexpr (HasPixelArrayBuffer<TInputImage>)
+  {
+    // The minimum and maximum are local variables which may not alias the
+    // pixels, so that the compiler keeps them in registers.
+    ForEachPixelSpan(
+      regionForThread,
+      [&](PixelSpan<const PixelType> pixels) {
+        PixelType spanMin = min;
+        PixelType spanMax = max;
+        for (const PixelType & value : pixels)
+        {
+          const auto realValue = static_cast<RealType>(value);
+          spanMin = std::min(spanMin, value);
+          spanMax = std::max(spanMax, value);
+
+          sum += realValue;
+          sumOfSquares += (realValue * realValue);
+        }
+        min = spanMin;
+        max = spanMax;
+        count += pixels.size();
+      },
+      this->GetInput());
+  }
+  else
   {
-    while (!it.IsAtEndOfLine())
+    ImageScanlineConstIterator it(this->GetInput(), regionForThread);
+
+    while (!it.IsAtEnd())
     {
-      const PixelType & value = it.Get();
-      const auto        realValue = static_cast<RealType>(value);
-      min = std::min(min, value);
-      max = std::max(max, value);
-
-      sum += realValue;
-      sumOfSquares += (realValue * realValue);
-      ++count;
-      ++it;
+      while (!it.IsAtEndOfLine())
+      {
+        const PixelType & value = it.Get();
+        const auto        realValue = static_cast<RealType>(value);
+        min = std::min(min, value);
+        max = std::max(max, value);
+
+        sum += realValue;
+        sumOfSquares += (realValue * realValue);
+        ++count;
+        ++it;
+      }
+      it.NextLine();
     }
-    it.NextLine();
   }
 
   const std::lock_guard<std::mutex> lockGuard(m_Mutex);
@@ -0,0 +1,309 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCompensatedSummation.h"
+#include "itkImageScanlineIterator.h"
+#include "itkMinimumMaximumImageFilter.h"
+#include "itkRandomImageSource.h"
+#include "itkShiftScaleImageFilter.h"
+#include "itkStatisticsImageFilter.h"
+#include "itkTimeProbesCollectorBase.h"
+#include "itkTestingMacros.h"
+
+#include <string>
+#include <utility>
+
+// Compares the throughput of the filters which iterate over the pixels of
+// their images with ForEachPixelSpan(), with the scanline iterator loops they
+// used before. Checks that they compute the same results, also when the
+// requested region is not contiguous in the buffer.
+//
+// Usage: itkPixelSpanBenchmarkTest imageSize [numberOfIterations]
+// The images are cubes of imageSize^3 float and short pixels.
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+
+template <typename TImage>
+struct ReferenceStatistics
+{
+  using PixelType = typename TImage::PixelType;
+  using RealType = typename itk::NumericTraits<PixelType>::RealType;
+
+  PixelType Minimum{ itk::NumericTraits<PixelType>::max() };
+  PixelType Maximum{ itk::NumericTraits<PixelType>::NonpositiveMin() };
+  RealType  Sum{};
+  RealType  SumOfSquares{};
+
+  explicit ReferenceStatistics(const TImage * image)
+  {
+    itk::CompensatedSummation<RealType> sum = RealType{};
+    itk::CompensatedSummation<RealType> sumOfSquares = RealType{};
+
+    itk::ImageScanlineConstIterator<TImage> it(image, image->GetBufferedRegion());
+    while (!it.IsAtEnd())
+    {
+      while (!it.IsAtEndOfLine())
+      {
+        const PixelType value = it.Get();
+        const auto      realValue = static_cast<RealType>(value);
+        Minimum = std::min(Minimum, value);
+        Maximum = std::max(Maximum, value);
+        sum += realValue;
+        sumOfSquares += realValue * realValue;
+        ++it;
+      }
+      it.NextLine();
+    }
+    Sum = sum.GetSum();
+    SumOfSquares = sumOfSquares.GetSum();
+  }
+};
+
+// The pairwise loop of the MinimumMaximumImageFilter.
+template <typename TImage>
+std::pair<typename TImage::PixelType, typename TImage::PixelType>
+ReferenceMinimumMaximum(const TImage * image)
+{
+  using PixelType = typename TImage::PixelType;
+
+  PixelType minimum = itk::NumericTraits<PixelType>::max();
+  PixelType maximum = itk::NumericTraits<PixelType>::NonpositiveMin();
+
+  itk::ImageScanlineConstIterator<TImage> it(image, image->GetBufferedRegion());
+  while (!it.IsAtEnd())
+  {
+    if (image->GetBufferedRegion().GetSize(0) % 2 == 1)
+    {
+      minimum = std::min(it.Get(), minimum);
+      maximum = std::max(it.Get(), maximum);
+      ++it;
+    }
+    while (!it.IsAtEndOfLine())
+    {
+      const PixelType value1 = it.Get();
+      ++it;
+      const PixelType value2 = it.Get();
+      ++it;
+      if (value1 > value2)
+      {
+        maximum = std::max(value1, maximum);
+        minimum = std::min(value2, minimum);
+      }
+      else
+      {
+        maximum = std::max(value2, maximum);
+        minimum = std::min(value1, minimum);
+      }
+    }
+    it.NextLine();
+  }
+  return { minimum, maximum };
+}
+
+template <typename TImage>
+typename TImage::Pointer
+ShiftScaleReference(const TImage * input, double shift, double scale)
+{
+  using PixelType = typename TImage::PixelType;
+
+  auto output = TImage::New();
+  output->SetRegions(input->GetBufferedRegion());
+  output->Allocate();
+
+  itk::ImageScanlineConstIterator<TImage> it(input, input->GetBufferedRegion());
+  itk::ImageScanlineIterator<TImage>      ot(output, output->GetBufferedRegion());
+  while (!it.IsAtEnd())
+  {
+    while (!it.IsAtEndOfLine())
+    {
+      const double value = (static_cast<double>(it.Get()) + shift) * scale;
+      if (value < itk::NumericTraits<PixelType>::NonpositiveMin())
+      {
+        ot.Set(itk::NumericTraits<PixelType>::NonpositiveMin());
+      }
+      else if (value > static_cast<double>(itk::NumericTraits<PixelType>::max()))
+      {
+        ot.Set(itk::NumericTraits<PixelType>::max());
+      }
+      else
+      {
+        ot.Set(static_cast<PixelType>(value));
+      }
+      ++it;
+      ++ot;
+    }
+    it.NextLine();
+    ot.NextLine();
+  }
+  return output;
+}
+
+template <typename TImage>
+bool
+AreEqual(const TImage * image, const TImage * reference, const typename TImage::RegionType & region)
+{
+  itk::ImageRegionConstIterator<TImage> imageIt(image, region);
+  itk::ImageRegionConstIterator<TImage> referenceIt(reference, region);
+  for (; !imageIt.IsAtEnd(); ++imageIt, ++referenceIt)
+  {
+    if (imageIt.Get() != referenceIt.Get())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename TPixel>
+bool
+BenchmarkPixelType(const std::string &            pixelName,
+                   itk::SizeValueType             imageSize,
+                   unsigned int                   numberOfIterations,
+                   itk::TimeProbesCollectorBase & timeProbes)
+{
+  using ImageType = itk::Image<TPixel, Dimension>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  source->SetSize(ImageType::SizeType::Filled(imageSize));
+  source->SetMin(-1000);
+  source->SetMax(1000);
+  source->Update();
+  const ImageType * input = source->GetOutput();
+
+  bool success = true;
+
+  // A single work unit, like the reference loops.
+  auto statistics = itk::StatisticsImageFilter<ImageType>::New();
+  statistics->SetInput(input);
+  statistics->SetNumberOfWorkUnits(1);
+  auto minimumMaximum = itk::MinimumMaximumImageFilter<ImageType>::New();
+  minimumMaximum->SetInput(input);
+  minimumMaximum->SetNumberOfWorkUnits(1);
+  auto shiftScale = itk::ShiftScaleImageFilter<ImageType, ImageType>::New();
+  shiftScale->SetInput(input);
+  shiftScale->SetNumberOfWorkUnits(1);
+  shiftScale->SetShift(100.0);
+  shiftScale->SetScale(20.0);
+
+  const std::string statisticsName = pixelName + " Statistics";
+  const std::string minimumMaximumName = pixelName + " MinimumMaximum";
+  const std::string shiftScaleName = pixelName + " ShiftScale";
+  for (unsigned int i = 0; i < numberOfIterations; ++i)
+  {
+    statistics->Modified();
+    timeProbes.Start((statisticsName + " Span").c_str());
+    statistics->Update();
+    timeProbes.Stop((statisticsName + " Span").c_str());
+
+    minimumMaximum->Modified();
+    timeProbes.Start((minimumMaximumName + " Span").c_str());
+    minimumMaximum->Update();
+    timeProbes.Stop((minimumMaximumName + " Span").c_str());
+
+    shiftScale->Modified();
+    timeProbes.Start((shiftScaleName + " Span").c_str());
+    shiftScale->Update();
+    timeProbes.Stop((shiftScaleName + " Span").c_str());
+  }
+
+  for (unsigned int i = 0; i < numberOfIterations; ++i)
+  {
+    timeProbes.Start((statisticsName + " Scanline").c_str());
+    const ReferenceStatistics<ImageType> reference(input);
+    timeProbes.Stop((statisticsName + " Scanline").c_str());
+
+    timeProbes.Start((minimumMaximumName + " Scanline").c_str());
+    const auto minimumMaximumReference = ReferenceMinimumMaximum(input);
+    timeProbes.Stop((minimumMaximumName + " Scanline").c_str());
+
+    if (statistics->GetMinimum() != reference.Minimum || statistics->GetMaximum() != reference.Maximum ||
+        minimumMaximum->GetMinimum() != minimumMaximumReference.first ||
+        minimumMaximum->GetMaximum() != minimumMaximumReference.second)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << pixelName << " minimum and maximum differ from the scanline loop." << std::endl;
+      success = false;
+    }
+    // The threads of the filter sum different parts of the image.
+    if (std::abs(statistics->GetSum() - reference.Sum) > 1e-9 * reference.SumOfSquares)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << pixelName << " sum " << statistics->GetSum() << " differs from " << reference.Sum << std::endl;
+      success = false;
+    }
+  }
+
+  typename ImageType::Pointer shiftScaleReference;
+  for (unsigned int i = 0; i < numberOfIterations; ++i)
+  {
+    timeProbes.Start((shiftScaleName + " Scanline").c_str());
+    shiftScaleReference = ShiftScaleReference(input, 100.0, 20.0);
+    timeProbes.Stop((shiftScaleName + " Scanline").c_str());
+  }
+  if (!AreEqual<ImageType>(shiftScale->GetOutput(), shiftScaleReference, input->GetBufferedRegion()))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << shiftScaleName << " differs from the scanline loop." << std::endl;
+    success = false;
+  }
+
+  // The cropped region is not contiguous in the buffer of the input.
+  typename ImageType::RegionType cropped = input->GetBufferedRegion();
+  cropped.ShrinkByRadius(1);
+  shiftScale->Modified();
+  shiftScale->GetOutput()->SetRequestedRegion(cropped);
+  shiftScale->Update();
+  if (!AreEqual<ImageType>(shiftScale->GetOutput(), shiftScaleReference, cropped))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << shiftScaleName << " differs from the scanline loop in a cropped region." << std::endl;
+    success = false;
+  }
+  return success;
+}
+} // namespace
+
+int
+itkPixelSpanBenchmarkTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " imageSize [numberOfIterations]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto         imageSize = static_cast<itk::SizeValueType>(std::stoul(argv[1]));
+  const unsigned int numberOfIterations = (argc > 2) ? std::stoul(argv[2]) : 5;
+
+  itk::TimeProbesCollectorBase timeProbes;
+  bool                         success = true;
+  success &= BenchmarkPixelType<float>("float", imageSize, numberOfIterations, timeProbes);
+  success &= BenchmarkPixelType<short>("int16", imageSize, numberOfIterations, timeProbes);
+
+  timeProbes.Report(std::cout);
+
+  if (!success)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -134,11 +134,11 @@ protected:
   }
 
   void
-  GenerateData() override
+  BeforeThreadedGenerateData() override
   {
     this->GetFunctor().m_ForegroundValue = m_ForegroundValue;
     this->GetFunctor().m_BackgroundValue = m_BackgroundValue;
-    Superclass::GenerateData();
+    Superclass::BeforeThreadedGenerateData();
   }
 
 private:
@@ -143,6 +143,24 @@ public:
                  // no way this couldn't be true.
   }
 
+  /** Forward the type independent in-place control of ProcessObject to
+   * CanRunInPlace() and to the InPlace flag. */
+  bool
+  SupportsInPlaceExecution() const override
+  {
+    return this->CanRunInPlace();
+  }
+  void
+  SetInPlaceExecution(bool inPlace) override
+  {
+    this->SetInPlace(inPlace);
+  }
+  bool
+  GetInPlaceExecution() const override
+  {
+    return this->m_InPlace;
+  }
+
 protected:
   InPlaceLabelMapFilter() = default;
   ~InPlaceLabelMapFilter() override = default;
@@ -0,0 +1,56 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkBinaryNotImageFilter.h"
+#include "itkFusedPixelwiseImageFilter.h"
+#include "itkImageBufferRange.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+
+// The foreground and background values are used by the fused filter, which
+// does not call the GenerateData() of the fused filters.
+TEST(BinaryNotImageFilter, FusesWithItsForegroundAndBackgroundValues)
+{
+  using ImageType = itk::Image<unsigned char, 2>;
+
+  auto input = ImageType::New();
+  input->SetRegions(ImageType::SizeType{ { 32, 16 } });
+  input->AllocateInitialized();
+  input->SetPixel({ { 3, 4 } }, 200);
+  input->SetPixel({ { 31, 15 } }, 7);
+
+  auto binaryNot = itk::BinaryNotImageFilter<ImageType>::New();
+  binaryNot->SetInput(input);
+  binaryNot->SetForegroundValue(200);
+  binaryNot->SetBackgroundValue(7);
+
+  auto fused = itk::FusedPixelwiseImageFilter<ImageType, ImageType>::New();
+  fused->SetLastFilter(binaryNot);
+  fused->Update();
+  ASSERT_EQ(fused->GetNumberOfFusedFilters(), 1u);
+
+  binaryNot->Update();
+  const itk::ImageBufferRange<const ImageType> fusedRange(*fused->GetOutput());
+  const itk::ImageBufferRange<const ImageType> range(*binaryNot->GetOutput());
+  EXPECT_TRUE(std::equal(fusedRange.cbegin(), fusedRange.cend(), range.cbegin(), range.cend()));
+  EXPECT_EQ(fused->GetOutput()->GetPixel({ { 3, 4 } }), 7);
+  EXPECT_EQ(fused->GetOutput()->GetPixel({ { 31, 15 } }), 200);
+  EXPECT_EQ(fused->GetOutput()->GetPixel({ { 0, 0 } }), 200);
+}
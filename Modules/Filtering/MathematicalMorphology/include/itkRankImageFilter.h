@@ -47,6 +47,10 @@ namespace itk
  * This filter is based on the sliding window code from the
  * consolidatedMorphology package on InsightJournal.
  *
+ * When the kernel is a box, and the pixels are scalars, the ranks are
+ * computed by a SlidingWindowRank, whose histogram has tiers of bins rather
+ * than being a map of the pixel values.
+ *
  * The structuring element is assumed to be composed of binary
  * values (zero or one). Only elements of the structuring element
  * having values > 0 are candidates for affecting the center pixel.
@@ -58,7 +62,7 @@ namespace itk
  * https://www.insight-journal.org/browse/publication/160
  *
  *
- * \sa MedianImageFilter
+ * \sa MedianImageFilter, SlidingWindowRank
  *
  * \author Richard Beare
  * \ingroup ITKMathematicalMorphology
@@ -136,6 +140,9 @@ protected:
   void
   ConfigureHistogram(HistogramType & histogram) override;
 
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+
 private:
   float m_Rank{};
 }; // end of class
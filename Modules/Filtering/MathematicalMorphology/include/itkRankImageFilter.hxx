@@ -22,6 +22,8 @@
 #include "itkOffset.h"
 #include "itkProgressReporter.h"
 #include "itkNumericTraits.h"
+#include "itkSlidingWindowRank.h"
+#include "itkTotalProgressReporter.h"
 
 #include "itkImageRegionIterator.h"
 #include "itkImageLinearConstIteratorWithIndex.h"
@@ -53,6 +55,37 @@ RankImageFilter<TInputImage, TOutputImage, TKernel>::ConfigureHistogram(Histogra
   histogram.SetRank(m_Rank);
 }
 
+template <typename TInputImage, typename TOutputImage, typename TKernel>
+void
+RankImageFilter<TInputImage, TOutputImage, TKernel>::DynamicThreadedGenerateData(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  if constexpr (HasPixelArrayBuffer<InputImageType> && std::is_arithmetic_v<InputPixelType>)
+  {
+    // A box kernel, all of whose pixels are in the neighborhood, in an input
+    // whose neighborhoods are cropped at the buffered region.
+    const InputImageType * input = this->GetInput();
+    if (this->m_KernelOffsets.size() == this->GetKernel().Size() &&
+        input->GetBufferedRegion() == input->GetRequestedRegion())
+    {
+      OutputImageType *     output = this->GetOutput();
+      TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
+
+      SlidingWindowRank<InputImageType> slidingWindowRank;
+      slidingWindowRank.Compute(*input, outputRegionForThread, this->GetKernel().GetRadius(), m_Rank, true);
+
+      auto value = slidingWindowRank.GetValues().cbegin();
+      for (ImageRegionIterator<OutputImageType> it(output, outputRegionForThread); !it.IsAtEnd(); ++it, ++value)
+      {
+        it.Set(static_cast<OutputPixelType>(*value));
+      }
+      progress.Completed(outputRegionForThread.GetNumberOfPixels());
+      return;
+    }
+  }
+  Superclass::DynamicThreadedGenerateData(outputRegionForThread);
+}
+
 template <typename TInputImage, typename TOutputImage, typename TKernel>
 void
 RankImageFilter<TInputImage, TOutputImage, TKernel>::PrintSelf(std::ostream & os, Indent indent) const
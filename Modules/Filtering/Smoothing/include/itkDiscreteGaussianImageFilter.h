@@ -316,6 +316,13 @@ public:
   itkLegacyMacro(unsigned int GetInternalNumberOfStreamDivisions() const);
   itkLegacyMacro(void SetInternalNumberOfStreamDivisions(unsigned int));
 
+  /** The filter can be restored from the PipelineResultCache when it uses
+   * the default boundary conditions, which have no parameters. */
+  bool
+  CanUseResultCache() const override;
+  void
+  PrintResultCacheParameters(std::ostream & os) const override;
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
 
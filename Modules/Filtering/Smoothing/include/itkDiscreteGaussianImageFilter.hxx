@@ -232,6 +232,7 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
     singleFilter->SetOperator(oper[0]);
     singleFilter->SetInput(localInput);
     singleFilter->OverrideBoundaryCondition(m_InputBoundaryCondition);
+    singleFilter->GetMultiThreader()->SetImageRegionSplitter(this->GetMultiThreader()->GetImageRegionSplitter());
     progress->RegisterInternalFilter(singleFilter, 1.0f / m_FilterDimensionality);
 
     // Graft this filters output onto the mini-pipeline so the mini-pipeline
@@ -259,6 +260,7 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
     firstFilter->ReleaseDataFlagOn();
     firstFilter->SetInput(localInput);
     firstFilter->OverrideBoundaryCondition(m_InputBoundaryCondition);
+    firstFilter->GetMultiThreader()->SetImageRegionSplitter(this->GetMultiThreader()->GetImageRegionSplitter());
     progress->RegisterInternalFilter(firstFilter, 1.0f / numberOfStages);
 
     // Middle filters convolves from real to real
@@ -272,6 +274,7 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
         f->ReleaseDataFlagOn();
 
         f->OverrideBoundaryCondition(m_RealBoundaryCondition);
+        f->GetMultiThreader()->SetImageRegionSplitter(this->GetMultiThreader()->GetImageRegionSplitter());
         progress->RegisterInternalFilter(f, 1.0f / numberOfStages);
 
         if (i == 1)
@@ -292,6 +295,7 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
     LastFilterPointer lastFilter = LastFilterType::New();
     lastFilter->SetOperator(oper[filterDimensionality - 1]);
     lastFilter->OverrideBoundaryCondition(m_RealBoundaryCondition);
+    lastFilter->GetMultiThreader()->SetImageRegionSplitter(this->GetMultiThreader()->GetImageRegionSplitter());
     if (filterDimensionality > 2)
     {
       lastFilter->SetInput(intermediateFilters[filterDimensionality - 3]->GetOutput());
@@ -335,6 +339,27 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::SetInternalNumberOfStrea
 }
 #endif
 
+template <typename TInputImage, typename TOutputImage>
+bool
+DiscreteGaussianImageFilter<TInputImage, TOutputImage>::CanUseResultCache() const
+{
+  return m_InputBoundaryCondition == &m_InputDefaultBoundaryCondition &&
+         m_RealBoundaryCondition == &m_RealDefaultBoundaryCondition;
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+DiscreteGaussianImageFilter<TInputImage, TOutputImage>::PrintResultCacheParameters(std::ostream & os) const
+{
+  Superclass::PrintResultCacheParameters(os);
+
+  os << "Variance: " << m_Variance << std::endl;
+  os << "MaximumError: " << m_MaximumError << std::endl;
+  os << "MaximumKernelWidth: " << m_MaximumKernelWidth << std::endl;
+  os << "FilterDimensionality: " << m_FilterDimensionality << std::endl;
+  os << "UseImageSpacing: " << m_UseImageSpacing << std::endl;
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 DiscreteGaussianImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
@@ -151,6 +151,14 @@ public:
 
   itkGetConstMacro(KernelImage, typename RealImageType::Pointer);
 
+  /** The filter is not restored from the PipelineResultCache, as the kernel
+   * image is computed by its execution. */
+  bool
+  CanUseResultCache() const override
+  {
+    return false;
+  }
+
 protected:
   FFTDiscreteGaussianImageFilter() = default;
   ~FFTDiscreteGaussianImageFilter() override = default;
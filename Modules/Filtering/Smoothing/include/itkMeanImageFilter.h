@@ -36,6 +36,10 @@ namespace itk
  *
  * A mean filter is one of the family of linear filters.
  *
+ * For scalar pixels, the sums of the neighborhoods are computed by a
+ * SlidingWindowMoments, in constant time per pixel whatever the radius.
+ *
+ * \sa SlidingWindowMoments
  * \sa Image
  * \sa Neighborhood
  * \sa NeighborhoodOperator
@@ -108,6 +112,14 @@ protected:
   DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
+  /** Processes the non-boundary region of an image whose buffer is an array of
+   * pixels, with a ConstInteriorNeighborhoodIterator. */
+  static void
+  GenerateDataInNonBoundaryRegion(const TInputImage &                      inputImage,
+                                  TOutputImage &                           outputImage,
+                                  const ImageRegion<InputImageDimension> & imageRegion,
+                                  const InputSizeType &                    radius);
+
   template <typename TPixelAccessPolicy, typename TPixelType>
   static void
   GenerateDataInSubregion(const TInputImage &                              inputImage,
@@ -19,12 +19,14 @@
 #define itkMeanImageFilter_hxx
 
 #include "itkBufferedImageNeighborhoodPixelAccessPolicy.h"
+#include "itkConstInteriorNeighborhoodIterator.h"
 #include "itkImageNeighborhoodOffsets.h"
 #include "itkImageRegionRange.h"
 #include "itkIndexRange.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkOffset.h"
 #include "itkShapedImageNeighborhoodRange.h"
+#include "itkSlidingWindowMoments.h"
 #include "itkDefaultConvertPixelTraits.h"
 
 namespace itk
@@ -45,19 +47,45 @@ MeanImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 
   const auto radius = this->GetRadius();
 
+  if constexpr (std::is_arithmetic_v<InputRealType>)
+  {
+    // The sums of the neighborhoods, with a zero flux Neumann boundary
+    // condition, are updated from one pixel to the next.
+    SlidingWindowMoments<InputImageType, InputRealType> moments;
+    moments.Compute(*input, outputRegionForThread, radius);
+
+    SizeValueType i = 0;
+    for (auto & outputPixel : ImageRegionRange<OutputImageType>(*output, outputRegionForThread))
+    {
+      outputPixel = static_cast<OutputPixelType>(moments.GetMean(i));
+      ++i;
+    }
+    return;
+  }
+
   // Find the data-set boundary "faces" and the center non-boundary subregion.
   const auto calculatorResult =
     NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::Compute(*input, outputRegionForThread, radius);
 
   const auto neighborhoodOffsets = GenerateRectangularImageNeighborhoodOffsets<InputImageDimension>(radius);
 
-  // Process the non-boundary subregion, using a faster pixel access policy without boundary extrapolation.
-  GenerateDataInSubregion<BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
-    *input,
-    *output,
-    calculatorResult.GetNonBoundaryRegion(),
-    neighborhoodOffsets,
-    static_cast<InputPixelType *>(nullptr));
+  // Process the non-boundary subregion without boundary extrapolation: at precomputed offsets in an array of pixels,
+  // or using a faster pixel access policy.
+  using InputPixelValueType = typename NumericTraits<InputPixelType>::ValueType;
+  if constexpr (HasPixelArrayBuffer<InputImageType> &&
+                !std::is_same_v<InputPixelType, VariableLengthVector<InputPixelValueType>>)
+  {
+    GenerateDataInNonBoundaryRegion(*input, *output, calculatorResult.GetNonBoundaryRegion(), radius);
+  }
+  else
+  {
+    GenerateDataInSubregion<BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
+      *input,
+      *output,
+      calculatorResult.GetNonBoundaryRegion(),
+      neighborhoodOffsets,
+      static_cast<InputPixelType *>(nullptr));
+  }
 
   // Process each of the boundary faces. These are N-d regions which border
   // the edge of the buffer.
@@ -69,6 +97,37 @@ MeanImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 }
 
 
+template <typename TInputImage, typename TOutputImage>
+void
+MeanImageFilter<TInputImage, TOutputImage>::GenerateDataInNonBoundaryRegion(
+  const TInputImage &                      inputImage,
+  TOutputImage &                           outputImage,
+  const ImageRegion<InputImageDimension> & imageRegion,
+  const InputSizeType &                    radius)
+{
+  ConstInteriorNeighborhoodIterator<InputImageType> neighborhoodIt(radius, &inputImage, imageRegion);
+
+  const SizeValueType numberOfNeighbors = neighborhoodIt.Size();
+  const auto          neighborhoodSize = static_cast<double>(numberOfNeighbors);
+
+  auto outputIterator = ImageRegionRange<OutputImageType>(outputImage, imageRegion).begin();
+
+  for (; !neighborhoodIt.IsAtEnd(); ++neighborhoodIt)
+  {
+    auto sum = InputRealType{};
+
+    for (SizeValueType i = 0; i < numberOfNeighbors; ++i)
+    {
+      sum += static_cast<InputRealType>(neighborhoodIt.GetPixel(i));
+    }
+
+    // get the mean value
+    *outputIterator = static_cast<typename OutputImageType::PixelType>(sum / neighborhoodSize);
+    ++outputIterator;
+  }
+}
+
+
 template <typename TInputImage, typename TOutputImage>
 template <typename TPixelAccessPolicy, typename TPixelType>
 void
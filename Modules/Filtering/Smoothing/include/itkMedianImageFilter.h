@@ -36,6 +36,11 @@ namespace itk
  * This filter requires that the input pixel type provides an operator<()
  * (LessThan Comparable).
  *
+ * For scalar pixels, the medians are computed by a SlidingWindowRank, whose
+ * histogram slides from one pixel to the next, rather than by sorting each
+ * neighborhood.
+ *
+ * \sa SlidingWindowRank
  * \sa Image
  * \sa Neighborhood
  * \sa NeighborhoodOperator
@@ -84,6 +89,19 @@ public:
 
   using InputSizeType = typename InputImageType::SizeType;
 
+  /** The filter can be restored from the PipelineResultCache. */
+  bool
+  CanUseResultCache() const override
+  {
+    return true;
+  }
+  void
+  PrintResultCacheParameters(std::ostream & os) const override
+  {
+    Superclass::PrintResultCacheParameters(os);
+    os << "Radius: " << this->GetRadius() << std::endl;
+  }
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(SameDimensionCheck, (Concept::SameDimension<InputImageDimension, OutputImageDimension>));
@@ -19,12 +19,14 @@
 #define itkMedianImageFilter_hxx
 
 #include "itkBufferedImageNeighborhoodPixelAccessPolicy.h"
+#include "itkConstInteriorNeighborhoodIterator.h"
 #include "itkImageNeighborhoodOffsets.h"
 #include "itkImageRegionRange.h"
 #include "itkIndexRange.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkOffset.h"
 #include "itkShapedImageNeighborhoodRange.h"
+#include "itkSlidingWindowRank.h"
 #include "itkTotalProgressReporter.h"
 
 #include <vector>
@@ -50,6 +52,25 @@ MedianImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 
   const auto radius = this->GetRadius();
 
+  TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
+
+  if constexpr (HasPixelArrayBuffer<InputImageType> && std::is_arithmetic_v<InputPixelType>)
+  {
+    // The neighborhoods, with a zero flux Neumann boundary condition, are
+    // counted in a histogram sliding from one pixel to the next.
+    SlidingWindowRank<InputImageType> slidingWindowRank;
+    slidingWindowRank.Compute(*input, outputRegionForThread, radius, 0.5f);
+
+    auto median = slidingWindowRank.GetValues().cbegin();
+    for (auto & outputPixel : ImageRegionRange<OutputImageType>(*output, outputRegionForThread))
+    {
+      outputPixel = static_cast<OutputPixelType>(*median);
+      ++median;
+    }
+    progress.Completed(outputRegionForThread.GetNumberOfPixels());
+    return;
+  }
+
   // Find the data-set boundary "faces" and the center non-boundary subregion.
   const auto calculatorResult =
     NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::Compute(*input, outputRegionForThread, radius);
@@ -62,26 +83,44 @@ MedianImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   std::vector<InputPixelType> pixels(neighborhoodSize);
   const auto                  medianIterator = pixels.begin() + (neighborhoodSize / 2);
 
-
-  TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
-
   const auto nonBoundaryRegion = calculatorResult.GetNonBoundaryRegion();
   if (!nonBoundaryRegion.GetSize().empty())
   {
-    // Process the non-boundary subregion, using a faster pixel access policy without boundary extrapolation.
-    auto neighborhoodRange =
-      ShapedImageNeighborhoodRange<const InputImageType, BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
-        *input, Index<InputImageDimension>(), neighborhoodOffsets);
     auto outputIterator = ImageRegionRange<OutputImageType>(*output, nonBoundaryRegion).begin();
 
-    for (const auto & index : ImageRegionIndexRange<InputImageDimension>(nonBoundaryRegion))
+    if constexpr (HasPixelArrayBuffer<InputImageType>)
     {
-      neighborhoodRange.SetLocation(index);
-      std::copy_n(neighborhoodRange.cbegin(), neighborhoodSize, pixels.begin());
-      std::nth_element(pixels.begin(), medianIterator, pixels.end());
-      *outputIterator = *medianIterator;
-      ++outputIterator;
-      progress.CompletedPixel();
+      // Process the non-boundary subregion at precomputed offsets in the buffer, without boundary extrapolation.
+      for (ConstInteriorNeighborhoodIterator<InputImageType> neighborhoodIt(radius, input, nonBoundaryRegion);
+           !neighborhoodIt.IsAtEnd();
+           ++neighborhoodIt)
+      {
+        for (SizeValueType i = 0; i < neighborhoodSize; ++i)
+        {
+          pixels[i] = neighborhoodIt.GetPixel(i);
+        }
+        std::nth_element(pixels.begin(), medianIterator, pixels.end());
+        *outputIterator = *medianIterator;
+        ++outputIterator;
+        progress.CompletedPixel();
+      }
+    }
+    else
+    {
+      // Process the non-boundary subregion, using a faster pixel access policy without boundary extrapolation.
+      auto neighborhoodRange =
+        ShapedImageNeighborhoodRange<const InputImageType, BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
+          *input, Index<InputImageDimension>(), neighborhoodOffsets);
+
+      for (const auto & index : ImageRegionIndexRange<InputImageDimension>(nonBoundaryRegion))
+      {
+        neighborhoodRange.SetLocation(index);
+        std::copy_n(neighborhoodRange.cbegin(), neighborhoodSize, pixels.begin());
+        std::nth_element(pixels.begin(), medianIterator, pixels.end());
+        *outputIterator = *medianIterator;
+        ++outputIterator;
+        progress.CompletedPixel();
+      }
     }
   }
 
@@ -138,6 +138,15 @@ public:
   bool
   CanRunInPlace() const override;
 
+  /** The filter can be restored from the PipelineResultCache. */
+  bool
+  CanUseResultCache() const override
+  {
+    return true;
+  }
+  void
+  PrintResultCacheParameters(std::ostream & os) const override;
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   // This concept does not work with variable length vector images
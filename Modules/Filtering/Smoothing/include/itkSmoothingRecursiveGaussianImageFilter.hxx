@@ -263,6 +263,16 @@ SmoothingRecursiveGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
 }
 
 
+template <typename TInputImage, typename TOutputImage>
+void
+SmoothingRecursiveGaussianImageFilter<TInputImage, TOutputImage>::PrintResultCacheParameters(std::ostream & os) const
+{
+  Superclass::PrintResultCacheParameters(os);
+
+  os << "NormalizeAcrossScale: " << m_NormalizeAcrossScale << std::endl;
+  os << "Sigma: " << m_Sigma << std::endl;
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 SmoothingRecursiveGaussianImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
@@ -14,5 +14,8 @@ itk_module(
   TEST_DEPENDS
   ITKConvolution
   ITKTestKernel
+  ITKThresholding
   DESCRIPTION
   "${DOCUMENTATION}")
+
+# Extra test dependency on ITKThresholding is introduced by itkNUMAFirstTouchBenchmarkTest.
@@ -0,0 +1,128 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkConstNeighborhoodIterator.h"
+#include "itkMedianImageFilter.h"
+#include "itkRandomImageSource.h"
+#include "itkTimeProbesCollectorBase.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+#include <string>
+
+// Measures the time of MedianImageFilter for radii from 1 to maxRadius, on 3D
+// images of unsigned char, short and float pixels. Checks its medians at a
+// sample of the pixels against the medians of the neighborhoods of a
+// ConstNeighborhoodIterator.
+//
+// Usage: itkMedianImageFilterBenchmarkTest imageSize maxRadius [numberOfIterations]
+// The images are cubes of imageSize^3 pixels.
+
+namespace
+{
+template <typename TPixel>
+bool
+BenchmarkPixelType(const std::string &            pixelName,
+                   itk::SizeValueType             imageSize,
+                   unsigned int                   maxRadius,
+                   unsigned int                   numberOfIterations,
+                   itk::TimeProbesCollectorBase & timeProbes)
+{
+  constexpr unsigned int Dimension = 3;
+  using ImageType = itk::Image<TPixel, Dimension>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  source->SetSize(ImageType::SizeType::Filled(imageSize));
+  source->SetMin(0);
+  source->SetMax(std::is_same_v<TPixel, unsigned char> ? 255 : 4000);
+  source->Update();
+  const ImageType * input = source->GetOutput();
+
+  auto median = itk::MedianImageFilter<ImageType, ImageType>::New();
+  median->SetInput(input);
+  median->SetNumberOfWorkUnits(1);
+
+  bool success = true;
+  for (unsigned int radius = 1; radius <= maxRadius; ++radius)
+  {
+    median->SetRadius(radius);
+    const std::string probeName = pixelName + " Median radius " + std::to_string(radius);
+    for (unsigned int i = 0; i < numberOfIterations; ++i)
+    {
+      median->Modified();
+      timeProbes.Start(probeName.c_str());
+      median->Update();
+      timeProbes.Stop(probeName.c_str());
+    }
+
+    std::vector<TPixel>                       pixels;
+    itk::ConstNeighborhoodIterator<ImageType> it(median->GetRadius(), input, input->GetBufferedRegion());
+    for (itk::SizeValueType i = 0; !it.IsAtEnd(); ++it, ++i)
+    {
+      if (i % 97 != 0)
+      {
+        continue;
+      }
+      pixels.resize(it.Size());
+      for (itk::SizeValueType n = 0; n < it.Size(); ++n)
+      {
+        pixels[n] = it.GetPixel(n);
+      }
+      std::nth_element(pixels.begin(), pixels.begin() + pixels.size() / 2, pixels.end());
+      if (median->GetOutput()->GetPixel(it.GetIndex()) != pixels[pixels.size() / 2])
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << probeName << ": wrong median at " << it.GetIndex() << std::endl;
+        success = false;
+        break;
+      }
+    }
+  }
+  return success;
+}
+} // namespace
+
+int
+itkMedianImageFilterBenchmarkTest(int argc, char * argv[])
+{
+  if (argc < 3)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " imageSize maxRadius [numberOfIterations]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto         imageSize = static_cast<itk::SizeValueType>(std::stoul(argv[1]));
+  const unsigned int maxRadius = std::stoul(argv[2]);
+  const unsigned int numberOfIterations = (argc > 3) ? std::stoul(argv[3]) : 1;
+
+  itk::TimeProbesCollectorBase timeProbes;
+  bool                         success = true;
+  success &= BenchmarkPixelType<unsigned char>("uchar", imageSize, maxRadius, numberOfIterations, timeProbes);
+  success &= BenchmarkPixelType<short>("short", imageSize, maxRadius, numberOfIterations, timeProbes);
+  success &= BenchmarkPixelType<float>("float", imageSize, maxRadius, numberOfIterations, timeProbes);
+
+  timeProbes.Report(std::cout);
+
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
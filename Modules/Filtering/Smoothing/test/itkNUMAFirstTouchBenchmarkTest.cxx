@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBinaryThresholdImageFilter.h"
+#include "itkImageBufferRange.h"
+#include "itkMeanImageFilter.h"
+#include "itkNUMAPolicy.h"
+#include "itkRandomImageSource.h"
+#include "itkTimeProbesCollectorBase.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+// Compares the throughput of BinaryThresholdImageFilter and MeanImageFilter with
+// and without parallel first touch of the image buffers and NUMA thread pinning,
+// and checks that the settings do not change the results.
+//
+// Usage: itkNUMAFirstTouchBenchmarkTest imageSize [numberOfIterations]
+// The images are cubes of imageSize^3 float pixels.
+
+int
+itkNUMAFirstTouchBenchmarkTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " imageSize [numberOfIterations]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto         imageSize = static_cast<itk::SizeValueType>(std::stoul(argv[1]));
+  const unsigned int numberOfIterations = (argc > 2) ? std::stoul(argv[2]) : 5;
+
+  constexpr unsigned int Dimension = 3;
+  using ImageType = itk::Image<float, Dimension>;
+  using MaskType = itk::Image<unsigned char, Dimension>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  source->SetSize(ImageType::SizeType::Filled(imageSize));
+  source->SetMin(0.0);
+  source->SetMax(1000.0);
+
+  auto threshold = itk::BinaryThresholdImageFilter<ImageType, MaskType>::New();
+  threshold->SetInput(source->GetOutput());
+  threshold->SetLowerThreshold(250.0f);
+  threshold->SetUpperThreshold(750.0f);
+
+  auto mean = itk::MeanImageFilter<ImageType, ImageType>::New();
+  mean->SetInput(source->GetOutput());
+  mean->SetRadius(1);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(source->Update());
+
+  const bool                   defaultFirstTouch = itk::NUMAPolicy::GetGlobalDefaultFirstTouch();
+  const bool                   defaultThreadPinning = itk::NUMAPolicy::GetGlobalDefaultThreadPinning();
+  itk::TimeProbesCollectorBase timeProbes;
+  MaskType::Pointer            referenceMask;
+  ImageType::Pointer           referenceMean;
+  bool                         success = true;
+
+  std::cout << "Number of NUMA nodes: " << itk::NUMAPolicy::GetNumberOfNodes() << std::endl;
+
+  for (const bool numa : { false, true })
+  {
+    itk::NUMAPolicy::SetGlobalDefaultFirstTouch(numa);
+    itk::NUMAPolicy::SetGlobalDefaultThreadPinning(numa);
+    const std::string mode = numa ? "NUMA" : "Serial";
+
+    for (unsigned int i = 0; i < numberOfIterations; ++i)
+    {
+      // Modified() makes the filters allocate and compute their outputs again.
+      threshold->Modified();
+      timeProbes.Start((mode + " BinaryThreshold").c_str());
+      threshold->Update();
+      timeProbes.Stop((mode + " BinaryThreshold").c_str());
+
+      mean->Modified();
+      timeProbes.Start((mode + " Mean").c_str());
+      mean->Update();
+      timeProbes.Stop((mode + " Mean").c_str());
+    }
+
+    if (!numa)
+    {
+      referenceMask = threshold->GetOutput();
+      referenceMask->DisconnectPipeline();
+      referenceMean = mean->GetOutput();
+      referenceMean->DisconnectPipeline();
+      continue;
+    }
+
+    const itk::ImageBufferRange<const MaskType>  maskRange(*threshold->GetOutput());
+    const itk::ImageBufferRange<const MaskType>  referenceMaskRange(*referenceMask);
+    const itk::ImageBufferRange<const ImageType> meanRange(*mean->GetOutput());
+    const itk::ImageBufferRange<const ImageType> referenceMeanRange(*referenceMean);
+    if (!std::equal(maskRange.cbegin(), maskRange.cend(), referenceMaskRange.cbegin(), referenceMaskRange.cend()) ||
+        !std::equal(meanRange.cbegin(), meanRange.cend(), referenceMeanRange.cbegin(), referenceMeanRange.cend()))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "The outputs differ with first touch and thread pinning enabled." << std::endl;
+      success = false;
+    }
+  }
+
+  itk::NUMAPolicy::SetGlobalDefaultFirstTouch(defaultFirstTouch);
+  itk::NUMAPolicy::SetGlobalDefaultThreadPinning(defaultThreadPinning);
+
+  timeProbes.Report(std::cout);
+
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
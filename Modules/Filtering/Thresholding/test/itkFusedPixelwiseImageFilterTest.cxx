@@ -0,0 +1,192 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBinaryThresholdImageFilter.h"
+#include "itkCastImageFilter.h"
+#include "itkClampImageFilter.h"
+#include "itkFusedPixelwiseImageFilter.h"
+#include "itkImageBufferRange.h"
+#include "itkImageDuplicator.h"
+#include "itkRescaleIntensityImageFilter.h"
+#include "itkShiftScaleImageFilter.h"
+#include "itkTimeProbe.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+// Checks that FusedPixelwiseImageFilter computes the same output as the chain
+// Cast -> ShiftScale -> Clamp -> BinaryThreshold, updates when the chain is
+// modified, and stops at the filters which cannot be fused. Compares the
+// time of the chain and of the fused filter.
+//
+// Usage: itkFusedPixelwiseImageFilterTest [imageSize]
+// The input image is a cube of imageSize^3 short pixels.
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using InputImageType = itk::Image<short, Dimension>;
+using RealImageType = itk::Image<float, Dimension>;
+using CharImageType = itk::Image<unsigned char, Dimension>;
+
+template <typename TImage>
+bool
+HaveSamePixels(const TImage * image, const TImage * reference)
+{
+  const itk::ImageBufferRange<const TImage> range(*image);
+  const itk::ImageBufferRange<const TImage> referenceRange(*reference);
+  return std::equal(range.cbegin(), range.cend(), referenceRange.cbegin(), referenceRange.cend());
+}
+
+// Copies the output, since disconnecting it would modify the filter.
+template <typename TImage>
+typename TImage::Pointer
+UpdateAndCopy(itk::ImageSource<TImage> * filter)
+{
+  filter->Update();
+  auto duplicator = itk::ImageDuplicator<TImage>::New();
+  duplicator->SetInputImage(filter->GetOutput());
+  duplicator->Update();
+  return duplicator->GetOutput();
+}
+} // namespace
+
+int
+itkFusedPixelwiseImageFilterTest(int argc, char * argv[])
+{
+  const itk::SizeValueType imageSize = (argc > 1) ? std::stoul(argv[1]) : 64;
+
+  auto input = InputImageType::New();
+  input->SetRegions(InputImageType::SizeType::Filled(imageSize));
+  input->Allocate();
+  const itk::ImageBufferRange<InputImageType> inputRange(*input);
+  unsigned int                                seed = 12345;
+  for (auto && pixel : inputRange)
+  {
+    seed = seed * 1103515245u + 12345u;
+    pixel = static_cast<short>((seed >> 16) % 2000) - 500;
+  }
+
+  auto cast = itk::CastImageFilter<InputImageType, RealImageType>::New();
+  cast->SetInput(input);
+  auto shiftScale = itk::ShiftScaleImageFilter<RealImageType, CharImageType>::New();
+  shiftScale->SetInput(cast->GetOutput());
+  shiftScale->SetShift(20.0);
+  shiftScale->SetScale(0.25);
+  auto clamp = itk::ClampImageFilter<CharImageType, CharImageType>::New();
+  clamp->SetInput(shiftScale->GetOutput());
+  clamp->SetBounds(20, 200);
+  auto threshold = itk::BinaryThresholdImageFilter<CharImageType, CharImageType>::New();
+  threshold->SetInput(clamp->GetOutput());
+  threshold->SetLowerThreshold(50);
+  threshold->SetUpperThreshold(150);
+  threshold->SetInsideValue(255);
+  threshold->SetOutsideValue(0);
+
+  auto fused = itk::FusedPixelwiseImageFilter<InputImageType, CharImageType>::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(fused, FusedPixelwiseImageFilter, InPlaceImageFilter);
+
+  ITK_TRY_EXPECT_EXCEPTION(fused->Update());
+
+  unsigned int numberOfExecutions = 0;
+  fused->AddObserver(itk::StartEvent(), [&numberOfExecutions](const itk::EventObject &) { ++numberOfExecutions; });
+
+  fused->SetLastFilter(threshold);
+  ITK_TEST_SET_GET_VALUE(threshold.GetPointer(), fused->GetLastFilter());
+  ITK_TRY_EXPECT_NO_EXCEPTION(fused->Update());
+  ITK_TEST_EXPECT_EQUAL(fused->GetNumberOfFusedFilters(), 4);
+  ITK_TEST_EXPECT_EQUAL(numberOfExecutions, 1);
+  ITK_TEST_EXPECT_EQUAL(fused->GetInput(), input.GetPointer());
+
+  // The fused filters are not executed.
+  ITK_TEST_EXPECT_TRUE(cast->GetOutput()->GetBufferPointer() == nullptr);
+  ITK_TEST_EXPECT_TRUE(clamp->GetOutput()->GetBufferPointer() == nullptr);
+  const itk::SizeValueType fusedUnderflowCount = shiftScale->GetUnderflowCount();
+  const itk::SizeValueType fusedOverflowCount = shiftScale->GetOverflowCount();
+
+  CharImageType::Pointer reference = UpdateAndCopy<CharImageType>(threshold);
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<CharImageType>(fused->GetOutput(), reference));
+  ITK_TEST_EXPECT_EQUAL(fusedUnderflowCount, shiftScale->GetUnderflowCount());
+  ITK_TEST_EXPECT_EQUAL(fusedOverflowCount, shiftScale->GetOverflowCount());
+  ITK_TEST_EXPECT_TRUE(shiftScale->GetUnderflowCount() > 0);
+
+  // The fused filter is up to date until a filter of the chain is modified.
+  fused->Update();
+  ITK_TEST_EXPECT_EQUAL(numberOfExecutions, 1);
+  threshold->SetUpperThreshold(100);
+  fused->Update();
+  ITK_TEST_EXPECT_EQUAL(numberOfExecutions, 2);
+  reference = UpdateAndCopy<CharImageType>(threshold);
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<CharImageType>(fused->GetOutput(), reference));
+
+  shiftScale->SetScale(0.5);
+  fused->SetChunkNumberOfPixels(7);
+  ITK_TEST_SET_GET_VALUE(7, fused->GetChunkNumberOfPixels());
+  fused->Update();
+  ITK_TEST_EXPECT_EQUAL(numberOfExecutions, 3);
+  reference = UpdateAndCopy<CharImageType>(threshold);
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<CharImageType>(fused->GetOutput(), reference));
+
+  input->Modified();
+  fused->Update();
+  ITK_TEST_EXPECT_EQUAL(numberOfExecutions, 4);
+
+  // RescaleIntensityImageFilter computes the range of its input first, so that
+  // the chain stops after it.
+  auto rescale = itk::RescaleIntensityImageFilter<InputImageType, CharImageType>::New();
+  rescale->SetInput(input);
+  clamp->SetInput(rescale->GetOutput());
+  auto rescaledFused = itk::FusedPixelwiseImageFilter<CharImageType, CharImageType>::New();
+  rescaledFused->SetLastFilter(threshold);
+  ITK_TRY_EXPECT_NO_EXCEPTION(rescaledFused->Update());
+  ITK_TEST_EXPECT_EQUAL(rescaledFused->GetNumberOfFusedFilters(), 2);
+  ITK_TEST_EXPECT_EQUAL(rescaledFused->GetInput(), rescale->GetOutput());
+  reference = UpdateAndCopy<CharImageType>(threshold);
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<CharImageType>(rescaledFused->GetOutput(), reference));
+
+  // The input type of the fused filter must match the chain.
+  ITK_TRY_EXPECT_EXCEPTION(fused->Update());
+  auto nonFusable = itk::FusedPixelwiseImageFilter<InputImageType, CharImageType>::New();
+  nonFusable->SetLastFilter(rescale);
+  ITK_TRY_EXPECT_EXCEPTION(nonFusable->Update());
+
+  // Timing of the chain and of the fused filter.
+  clamp->SetInput(shiftScale->GetOutput());
+  fused->SetChunkNumberOfPixels(4096);
+  itk::TimeProbe chainProbe;
+  itk::TimeProbe fusedProbe;
+  for (unsigned int i = 0; i < 5; ++i)
+  {
+    cast->Modified();
+    chainProbe.Start();
+    threshold->Update();
+    chainProbe.Stop();
+
+    fused->Modified();
+    fusedProbe.Start();
+    fused->Update();
+    fusedProbe.Stop();
+  }
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<CharImageType>(fused->GetOutput(), threshold->GetOutput()));
+  std::cout << "Chain of filters: " << chainProbe.GetMean() << ' ' << chainProbe.GetUnit() << std::endl;
+  std::cout << "Fused filter: " << fusedProbe.GetMean() << ' ' << fusedProbe.GetUnit() << std::endl;
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -27,6 +27,8 @@
 #include "itkImageRegion.h"
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkSimpleDataObjectDecorator.h"
+#include <future>
+#include <memory>
 
 namespace itk
 {
@@ -118,9 +120,38 @@ public:
   itkGetConstReferenceMacro(UseStreaming, bool);
   itkBooleanMacro(UseStreaming);
 
+  /** Set/Get whether the pixel data is memory mapped from the file, instead
+   * of being read into memory. The data is mapped when the whole image is
+   * read, no pixel conversion is needed, and the ImageIO reports that the
+   * data can be used in place (see ImageIOBase::GetPixelDataLocation()),
+   * for example for uncompressed MetaImage, NRRD, NIfTI and raw files in the
+   * byte order of the machine. It is read otherwise. The pages of the file
+   * are then read lazily, when the pixels are first accessed, which allows
+   * to process images larger than the physical memory. The mapping is copy
+   * on write: modifying the pixels of the output does not modify the file.
+   * Default is off.
+   * \sa MemoryMappedImageContainer */
+  itkSetMacro(UseMemoryMapping, bool);
+  itkGetConstReferenceMacro(UseMemoryMapping, bool);
+  itkBooleanMacro(UseMemoryMapping);
+
+  /** Set/Get whether the next streamed region is read by a separate thread
+   * while the current one is processed downstream. When the requested
+   * regions are streamed, for example by ImageFileWriter or
+   * StreamingImageFilter, the reader predicts the next region from the last
+   * ones (the same shift as between the last two regions, or the next region
+   * along the slowest dimension after the first one), and reads it in the
+   * background into a buffer of one region. The next update uses this buffer
+   * when it reads the predicted region, and reads the file otherwise. The
+   * read ahead is only done when the ImageIO streams the reading. Default is
+   * off. \sa ImageFileWriter::SetWriteBehind() */
+  itkSetMacro(ReadAhead, bool);
+  itkGetConstReferenceMacro(ReadAhead, bool);
+  itkBooleanMacro(ReadAhead);
+
 protected:
   ImageFileReader();
-  ~ImageFileReader() override = default;
+  ~ImageFileReader() override;
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -153,6 +184,24 @@ protected:
   void
   GenerateData() override;
 
+  /** Replaces the buffer of the output by a memory mapping of the pixel data
+   * of the file, when possible. Returns false otherwise. */
+  bool
+  MapOutputBuffer();
+
+  /** Reads the m_ActualIORegion into the buffer, from the data read ahead
+   * when they are of this region. */
+  void
+  ReadActualIORegion(void * buffer);
+
+  /** Starts reading the region predicted to follow m_ActualIORegion. */
+  void
+  StartReadAhead();
+
+  /** Waits for the reading ahead, if any, so that the ImageIO may be used. */
+  void
+  WaitForReadAhead();
+
   ImageIOBase::Pointer m_ImageIO{};
 
   bool m_UserSpecifiedImageIO{}; // keep track whether the
@@ -160,12 +209,22 @@ protected:
 
   bool m_UseStreaming{};
 
+  bool m_UseMemoryMapping{};
+
 private:
   std::string m_ExceptionMessage{};
 
   // The region that the ImageIO class will return when we ask to
   // produce the requested region.
   ImageIORegion m_ActualIORegion{};
+
+  bool m_ReadAhead{ false };
+
+  // The region read before m_ActualIORegion, and the region read ahead.
+  ImageIORegion           m_PreviousIORegion{};
+  ImageIORegion           m_ReadAheadIORegion{};
+  std::unique_ptr<char[]> m_ReadAheadBuffer{};
+  std::future<void>       m_ReadAheadFuture{};
 };
 
 
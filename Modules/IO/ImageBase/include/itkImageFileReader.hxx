@@ -24,10 +24,13 @@
 #include "itkPixelTraits.h"
 #include "itkVectorImage.h"
 #include "itkMetaDataObject.h"
+#include "itkMemoryMappedImageContainer.h"
 
 #include "itksys/SystemTools.hxx"
 #include "itkMakeUniqueForOverwrite.h"
+#include <algorithm>
 #include <fstream>
+#include <type_traits>
 
 namespace itk
 {
@@ -40,6 +43,12 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::ImageFileReader()
   m_UseStreaming = true;
 }
 
+template <typename TOutputImage, typename ConvertPixelTraits>
+ImageFileReader<TOutputImage, ConvertPixelTraits>::~ImageFileReader()
+{
+  this->WaitForReadAhead();
+}
+
 template <typename TOutputImage, typename ConvertPixelTraits>
 void
 ImageFileReader<TOutputImage, ConvertPixelTraits>::PrintSelf(std::ostream & os, Indent indent) const
@@ -50,6 +59,8 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::PrintSelf(std::ostream & os,
 
   os << indent << "UserSpecifiedImageIO: " << (m_UserSpecifiedImageIO ? "On" : "Off") << std::endl;
   os << indent << "UseStreaming: " << (m_UseStreaming ? "On" : "Off") << std::endl;
+  os << indent << "UseMemoryMapping: " << (m_UseMemoryMapping ? "On" : "Off") << std::endl;
+  os << indent << "ReadAhead: " << (m_ReadAhead ? "On" : "Off") << std::endl;
 
   os << indent << "ExceptionMessage: " << m_ExceptionMessage << std::endl;
   os << indent << "ActualIORegion: " << m_ActualIORegion << std::endl;
@@ -72,6 +83,11 @@ template <typename TOutputImage, typename ConvertPixelTraits>
 void
 ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateOutputInformation()
 {
+  // The file may have changed since it was read ahead.
+  this->WaitForReadAhead();
+  m_ReadAheadBuffer.reset();
+  m_PreviousIORegion = ImageIORegion();
+
   typename TOutputImage::Pointer output = this->GetOutput();
 
   itkDebugMacro("Reading file for GenerateOutputInformation()" << this->GetFileName());
@@ -292,6 +308,8 @@ void
 ImageFileReader<TOutputImage, ConvertPixelTraits>::EnlargeOutputRequestedRegion(DataObject * output)
 {
   itkDebugMacro("Starting EnlargeOutputRequestedRegion() ");
+  this->WaitForReadAhead();
+
   typename TOutputImage::Pointer    out = dynamic_cast<TOutputImage *>(output);
   typename TOutputImage::RegionType largestRegion = out->GetLargestPossibleRegion();
   ImageRegionType                   streamableRegion;
@@ -359,6 +377,14 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
                 << "Allocating the buffer with the EnlargedRequestedRegion \n"
                 << output->GetRequestedRegion() << '\n');
 
+  this->WaitForReadAhead();
+
+  if (m_UseMemoryMapping && this->MapOutputBuffer())
+  {
+    this->UpdateProgress(1.0f);
+    return;
+  }
+
   // allocated the output image to the size of the enlarge requested region
   this->AllocateOutputs();
 
@@ -403,7 +429,7 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
                   << m_ImageIO->GetNumberOfComponents());
 
     const auto loadBuffer = make_unique_for_overwrite<char[]>(sizeOfActualIORegion);
-    m_ImageIO->Read(static_cast<void *>(loadBuffer.get()));
+    this->ReadActualIORegion(static_cast<void *>(loadBuffer.get()));
 
     // See note below as to why the buffered region is needed and
     // not actualIORegion
@@ -421,7 +447,7 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
     OutputImagePixelType * outputBuffer = output->GetPixelContainer()->GetBufferPointer();
 
     const auto loadBuffer = make_unique_for_overwrite<char[]>(sizeOfActualIORegion);
-    m_ImageIO->Read(static_cast<void *>(loadBuffer.get()));
+    this->ReadActualIORegion(static_cast<void *>(loadBuffer.get()));
 
     // we use std::copy_n here as it should be optimized to memcpy for
     // plain old data, but still is object oriented programming
@@ -434,12 +460,199 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
     itkDebugMacro("No buffer conversion required.");
 
     OutputImagePixelType * outputBuffer = output->GetPixelContainer()->GetBufferPointer();
-    m_ImageIO->Read(outputBuffer);
+    this->ReadActualIORegion(outputBuffer);
+  }
+
+  if (m_ReadAhead)
+  {
+    this->StartReadAhead();
   }
 
   this->UpdateProgress(1.0f);
 }
 
+template <typename TOutputImage, typename ConvertPixelTraits>
+void
+ImageFileReader<TOutputImage, ConvertPixelTraits>::ReadActualIORegion(void * buffer)
+{
+  // The data read ahead are used when the actual region is a contiguous part
+  // of them: the regions are equal up to a dimension, along which the region
+  // read ahead contains the actual region, and are of size one beyond it.
+  if (m_ReadAheadBuffer && m_ReadAheadIORegion.GetImageDimension() == m_ActualIORegion.GetImageDimension() &&
+      m_ReadAheadIORegion.IsInside(m_ActualIORegion))
+  {
+    const unsigned int dimension = m_ActualIORegion.GetImageDimension();
+    unsigned int       d = 0;
+    SizeValueType      sliceNumberOfPixels = 1;
+    while (d + 1 < dimension && m_ReadAheadIORegion.GetIndex(d) == m_ActualIORegion.GetIndex(d) &&
+           m_ReadAheadIORegion.GetSize(d) == m_ActualIORegion.GetSize(d))
+    {
+      sliceNumberOfPixels *= m_ActualIORegion.GetSize(d);
+      ++d;
+    }
+    bool isContiguous = true;
+    for (unsigned int i = d + 1; i < dimension; ++i)
+    {
+      isContiguous = isContiguous && m_ReadAheadIORegion.GetSize(i) == 1;
+    }
+    if (isContiguous)
+    {
+      itkDebugMacro("Using the data read ahead for " << m_ActualIORegion);
+      const size_t pixelSize = m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents();
+      const size_t offset =
+        (m_ActualIORegion.GetIndex(d) - m_ReadAheadIORegion.GetIndex(d)) * sliceNumberOfPixels * pixelSize;
+      const size_t numberOfBytes = m_ActualIORegion.GetNumberOfPixels() * pixelSize;
+      std::copy_n(m_ReadAheadBuffer.get() + offset, numberOfBytes, static_cast<char *>(buffer));
+      m_ReadAheadBuffer.reset();
+      return;
+    }
+  }
+  m_ReadAheadBuffer.reset();
+  m_ImageIO->Read(buffer);
+}
+
+template <typename TOutputImage, typename ConvertPixelTraits>
+void
+ImageFileReader<TOutputImage, ConvertPixelTraits>::StartReadAhead()
+{
+  const unsigned int dimension = m_ActualIORegion.GetImageDimension();
+  ImageIORegion      largestIORegion(dimension);
+  for (unsigned int i = 0; i < dimension; ++i)
+  {
+    largestIORegion.SetSize(i, i < m_ImageIO->GetNumberOfDimensions() ? m_ImageIO->GetDimensions(i) : 1);
+  }
+
+  // The next region is shifted from the actual one as the actual one from the
+  // previous one, or follows it along the slowest dimension it does not fill.
+  ImageIORegion nextIORegion = m_ActualIORegion;
+  if (m_PreviousIORegion.GetImageDimension() == dimension && m_PreviousIORegion != m_ActualIORegion &&
+      m_PreviousIORegion.GetSize() == m_ActualIORegion.GetSize())
+  {
+    for (unsigned int i = 0; i < dimension; ++i)
+    {
+      nextIORegion.SetIndex(i, 2 * m_ActualIORegion.GetIndex(i) - m_PreviousIORegion.GetIndex(i));
+    }
+  }
+  else
+  {
+    unsigned int d = dimension;
+    while (d > 0 && m_ActualIORegion.GetSize(d - 1) == largestIORegion.GetSize(d - 1))
+    {
+      --d;
+    }
+    if (d == 0)
+    {
+      // The whole image is read: there is nothing to read ahead.
+      return;
+    }
+    nextIORegion.SetIndex(d - 1, m_ActualIORegion.GetIndex(d - 1) + m_ActualIORegion.GetSize(d - 1));
+  }
+  m_PreviousIORegion = m_ActualIORegion;
+
+  for (unsigned int i = 0; i < dimension; ++i)
+  {
+    const IndexValueType start = std::max<IndexValueType>(nextIORegion.GetIndex(i), 0);
+    const IndexValueType end =
+      std::min(nextIORegion.GetIndex(i) + static_cast<IndexValueType>(nextIORegion.GetSize(i)),
+               static_cast<IndexValueType>(largestIORegion.GetSize(i)));
+    if (end <= start)
+    {
+      return;
+    }
+    nextIORegion.SetIndex(i, start);
+    nextIORegion.SetSize(i, static_cast<SizeValueType>(end - start));
+  }
+
+  nextIORegion = m_ImageIO->GenerateStreamableReadRegionFromRequestedRegion(nextIORegion);
+  if (nextIORegion == m_ActualIORegion || nextIORegion.GetImageDimension() != dimension)
+  {
+    return;
+  }
+
+  itkDebugMacro("Reading ahead " << nextIORegion);
+  const size_t pixelSize = m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents();
+  m_ReadAheadIORegion = nextIORegion;
+  m_ReadAheadBuffer = make_unique_for_overwrite<char[]>(nextIORegion.GetNumberOfPixels() * pixelSize);
+  m_ImageIO->SetIORegion(nextIORegion);
+  m_ReadAheadFuture = std::async(std::launch::async, [imageIO = m_ImageIO, buffer = m_ReadAheadBuffer.get()]() {
+    imageIO->Read(buffer);
+  });
+}
+
+template <typename TOutputImage, typename ConvertPixelTraits>
+void
+ImageFileReader<TOutputImage, ConvertPixelTraits>::WaitForReadAhead()
+{
+  if (m_ReadAheadFuture.valid())
+  {
+    try
+    {
+      m_ReadAheadFuture.get();
+    }
+    catch (...)
+    {
+      // The region is read again, and the error reported, if it is requested.
+      m_ReadAheadBuffer.reset();
+    }
+  }
+}
+
+template <typename TOutputImage, typename ConvertPixelTraits>
+bool
+ImageFileReader<TOutputImage, ConvertPixelTraits>::MapOutputBuffer()
+{
+  using PixelContainerType = typename TOutputImage::PixelContainer;
+  using ElementType = typename PixelContainerType::Element;
+
+  // The elements of a mapping are never constructed nor destroyed.
+  if constexpr (std::is_trivially_destructible_v<ElementType>)
+  {
+    TOutputImage *          output = this->GetOutput();
+    const ImageRegionType & region = output->GetRequestedRegion();
+
+    // Only the whole image can be mapped, when it needs no conversion.
+    const IOComponentEnum ioType = ImageIOBase::MapPixelType<typename ConvertPixelTraits::ComponentType>::CType;
+    if (m_ImageIO->GetComponentType() != ioType ||
+        m_ImageIO->GetNumberOfComponents() != ConvertPixelTraits::GetNumberOfComponents() ||
+        m_ActualIORegion.GetNumberOfPixels() != region.GetNumberOfPixels() ||
+        region != output->GetLargestPossibleRegion())
+    {
+      return false;
+    }
+
+    m_ImageIO->SetFileName(this->GetFileName().c_str());
+    m_ImageIO->SetIORegion(m_ActualIORegion);
+
+    std::string   fileName;
+    SizeValueType offset = 0;
+    if (!m_ImageIO->GetPixelDataLocation(fileName, offset))
+    {
+      return false;
+    }
+
+    const SizeValueType numberOfBytes =
+      m_ActualIORegion.GetNumberOfPixels() * m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents();
+    if (numberOfBytes % sizeof(ElementType) != 0)
+    {
+      return false;
+    }
+
+    itkDebugMacro("Memory mapping " << numberOfBytes << " bytes of " << fileName << " from offset " << offset);
+
+    using ContainerType = MemoryMappedImageContainer<typename PixelContainerType::ElementIdentifier, ElementType>;
+    auto container = ContainerType::New();
+    container->MapFile(fileName, offset, numberOfBytes / sizeof(ElementType), MemoryMappedFileEnums::Mode::CopyOnWrite);
+
+    output->SetBufferedRegion(region);
+    output->SetPixelContainer(container);
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
 template <typename TOutputImage, typename ConvertPixelTraits>
 void
 ImageFileReader<TOutputImage, ConvertPixelTraits>::DoConvertBuffer(const void * inputData, size_t numberOfPixels)
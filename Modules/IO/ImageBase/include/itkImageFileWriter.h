@@ -23,6 +23,7 @@
 #include "itkImageIOBase.h"
 #include "itkMacro.h"
 #include "itkMetaProgrammingLibrary.h"
+#include "itkNumericTraits.h"
 
 namespace itk
 {
@@ -172,6 +173,23 @@ public:
   itkSetMacro(NumberOfStreamDivisions, unsigned int);
   itkGetConstReferenceMacro(NumberOfStreamDivisions, unsigned int);
 
+  /** Set/Get whether the pieces are written by a separate thread while the
+   * upstream pipeline computes the next pieces, when the image is streamed
+   * in several pieces. Each piece is copied once the pipeline has computed
+   * it, and queued for writing, so that the file writing overlaps the
+   * computation, as well as the reading of the next piece when the reader
+   * reads ahead (see ImageFileReader::SetReadAhead()). Default is off.
+   * \sa SetMaximumNumberOfPiecesInFlight() */
+  itkSetMacro(WriteBehind, bool);
+  itkGetConstReferenceMacro(WriteBehind, bool);
+  itkBooleanMacro(WriteBehind);
+
+  /** Set/Get the maximum number of computed pieces waiting to be written,
+   * which bounds the memory used by WriteBehind. The pipeline waits for the
+   * writing of a piece when this number is reached. Default is 2. */
+  itkSetClampMacro(MaximumNumberOfPiecesInFlight, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstReferenceMacro(MaximumNumberOfPiecesInFlight, unsigned int);
+
   /** Aliased to the Write() method to be consistent with the rest of the
    * pipeline. */
   void
@@ -224,6 +242,13 @@ protected:
   GenerateData() override;
 
 private:
+  /** Streams the pieces of the paste region, each piece being written by a
+   * separate thread while the next ones are computed. */
+  void
+  WriteBehindPieces(unsigned int          numDivisions,
+                    const ImageIORegion & pasteIORegion,
+                    const ImageIORegion & largestIORegion);
+
   std::string m_FileName{};
 
   ImageIOBase::Pointer m_ImageIO{};
@@ -237,6 +262,9 @@ private:
   bool m_UseCompression{ false };
   int  m_CompressionLevel{ -1 };
   bool m_UseInputMetaDataDictionary{ true };
+
+  bool         m_WriteBehind{ false };
+  unsigned int m_MaximumNumberOfPiecesInFlight{ 2 };
 };
 
 
@@ -32,6 +32,11 @@
 #include "itkMatrix.h"
 #include "itkImageAlgorithm.h"
 #include <complex>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 namespace itk
 {
@@ -254,6 +259,15 @@ ImageFileWriter<TInputImage>::Write()
   numDivisions =
     m_ImageIO->GetActualNumberOfSplitsForWriting(m_NumberOfStreamDivisions, pasteIORegion, largestIORegion);
 
+  if (m_WriteBehind && numDivisions > 1)
+  {
+    this->WriteBehindPieces(numDivisions, pasteIORegion, largestIORegion);
+
+    this->InvokeEvent(EndEvent());
+    this->ReleaseInputs();
+    return;
+  }
+
   /**
    * Loop over the number of pieces, execute the upstream pipeline on each
    * piece, and copy the results into the output image.
@@ -323,6 +337,138 @@ ImageFileWriter<TInputImage>::Write()
   this->ReleaseInputs();
 }
 
+//---------------------------------------------------------
+template <typename TInputImage>
+void
+ImageFileWriter<TInputImage>::WriteBehindPieces(unsigned int          numDivisions,
+                                                const ImageIORegion & pasteIORegion,
+                                                const ImageIORegion & largestIORegion)
+{
+  auto *                     nonConstInput = const_cast<InputImageType *>(this->GetInput());
+  const InputImageRegionType largestRegion = nonConstInput->GetLargestPossibleRegion();
+
+  // The pieces computed by the pipeline, waiting for the writing thread.
+  struct PieceType
+  {
+    ImageIORegion     ioRegion;
+    InputImagePointer image;
+  };
+  std::deque<PieceType>   pieces;
+  std::mutex              mutex;
+  std::condition_variable condition;
+  bool                    lastPieceQueued = false;
+  std::exception_ptr      writeException;
+
+  // The ImageIO is only used by the writing thread until it is joined.
+  std::thread writingThread([&]() {
+    while (true)
+    {
+      PieceType piece;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return !pieces.empty() || lastPieceQueued; });
+        if (pieces.empty())
+        {
+          return;
+        }
+        piece = pieces.front();
+      }
+      std::exception_ptr pieceException;
+      try
+      {
+        m_ImageIO->SetIORegion(piece.ioRegion);
+        m_ImageIO->Write(piece.image->GetBufferPointer());
+      }
+      catch (...)
+      {
+        pieceException = std::current_exception();
+      }
+      // The piece leaves the queue once written, so that the queue bounds
+      // the number of pieces in memory.
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        pieces.pop_front();
+        if (pieceException)
+        {
+          writeException = pieceException;
+          pieces.clear();
+          lastPieceQueued = true;
+        }
+      }
+      condition.notify_all();
+    }
+  });
+
+  const auto joinWritingThread = [&]() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      lastPieceQueued = true;
+    }
+    condition.notify_all();
+    writingThread.join();
+  };
+
+  try
+  {
+    for (unsigned int piece = 0; piece < numDivisions && !this->GetAbortGenerateData(); ++piece)
+    {
+      const ImageIORegion streamIORegion =
+        m_ImageIO->GetSplitRegionForWriting(piece, numDivisions, pasteIORegion, largestIORegion);
+      if (!pasteIORegion.IsInside(streamIORegion))
+      {
+        itkExceptionMacro(
+          << "ImageIO returns streamable region that is not fully contain in paste IO region. Paste IO region: "
+          << pasteIORegion << "Streamable region: " << streamIORegion);
+      }
+
+      InputImageRegionType streamRegion;
+      ImageIORegionAdaptor<TInputImage::ImageDimension>::Convert(
+        streamIORegion, streamRegion, largestRegion.GetIndex());
+
+      nonConstInput->SetRequestedRegion(streamRegion);
+      nonConstInput->PropagateRequestedRegion();
+      nonConstInput->UpdateOutputData();
+
+      if (piece == 0)
+      {
+        this->UpdateProgress(0.0f);
+      }
+
+      // The input is computed again into the same buffer for the next piece,
+      // so the piece is copied to be written later.
+      auto pieceImage = InputImageType::New();
+      pieceImage->CopyInformation(nonConstInput);
+      pieceImage->SetBufferedRegion(streamRegion);
+      pieceImage->Allocate();
+      ImageAlgorithm::Copy(nonConstInput, pieceImage.GetPointer(), streamRegion, streamRegion);
+
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return pieces.size() < m_MaximumNumberOfPiecesInFlight || writeException; });
+        if (writeException)
+        {
+          break;
+        }
+        pieces.push_back({ streamIORegion, pieceImage });
+      }
+      condition.notify_all();
+
+      this->UpdateProgress(static_cast<float>(piece + 1) / static_cast<float>(numDivisions));
+    }
+  }
+  catch (...)
+  {
+    joinWritingThread();
+    throw;
+  }
+
+  joinWritingThread();
+  if (writeException)
+  {
+    std::rethrow_exception(writeException);
+  }
+}
+
 //---------------------------------------------------------
 template <typename TInputImage>
 void
@@ -391,6 +537,8 @@ ImageFileWriter<TInputImage>::PrintSelf(std::ostream & os, Indent indent) const
 
   os << indent << "IO Region: " << m_PasteIORegion << '\n';
   os << indent << "Number of Stream Divisions: " << m_NumberOfStreamDivisions << '\n';
+  os << indent << "WriteBehind: " << (m_WriteBehind ? "On" : "Off") << '\n';
+  os << indent << "MaximumNumberOfPiecesInFlight: " << m_MaximumNumberOfPiecesInFlight << '\n';
   os << indent << "CompressionLevel: " << m_CompressionLevel << '\n';
 
   if (m_UseCompression)
@@ -440,6 +440,19 @@ public:
   virtual void
   Read(void * buffer) = 0;
 
+  /** Get the file, and the byte offset in this file, at which the pixel data
+   * of the whole image is stored in a way that allows to use it in place:
+   * contiguously, uncompressed, with interleaved components of the component
+   * type of the ImageIO, and in the byte order of the machine. Returns false
+   * otherwise, which is the default. Must be called after
+   * ReadImageInformation(). Used by ImageFileReader to memory map the pixel
+   * data, see ImageFileReader::SetUseMemoryMapping(). */
+  virtual bool
+  GetPixelDataLocation(std::string & itkNotUsed(fileName), SizeValueType & itkNotUsed(offset))
+  {
+    return false;
+  }
+
   /*-------- This part of the interfaces deals with writing data ----- */
 
   /** Determine the file type. Returns true if this ImageIO can read the
@@ -860,6 +873,11 @@ protected:
   bool
   ReadBufferAsBinary(std::istream & is, void * buffer, SizeType num);
 
+  /** Whether binary data in the given byte order can be used without
+   * swapping on this machine, given the component type. */
+  bool
+  IsSystemByteOrder(IOByteOrderEnum byteOrder) const;
+
   /** Insert an extension to the list of supported extensions for reading. */
   void
   AddSupportedReadExtension(const char * extension);
@@ -17,6 +17,7 @@
  *=========================================================================*/
 
 #include "itkImageIOBase.h"
+#include "itkByteSwapper.h"
 #include "itkImageRegionSplitterSlowDimension.h"
 #include <mutex>
 #include "itksys/SystemTools.hxx"
@@ -395,6 +396,16 @@ ImageIOBase::GetComponentSize() const
   }
 }
 
+bool
+ImageIOBase::IsSystemByteOrder(IOByteOrderEnum byteOrder) const
+{
+  if (this->GetComponentSize() == 1 || byteOrder == IOByteOrderEnum::OrderNotApplicable)
+  {
+    return true;
+  }
+  return (byteOrder == IOByteOrderEnum::BigEndian) == ByteSwapper<int>::SystemIsBigEndian();
+}
+
 std::string
 ImageIOBase::GetFileTypeAsString(IOFileEnum t) const
 {
@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageBufferRange.h"
+#include "itkShiftScaleImageFilter.h"
+#include "itkTimeProbe.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+// Checks that streaming a file through a filter with ImageFileReader reading
+// ahead and ImageFileWriter writing behind writes the same file as the
+// serial streaming, and compares their times.
+//
+// Usage: itkImageFileWriterWriteBehindTest outputDirectory [imageSize]
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using ShortImageType = itk::Image<short, Dimension>;
+using FloatImageType = itk::Image<float, Dimension>;
+
+template <typename TImage>
+bool
+HaveSamePixels(const std::string & fileName, const std::string & referenceFileName)
+{
+  const typename TImage::Pointer            image = itk::ReadImage<TImage>(fileName);
+  const typename TImage::Pointer            reference = itk::ReadImage<TImage>(referenceFileName);
+  const itk::ImageBufferRange<const TImage> range(*image);
+  const itk::ImageBufferRange<const TImage> referenceRange(*reference);
+  return image->GetLargestPossibleRegion() == reference->GetLargestPossibleRegion() &&
+         std::equal(range.cbegin(), range.cend(), referenceRange.cbegin(), referenceRange.cend());
+}
+
+// Streams the input file through ShiftScaleImageFilter into the output file.
+double
+StreamShiftScale(const std::string & inputFileName,
+                 const std::string & outputFileName,
+                 bool                pipelined,
+                 unsigned int &      numberOfFilterExecutions)
+{
+  auto reader = itk::ImageFileReader<ShortImageType>::New();
+  reader->SetFileName(inputFileName);
+  reader->SetReadAhead(pipelined);
+  auto shiftScale = itk::ShiftScaleImageFilter<ShortImageType, FloatImageType>::New();
+  shiftScale->SetInput(reader->GetOutput());
+  shiftScale->SetShift(3.0);
+  shiftScale->SetScale(0.5);
+  numberOfFilterExecutions = 0;
+  shiftScale->AddObserver(itk::StartEvent(),
+                          [&numberOfFilterExecutions](const itk::EventObject &) { ++numberOfFilterExecutions; });
+  auto writer = itk::ImageFileWriter<FloatImageType>::New();
+  writer->SetInput(shiftScale->GetOutput());
+  writer->SetFileName(outputFileName);
+  writer->SetNumberOfStreamDivisions(8);
+  writer->SetWriteBehind(pipelined);
+
+  itk::TimeProbe probe;
+  probe.Start();
+  writer->Update();
+  probe.Stop();
+  return probe.GetTotal();
+}
+} // namespace
+
+int
+itkImageFileWriterWriteBehindTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputDirectory [imageSize]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string        directory = argv[1];
+  const itk::SizeValueType imageSize = (argc > 2) ? std::stoul(argv[2]) : 64;
+
+  auto input = ShortImageType::New();
+  input->SetRegions(ShortImageType::SizeType::Filled(imageSize));
+  input->Allocate();
+  const itk::ImageBufferRange<ShortImageType> inputRange(*input);
+  unsigned int                                seed = 12345;
+  for (auto && pixel : inputRange)
+  {
+    seed = seed * 1103515245u + 12345u;
+    pixel = static_cast<short>((seed >> 16) % 2000) - 500;
+  }
+  const std::string inputFileName = directory + "/itkImageFileWriterWriteBehindTestInput.mha";
+  itk::WriteImage(input, inputFileName);
+
+  auto writer = itk::ImageFileWriter<FloatImageType>::New();
+  ITK_TEST_SET_GET_BOOLEAN(writer, WriteBehind, false);
+  ITK_TEST_SET_GET_VALUE(2, writer->GetMaximumNumberOfPiecesInFlight());
+  writer->SetMaximumNumberOfPiecesInFlight(0);
+  ITK_TEST_SET_GET_VALUE(1, writer->GetMaximumNumberOfPiecesInFlight());
+  auto reader = itk::ImageFileReader<FloatImageType>::New();
+  ITK_TEST_SET_GET_BOOLEAN(reader, ReadAhead, false);
+
+  // The pipelined streaming writes the same file as the serial streaming.
+  const std::string serialFileName = directory + "/itkImageFileWriterWriteBehindTestSerial.mha";
+  const std::string pipelinedFileName = directory + "/itkImageFileWriterWriteBehindTestPipelined.mha";
+  unsigned int      numberOfFilterExecutions = 0;
+  double            serialTime = 0.0;
+  double            pipelinedTime = 0.0;
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    serialTime += StreamShiftScale(inputFileName, serialFileName, false, numberOfFilterExecutions);
+    ITK_TEST_EXPECT_EQUAL(numberOfFilterExecutions, 8);
+    pipelinedTime += StreamShiftScale(inputFileName, pipelinedFileName, true, numberOfFilterExecutions);
+    ITK_TEST_EXPECT_EQUAL(numberOfFilterExecutions, 8);
+  }
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<FloatImageType>(pipelinedFileName, serialFileName));
+  std::cout << "Serial streaming: " << serialTime / 3 << " s" << std::endl;
+  std::cout << "Pipelined streaming: " << pipelinedTime / 3 << " s" << std::endl;
+
+  // Pieces of unequal sizes, read with a pixel conversion, with a single piece in flight.
+  reader->SetFileName(inputFileName);
+  reader->ReadAheadOn();
+  writer->SetInput(reader->GetOutput());
+  writer->SetFileName(pipelinedFileName);
+  writer->SetNumberOfStreamDivisions(7);
+  writer->WriteBehindOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+  const std::string convertedFileName = directory + "/itkImageFileWriterWriteBehindTestConverted.mha";
+  itk::WriteImage(itk::ReadImage<FloatImageType>(inputFileName), convertedFileName);
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels<FloatImageType>(pipelinedFileName, convertedFileName));
+
+  // The reader may then read regions which were not predicted.
+  reader->GetOutput()->SetRequestedRegion(
+    FloatImageType::RegionType(FloatImageType::IndexType{ { 0, 0, 3 } }, FloatImageType::SizeType{ { 5, 4, 2 } }));
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->GetOutput()->Update());
+  const FloatImageType::IndexType index{ { 4, 3, 4 } };
+  ITK_TEST_EXPECT_EQUAL(reader->GetOutput()->GetPixel(index), static_cast<float>(input->GetPixel(index)));
+
+  // The errors of the writing thread are reported by Update().
+  writer->SetFileName(directory + "/nonexistent/itkImageFileWriterWriteBehindTest.mha");
+  ITK_TRY_EXPECT_EXCEPTION(writer->Update());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
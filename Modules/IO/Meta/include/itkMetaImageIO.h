@@ -82,6 +82,11 @@ public:
   void
   Read(void * buffer) override;
 
+  /** The pixel data can be used in place when it is binary, uncompressed, in
+   * the byte order of the machine, and stored in a single file. */
+  bool
+  GetPixelDataLocation(std::string & fileName, SizeValueType & offset) override;
+
   MetaImage *
   GetMetaImagePointer();
 
@@ -496,6 +496,57 @@ MetaImageIO::Read(void * buffer)
   }
 }
 
+bool
+MetaImageIO::GetPixelDataLocation(std::string & fileName, SizeValueType & offset)
+{
+  // The data of a list of files, or of a file pattern, is not contiguous.
+  const std::string elementDataFileName = m_MetaImage.ElementDataFileName();
+  if (!m_MetaImage.BinaryData() || m_MetaImage.CompressedData() || m_SubSamplingFactor != 1 ||
+      m_MetaImage.BinaryDataByteOrderMSB() != MET_SystemByteOrderMSB() ||
+      elementDataFileName.compare(0, 4, "LIST") == 0 || elementDataFileName.find('%') != std::string::npos)
+  {
+    return false;
+  }
+
+  const bool isLocal = itksys::SystemTools::UpperCase(elementDataFileName) == "LOCAL";
+  if (isLocal)
+  {
+    fileName = m_FileName;
+  }
+  else if (itksys::SystemTools::FileIsFullPath(elementDataFileName))
+  {
+    fileName = elementDataFileName;
+  }
+  else
+  {
+    const std::string pathName = itksys::SystemTools::GetFilenamePath(m_FileName);
+    fileName = pathName.empty() ? elementDataFileName : pathName + '/' + elementDataFileName;
+  }
+
+  // MetaIO falls back on a compressed file with the .gz or .Z extension.
+  if (!itksys::SystemTools::FileExists(fileName, true))
+  {
+    return false;
+  }
+
+  const SizeValueType dataSize = this->GetImageSizeInBytes();
+  const SizeValueType fileSize = itksys::SystemTools::FileLength(fileName);
+  if (m_MetaImage.HeaderSize() > 0)
+  {
+    offset = static_cast<SizeValueType>(m_MetaImage.HeaderSize());
+  }
+  else if (isLocal || m_MetaImage.HeaderSize() == -1)
+  {
+    // The data ends the file.
+    offset = (fileSize >= dataSize) ? fileSize - dataSize : 0;
+  }
+  else
+  {
+    offset = 0;
+  }
+  return offset + dataSize <= fileSize;
+}
+
 MetaImage *
 MetaImageIO::GetMetaImagePointer()
 {
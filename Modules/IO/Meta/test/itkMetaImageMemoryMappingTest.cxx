@@ -0,0 +1,159 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <algorithm>
+#include <fstream>
+#include "itkByteSwapper.h"
+#include "itkImageBufferRange.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkMedianImageFilter.h"
+#include "itkMemoryMappedImageContainer.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+using PixelType = float;
+using ImageType = itk::Image<PixelType, 3>;
+using ContainerType = itk::MemoryMappedImageContainer<itk::SizeValueType, PixelType>;
+using ModeEnum = itk::MemoryMappedFileEnums::Mode;
+
+bool
+HaveSamePixels(const ImageType * image1, const ImageType * image2)
+{
+  const itk::ImageBufferRange<const ImageType> range1(*image1);
+  const itk::ImageBufferRange<const ImageType> range2(*image2);
+  return range1.size() == range2.size() && std::equal(range1.cbegin(), range1.cend(), range2.cbegin());
+}
+
+ImageType::Pointer
+ReadImage(const std::string & fileName, bool useMemoryMapping)
+{
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  reader->SetUseMemoryMapping(useMemoryMapping);
+  reader->Update();
+  return reader->GetOutput();
+}
+
+bool
+IsMapped(const ImageType * image)
+{
+  const auto * const container = dynamic_cast<const ContainerType *>(image->GetPixelContainer());
+  return container != nullptr && container->IsMapped();
+}
+} // namespace
+
+int
+itkMetaImageMemoryMappingTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputDirectory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string directory = argv[1];
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 37, 21, 13 } });
+  image->Allocate();
+  PixelType value = 0.0f;
+  for (PixelType & pixel : itk::ImageBufferRange<ImageType>(*image))
+  {
+    pixel = value;
+    value += 0.5f;
+  }
+
+  // Attached and detached data, which is mapped.
+  for (const std::string extension : { ".mha", ".mhd" })
+  {
+    const std::string fileName = directory + "/itkMetaImageMemoryMappingTest" + extension;
+    itk::WriteImage(image, fileName);
+
+    const ImageType::Pointer mapped = ReadImage(fileName, true);
+    ITK_TEST_EXPECT_TRUE(IsMapped(mapped));
+    ITK_TEST_EXPECT_TRUE(HaveSamePixels(mapped, image));
+
+    // The mapping is copy on write.
+    mapped->GetPixelContainer()->GetBufferPointer()[0] = -1.0f;
+    ITK_TEST_EXPECT_TRUE(HaveSamePixels(ReadImage(fileName, false), image));
+  }
+
+  // Compressed data cannot be mapped, it is read.
+  const std::string compressedFileName = directory + "/itkMetaImageMemoryMappingTestCompressed.mha";
+  itk::WriteImage(image, compressedFileName, true);
+  const ImageType::Pointer read = ReadImage(compressedFileName, true);
+  ITK_TEST_EXPECT_TRUE(!IsMapped(read));
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels(read, image));
+
+  // A filter writes its output directly into a raw data file.
+  const std::string rawFileName = directory + "/itkMetaImageMemoryMappingTestOutput.raw";
+  auto              median = itk::MedianImageFilter<ImageType, ImageType>::New();
+  median->SetInput(image);
+  median->SetRadius(1);
+  median->ReleaseDataBeforeUpdateFlagOff();
+
+  auto container = ContainerType::New();
+  container->MapFile(rawFileName, 0, image->GetBufferedRegion().GetNumberOfPixels(), ModeEnum::ReadWrite);
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(container, MemoryMappedImageContainer, ImportImageContainer);
+  const PixelType * const mappedBuffer = container->GetBufferPointer();
+  median->GetOutput()->SetPixelContainer(container);
+  ITK_TRY_EXPECT_NO_EXCEPTION(median->Update());
+  ITK_TEST_EXPECT_EQUAL(median->GetOutput()->GetBufferPointer(), mappedBuffer);
+  ITK_TRY_EXPECT_NO_EXCEPTION(container->Flush());
+
+  // A MetaImage header gives access to the raw data file.
+  const std::string headerFileName = directory + "/itkMetaImageMemoryMappingTestOutput.mhd";
+  {
+    std::ofstream header(headerFileName);
+    header << "ObjectType = Image\nNDims = 3\nDimSize = 37 21 13\nElementType = MET_FLOAT\n"
+           << "BinaryData = True\nBinaryDataByteOrderMSB = "
+           << (itk::ByteSwapper<PixelType>::SystemIsBigEndian() ? "True" : "False")
+           << "\nElementDataFile = itkMetaImageMemoryMappingTestOutput.raw\n";
+  }
+  const ImageType::Pointer output = ReadImage(headerFileName, true);
+  ITK_TEST_EXPECT_TRUE(IsMapped(output));
+
+  median->SetReleaseDataBeforeUpdateFlag(true);
+  median->Modified();
+  median->Update();
+  ITK_TEST_EXPECT_TRUE(!IsMapped(median->GetOutput()));
+  ITK_TEST_EXPECT_TRUE(HaveSamePixels(output, median->GetOutput()));
+
+  // Growing the container copies the elements, and unmaps the file.
+  container = ContainerType::New();
+  container->MapFile(rawFileName, 4 * sizeof(PixelType), 10, ModeEnum::ReadOnly);
+  ITK_TEST_EXPECT_TRUE(container->IsMapped());
+  ITK_TEST_EXPECT_EQUAL(container->GetMode(), ModeEnum::ReadOnly);
+  ITK_TEST_EXPECT_EQUAL(container->GetFileName(), rawFileName);
+  ITK_TEST_EXPECT_EQUAL((*container)[0], median->GetOutput()->GetBufferPointer()[4]);
+  container->Reserve(20);
+  ITK_TEST_EXPECT_TRUE(!container->IsMapped());
+  ITK_TEST_EXPECT_EQUAL((*container)[9], median->GetOutput()->GetBufferPointer()[13]);
+
+  // Mapping beyond the end of the file is an error, except in ReadWrite mode.
+  ITK_TRY_EXPECT_EXCEPTION(container->MapFile(rawFileName, 0, 1000000, ModeEnum::CopyOnWrite));
+  ITK_TRY_EXPECT_EXCEPTION(container->MapFile(directory + "/itkMetaImageMemoryMappingTestMissing.raw",
+                                              0,
+                                              10,
+                                              ModeEnum::ReadOnly));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -149,6 +149,12 @@ public:
   void
   Read(void * buffer) override;
 
+  /** The pixel data can be used in place when it is uncompressed, in the byte
+   * order of the machine, not rescaled, and when its components are
+   * interleaved, as for scalar, complex, RGB and RGBA pixels. */
+  bool
+  GetPixelDataLocation(std::string & fileName, SizeValueType & offset) override;
+
   //-------- This part of the interfaces deals with writing data. -----
 
   /** Determine if the file can be written with this ImageIO implementation.
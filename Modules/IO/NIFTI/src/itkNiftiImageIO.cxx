@@ -820,6 +820,35 @@ NiftiImageIO::Read(void * buffer)
   }
 }
 
+bool
+NiftiImageIO::GetPixelDataLocation(std::string & fileName, SizeValueType & offset)
+{
+  // Read() reorders the components of the other pixel types, and converts
+  // the RAS vectors.
+  const IOPixelEnum pixelType = this->GetPixelType();
+  if (this->MustRescale() || this->m_ConvertRAS ||
+      (this->GetNumberOfComponents() != 1 && pixelType != IOPixelEnum::COMPLEX && pixelType != IOPixelEnum::RGB &&
+       pixelType != IOPixelEnum::RGBA))
+  {
+    return false;
+  }
+
+  nifti_image * const header = nifti_image_read(this->GetFileName(), false);
+  if (header == nullptr)
+  {
+    return false;
+  }
+  const bool inPlace = header->iname != nullptr && !nifti_is_gzfile(header->iname) && header->iname_offset >= 0 &&
+                       (header->nbyper == 1 || header->byteorder == nifti_short_order());
+  if (inPlace)
+  {
+    fileName = header->iname;
+    offset = static_cast<SizeValueType>(header->iname_offset);
+  }
+  nifti_image_free(header);
+  return inPlace;
+}
+
 NiftiImageIOEnums::NiftiFileEnum
 NiftiImageIO::DetermineFileType(const char * FileNameToRead)
 {
@@ -78,6 +78,12 @@ public:
   void
   Read(void * buffer) override;
 
+  /** The pixel data can be used in place when it is raw encoded, in the byte
+   * order of the machine, stored in a single file, and its components are
+   * on the fastest axis. */
+  bool
+  GetPixelDataLocation(std::string & fileName, SizeValueType & offset) override;
+
   /** Determine the file type. Returns true if this ImageIO can write the
    * file specified. */
   bool
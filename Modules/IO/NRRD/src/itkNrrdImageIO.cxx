@@ -22,7 +22,9 @@
 #include "itkMetaDataObject.h"
 #include "itkIOCommon.h"
 #include "itkFloatingPointExceptions.h"
+#include "itksys/SystemTools.hxx"
 
+#include <cstdio>
 #include <sstream>
 
 namespace itk
@@ -851,6 +853,78 @@ NrrdImageIO::Read(void * buffer)
   }
 }
 
+bool
+NrrdImageIO::GetPixelDataLocation(std::string & fileName, SizeValueType & offset)
+{
+  Nrrd *        nrrd = nrrdNew();
+  NrrdIoState * nio = nrrdIoStateNew();
+
+  // nrrdLoad skips the lines and bytes preceding the data, and keeps the
+  // data file open at the beginning of the data.
+  nrrdIoStateSet(nio, nrrdIoStateSkipData, 1);
+  nrrdIoStateSet(nio, nrrdIoStateKeepNrrdDataFileOpen, 1);
+
+  // nrrd causes exceptions on purpose, so mask them
+  bool saveFPEState(false);
+  if (FloatingPointExceptions::HasFloatingPointExceptionsSupport())
+  {
+    saveFPEState = FloatingPointExceptions::GetEnabled();
+    FloatingPointExceptions::Disable();
+  }
+
+  bool inPlace = false;
+  if (nrrdLoad(nrrd, this->GetFileName(), nio) == 0)
+  {
+    // Read() permutes the range axis to be the fastest one, and crops the
+    // mask of masked tensors.
+    unsigned int       rangeAxisIdx[NRRD_DIM_MAX];
+    const unsigned int rangeAxisNum = nrrdRangeAxesGet(nrrd, rangeAxisIdx);
+    inPlace = nio->dataFile != nullptr && nio->encoding == nrrdEncodingRaw && nio->dataFNFormat == nullptr &&
+              nio->dataFNArr->len <= 1 && (rangeAxisNum == 0 || (rangeAxisNum == 1 && rangeAxisIdx[0] == 0)) &&
+              nrrd->axis[0].kind != nrrdKind3DMaskedSymMatrix &&
+              (nrrdElementSize(nrrd) == 1 || nio->endian == airMyEndian());
+    if (inPlace)
+    {
+      if (nio->dataFNArr->len == 0)
+      {
+        // The data is attached to the header.
+        fileName = this->GetFileName();
+      }
+      else
+      {
+        // Detached data files are relative to the header, unless absolute.
+        const std::string dataFileName = nio->dataFN[0];
+        fileName = itksys::SystemTools::FileIsFullPath(dataFileName) ? dataFileName
+                                                                     : std::string(nio->path) + '/' + dataFileName;
+      }
+#if defined(_WIN32)
+      const long long position = _ftelli64(nio->dataFile);
+#else
+      const off_t position = ftello(nio->dataFile);
+#endif
+      inPlace = position >= 0;
+      offset = static_cast<SizeValueType>(position);
+    }
+  }
+  else
+  {
+    free(biffGetDone(NRRD));
+  }
+
+  if (FloatingPointExceptions::HasFloatingPointExceptionsSupport())
+  {
+    FloatingPointExceptions::SetEnabled(saveFPEState);
+  }
+
+  if (nio->dataFile)
+  {
+    airFclose(nio->dataFile);
+  }
+  nrrdNix(nrrd);
+  nrrdIoStateNix(nio);
+  return inPlace;
+}
+
 bool
 NrrdImageIO::CanWriteFile(const char * name)
 {
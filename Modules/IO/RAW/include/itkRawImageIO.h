@@ -123,6 +123,11 @@ public:
   void
   Read(void * buffer) override;
 
+  /** The pixel data follows the header, and can be used in place when it is
+   * binary, in the byte order of the machine. */
+  bool
+  GetPixelDataLocation(std::string & fileName, SizeValueType & offset) override;
+
   /** Set/Get the Data mask. */
   itkGetConstReferenceMacro(ImageMask, unsigned short);
   void
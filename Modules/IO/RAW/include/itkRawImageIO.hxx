@@ -161,6 +161,19 @@ RawImageIO<TPixel, VImageDimension>::Read(void * buffer)
   ReadRawBytesAfterSwapping(componentType, buffer, m_ByteOrder, numberOfComponents);
 }
 
+template <typename TPixel, unsigned int VImageDimension>
+bool
+RawImageIO<TPixel, VImageDimension>::GetPixelDataLocation(std::string & fileName, SizeValueType & offset)
+{
+  if (m_FileType != IOFileEnum::Binary || !this->IsSystemByteOrder(m_ByteOrder))
+  {
+    return false;
+  }
+  fileName = m_FileName;
+  offset = this->GetHeaderSize();
+  return true;
+}
+
 template <typename TPixel, unsigned int VImageDimension>
 bool
 RawImageIO<TPixel, VImageDimension>::CanWriteFile(const char * fname)